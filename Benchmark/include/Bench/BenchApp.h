@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Engine.h"
+
+#include "Bench/BenchLayer.h"
+
+/**
+ * Handles a benchmark run.
+ *
+ * The `BenchApp` class is a derived class of the `Application` class that renders a stress scene
+ * (`BenchLayer`) in a hidden window, without vertical synchronization, and stops once the results
+ * have been written.
+ *
+ * Copying or moving `BenchApp` objects is disabled to ensure single ownership and prevent unintended
+ * duplication.
+ */
+class BenchApp : public Application
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    BenchApp(const BenchConfig& config);
+    ~BenchApp();
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the number of regressions found compared to the baseline.
+    /// @return The number of regressions.
+    unsigned int GetRegressions() const { return m_Bench->GetRegressions(); }
+    /// @brief Check if the results could not be compared with the requested baseline.
+    /// @return `true` if the baseline could not be read.
+    bool HasFailed() const { return m_Bench->HasFailed(); }
+    
+    // Benchmark application variables
+    // ----------------------------------------
+private:
+    ///< Benchmark scene (rendering layer).
+    std::shared_ptr<BenchLayer> m_Bench;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    BenchApp(const BenchApp&) = delete;
+    BenchApp(BenchApp&&) = delete;
+    
+    BenchApp& operator=(const BenchApp&) = delete;
+    BenchApp& operator=(BenchApp&&) = delete;
+};
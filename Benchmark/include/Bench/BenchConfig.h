@@ -0,0 +1,48 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+
+/**
+ * Represents the parameters of a benchmark run.
+ */
+struct BenchConfig
+{
+    ///< Number of cubes in the scene.
+    unsigned int Cubes = 100;
+    ///< Number of spheres in the scene.
+    unsigned int Spheres = 100;
+    ///< Number of positional lights casting shadows.
+    unsigned int Lights = 2;
+    ///< Number of different materials assigned to the objects.
+    unsigned int Materials = 8;
+    ///< Model loaded with Assimp and added to the scene (optional).
+    std::filesystem::path Model;
+    ///< Cull the shadow casters on the GPU.
+    bool Culling = false;
+    
+    ///< Frames rendered before the measurements start.
+    unsigned int WarmupFrames = 100;
+    ///< Frames measured.
+    unsigned int Frames = 1000;
+    ///< Size of the rendered image.
+    unsigned int Width = 1280, Height = 720;
+    ///< Size of the shadow maps.
+    unsigned int ShadowMapSize = 1024;
+    ///< GPU time budget controlling the render scale (in milliseconds, disabled if zero).
+    float GPUBudget = 0.0f;
+    ///< Show the window while rendering (hidden by default).
+    bool Visible = false;
+    
+    ///< File where the results are written (JSON).
+    std::filesystem::path Output = "bench/results.json";
+    ///< Results of a previous run to compare with (optional).
+    std::filesystem::path Baseline;
+    ///< Relative increase (e.g., 0.1 for 10%) of a metric reported as a regression.
+    float Threshold = 0.1f;
+    
+    // Parsing
+    // ----------------------------------------
+    bool Parse(int argc, char** argv);
+    static void PrintUsage();
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Engine.h"
+
+#include "Bench/BenchConfig.h"
+
+/**
+ * Rendering layer building and measuring a parameterized stress scene.
+ *
+ * The `BenchLayer` class builds a scene from the engine primitives (a grid of cubes and spheres
+ * over a plane, positional lights with shadow maps, a set of materials and an optional Assimp
+ * model), renders it for a fixed number of frames and closes the application once the results
+ * have been collected.
+ *
+ * Copying or moving `BenchLayer` objects is disabled to ensure single ownership and prevent
+ * unintended layer duplication.
+ */
+class BenchLayer : public Layer
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    BenchLayer(const BenchConfig& config);
+    
+    // Layer handlers
+    // ----------------------------------------
+    void OnAttach() override;
+    void OnUpdate(Timestep ts) override;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the number of regressions found compared to the baseline.
+    /// @return The number of regressions.
+    unsigned int GetRegressions() const { return m_Regressions; }
+    /// @brief Check if the results could not be compared with the requested baseline.
+    /// @return `true` if the baseline could not be read.
+    bool HasFailed() const { return m_Failed; }
+
+private:
+    // Initialization
+    // ----------------------------------------
+    void DefineLights();
+    void DefineMaterials();
+    void DefineSceneGeometry();
+    void DefineRenderPasses();
+    
+    // Results
+    // ----------------------------------------
+    void Finish();
+    
+    // Benchmark layer variables
+    // ----------------------------------------
+private:
+    ///< Parameters of the run.
+    BenchConfig m_Config;
+    ///< Scene to be rendered.
+    std::unique_ptr<Scene> m_Scene;
+    
+    ///< Names of the rendered objects.
+    std::vector<std::string> m_Objects;
+    ///< Names of the materials assigned to the objects.
+    std::vector<std::string> m_Materials;
+    
+    ///< Index of the first measured frame.
+    uint64_t m_FirstFrame = 0;
+    ///< Number of frames rendered.
+    uint64_t m_Frame = 0;
+    ///< Number of regressions found compared to the baseline.
+    unsigned int m_Regressions = 0;
+    ///< Indicates whether the requested baseline could not be read.
+    bool m_Failed = false;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    BenchLayer(const BenchLayer&) = delete;
+    BenchLayer(BenchLayer&&) = delete;
+    
+    BenchLayer& operator=(const BenchLayer&) = delete;
+    BenchLayer& operator=(BenchLayer&&) = delete;
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Bench/BenchConfig.h"
+
+#include <vector>
+
+/**
+ * Represents a measured value of a benchmark run.
+ */
+struct BenchMetric
+{
+    ///< Name of the metric (key in the JSON results).
+    std::string Name;
+    ///< Measured value.
+    double Value = 0.0;
+    ///< The metric is compared with the baseline (only for values where lower is better).
+    bool Compared = true;
+};
+
+/**
+ * Collects the results of a benchmark run and compares them with a baseline.
+ *
+ * The `BenchReport` class summarizes the frame history recorded by `FrameStatistics` (frame, CPU
+ * and GPU time percentiles, draw calls, triangles) together with the peak memory of the process,
+ * and writes them as JSON. The results of a previous run can be used as a baseline: each compared
+ * metric that increases more than the threshold is reported as a regression.
+ */
+class BenchReport
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Define an empty report for a benchmark run.
+    /// @param config The parameters of the run.
+    BenchReport(const BenchConfig& config) : m_Config(config) {}
+    /// @brief Delete the report.
+    ~BenchReport() = default;
+    
+    // Results
+    // ----------------------------------------
+    void Collect(uint64_t firstFrame, unsigned int frames);
+    bool Write(const std::filesystem::path& filePath) const;
+    bool Compare(const std::filesystem::path& baselinePath, float threshold,
+                 unsigned int& regressions) const;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the measured values.
+    /// @return The list of metrics.
+    const std::vector<BenchMetric>& GetMetrics() const { return m_Metrics; }
+
+private:
+    // Report variables
+    // ----------------------------------------
+    ///< Parameters of the run.
+    BenchConfig m_Config;
+    ///< Measured values (in the order they are written).
+    std::vector<BenchMetric> m_Metrics;
+};
@@ -0,0 +1,64 @@
+#include "Engine.h"
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+/**
+ * Define a library with a number of named objects.
+ *
+ * @param library The library to be filled.
+ * @param names The names of the objects.
+ * @param size The number of objects.
+ */
+void FillLibrary(Library<int>& library, std::vector<std::string>& names, size_t size)
+{
+    names.reserve(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        names.push_back("Object" + std::to_string(i));
+        library.Add(names.back(), (int)i);
+    }
+}
+
+} // namespace
+
+/**
+ * Measure the retrieval of objects from a library by their name.
+ *
+ * @param state The benchmark state (the argument is the number of objects).
+ */
+static void BM_LibraryGetByName(benchmark::State& state)
+{
+    Library<int> library;
+    std::vector<std::string> names;
+    FillLibrary(library, names, (size_t)state.range(0));
+    
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(library.Get(names[i]));
+        i = (i + 1) % names.size();
+    }
+}
+BENCHMARK(BM_LibraryGetByName)->RangeMultiplier(8)->Range(8, 4096);
+
+/**
+ * Measure the retrieval of objects from a library by their handle.
+ *
+ * @param state The benchmark state (the argument is the number of objects).
+ */
+static void BM_LibraryGetByHandle(benchmark::State& state)
+{
+    Library<int> library;
+    std::vector<std::string> names;
+    FillLibrary(library, names, (size_t)state.range(0));
+    
+    LibraryHandle handle = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(library.Get(handle));
+        handle = (handle + 1) % library.Size();
+    }
+}
+BENCHMARK(BM_LibraryGetByHandle)->RangeMultiplier(8)->Range(8, 4096);
@@ -0,0 +1,52 @@
+#include "Engine.h"
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+/**
+ * Define a deterministic set of spherical harmonics coefficients (9 per color channel).
+ *
+ * @return The coefficients.
+ */
+std::vector<float> SampleCoefficients()
+{
+    std::vector<float> coeffs(27);
+    for (size_t i = 0; i < coeffs.size(); i++)
+        coeffs[i] = 0.1f * std::sin(0.7f * (float)i) + 0.05f;
+    return coeffs;
+}
+
+} // namespace
+
+/**
+ * Measure the generation of the isotropic irradiance matrices from the SH coefficients.
+ *
+ * @param state The benchmark state.
+ */
+static void BM_GenerateIsotropicMatrix(benchmark::State& state)
+{
+    std::vector<float> coeffs = SampleCoefficients();
+    for (auto _ : state)
+    {
+        for (int color = 0; color < 3; color++)
+            benchmark::DoNotOptimize(SHCoefficients::GenerateIsotropicMatrix(color, coeffs));
+    }
+}
+BENCHMARK(BM_GenerateIsotropicMatrix);
+
+/**
+ * Measure the generation of the anisotropic irradiance matrices from the SH coefficients.
+ *
+ * @param state The benchmark state.
+ */
+static void BM_GenerateAnisotropicMatrix(benchmark::State& state)
+{
+    std::vector<float> coeffs = SampleCoefficients();
+    for (auto _ : state)
+    {
+        for (int color = 0; color < 3; color++)
+            benchmark::DoNotOptimize(SHCoefficients::GenerateAnisotropicMatrix(color, coeffs));
+    }
+}
+BENCHMARK(BM_GenerateAnisotropicMatrix);
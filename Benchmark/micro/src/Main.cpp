@@ -0,0 +1,31 @@
+#include "Engine.h"
+
+#include <benchmark/benchmark.h>
+
+/**
+ * Entry point of the microbenchmarks.
+ *
+ * The `main` function runs the registered benchmarks of the CPU hot paths. None of them needs a
+ * window or an OpenGL context, so they can run on machines without a GPU.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments (see `--help` for the options of Google Benchmark).
+ *
+ * @return Zero if the benchmarks ran, one if the arguments are not valid.
+ */
+int main(int argc, char** argv)
+{
+    // Initialize the logging system
+    Log::Init();
+    
+    // Run the benchmarks
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+    
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    Log::Shutdown();
+    
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include "Engine.h"
+
+#include <assimp/mesh.h>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+/**
+ * Define a synthetic ASSIMP mesh: a triangulated grid with texture coordinates and normals.
+ *
+ * @param resolution The number of cells of the grid in each direction.
+ *
+ * @return The ASSIMP mesh.
+ */
+std::unique_ptr<aiMesh> GridMesh(unsigned int resolution)
+{
+    auto mesh = std::make_unique<aiMesh>();
+    const unsigned int side = resolution + 1;
+    
+    // Vertex data
+    mesh->mNumVertices = side * side;
+    mesh->mVertices = new aiVector3D[mesh->mNumVertices];
+    mesh->mNormals = new aiVector3D[mesh->mNumVertices];
+    mesh->mTextureCoords[0] = new aiVector3D[mesh->mNumVertices];
+    mesh->mNumUVComponents[0] = 2;
+    for (unsigned int y = 0; y < side; y++)
+    {
+        for (unsigned int x = 0; x < side; x++)
+        {
+            unsigned int i = y * side + x;
+            float u = (float)x / resolution, v = (float)y / resolution;
+            mesh->mVertices[i] = aiVector3D(u - 0.5f, 0.0f, v - 0.5f);
+            mesh->mNormals[i] = aiVector3D(0.0f, 1.0f, 0.0f);
+            mesh->mTextureCoords[0][i] = aiVector3D(u, v, 0.0f);
+        }
+    }
+    
+    // Faces (two triangles per cell)
+    mesh->mNumFaces = 2 * resolution * resolution;
+    mesh->mFaces = new aiFace[mesh->mNumFaces];
+    unsigned int f = 0;
+    for (unsigned int y = 0; y < resolution; y++)
+    {
+        for (unsigned int x = 0; x < resolution; x++)
+        {
+            unsigned int i = y * side + x;
+            unsigned int quad[2][3] = {
+                { i, i + side, i + 1 },
+                { i + 1, i + side, i + side + 1 }
+            };
+            for (auto& triangle : quad)
+            {
+                aiFace& face = mesh->mFaces[f++];
+                face.mNumIndices = 3;
+                face.mIndices = new unsigned int[3];
+                std::copy(triangle, triangle + 3, face.mIndices);
+            }
+        }
+    }
+    return mesh;
+}
+
+} // namespace
+
+/**
+ * Measure the reading of the vertex and index data of an ASSIMP mesh.
+ *
+ * @param state The benchmark state (the argument is the resolution of the grid).
+ */
+static void BM_ReadAssimpMesh(benchmark::State& state)
+{
+    auto mesh = GridMesh((unsigned int)state.range(0));
+    
+    std::vector<AssimpVertexData> vertices;
+    std::vector<unsigned int> indices;
+    for (auto _ : state)
+    {
+        AssimpModel::ReadMeshData(mesh.get(), vertices, indices);
+        benchmark::DoNotOptimize(vertices.data());
+        benchmark::DoNotOptimize(indices.data());
+    }
+    state.SetItemsProcessed(state.iterations() * mesh->mNumVertices);
+}
+BENCHMARK(BM_ReadAssimpMesh)->RangeMultiplier(4)->Range(16, 1024);
+
+/**
+ * Measure the definition of the sphere geometry (positions, texture coordinates and normals).
+ *
+ * @param state The benchmark state (the argument is the resolution of the sphere).
+ */
+static void BM_DefineSphereGeometry(benchmark::State& state)
+{
+    const int resolution = (int)state.range(0);
+    for (auto _ : state)
+    {
+        std::vector<GeoVertexData<glm::vec4, glm::vec2, glm::vec3>> vertices;
+        std::vector<unsigned int> indices;
+        utils::Geometry::DefineSphereGeometry(vertices, indices, resolution);
+        benchmark::DoNotOptimize(vertices.data());
+        benchmark::DoNotOptimize(indices.data());
+    }
+}
+BENCHMARK(BM_DefineSphereGeometry)->RangeMultiplier(2)->Range(32, 512);
+
+/**
+ * Measure the definition of the indices of the sphere geometry.
+ *
+ * @param state The benchmark state (the argument is the resolution of the sphere).
+ */
+static void BM_IndicesOfSphere(benchmark::State& state)
+{
+    const int resolution = (int)state.range(0);
+    for (auto _ : state)
+    {
+        std::vector<unsigned int> indices = utils::Geometry::IndicesOfSphere(resolution);
+        benchmark::DoNotOptimize(indices.data());
+    }
+}
+BENCHMARK(BM_IndicesOfSphere)->RangeMultiplier(2)->Range(32, 512);
@@ -0,0 +1,36 @@
+#include "Engine.h"
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+/**
+ * Model without any mesh exposing the update of its transformation matrices.
+ */
+class ModelBenchTarget : public Model<GeoVertexData<glm::vec4>>
+{
+public:
+    using Model<GeoVertexData<glm::vec4>>::UpdateModelMatrix;
+};
+
+} // namespace
+
+/**
+ * Measure the update of the model and normal matrices of a model.
+ *
+ * @param state The benchmark state.
+ */
+static void BM_UpdateModelMatrix(benchmark::State& state)
+{
+    ModelBenchTarget model;
+    model.SetPosition(glm::vec3(1.0f, 2.0f, 3.0f));
+    model.SetRotation(glm::vec3(30.0f, 45.0f, 60.0f));
+    model.SetScale(glm::vec3(0.5f));
+    
+    for (auto _ : state)
+    {
+        model.UpdateModelMatrix();
+        benchmark::DoNotOptimize(model.GetModelMatrix());
+    }
+}
+BENCHMARK(BM_UpdateModelMatrix);
@@ -0,0 +1,40 @@
+#include "Engine.h"
+
+#include "Platform/OpenGL/Shader/OpenGLShader.h"
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+///< Phong shaders parsed by the benchmarks (the includes are resolved as well).
+const std::vector<std::filesystem::path> g_PhongShaders = {
+    "Resources/shaders/phong/PhongColor.glsl",
+    "Resources/shaders/phong/PhongColorShadow.glsl",
+    "Resources/shaders/phong/PhongTexture.glsl",
+    "Resources/shaders/phong/PhongTextureShadow.glsl"
+};
+
+} // namespace
+
+/**
+ * Measure the parsing of a Phong shader file into its separate stages.
+ *
+ * @param state The benchmark state (the argument is the index of the shader).
+ */
+static void BM_ParseShader(benchmark::State& state)
+{
+    const std::filesystem::path& filePath = g_PhongShaders[state.range(0)];
+    if (!std::filesystem::exists(filePath))
+    {
+        state.SkipWithError("Shader file not found (run from the build directory)");
+        return;
+    }
+    
+    state.SetLabel(filePath.filename().string());
+    for (auto _ : state)
+    {
+        auto source = OpenGLShader::ParseShader(filePath);
+        benchmark::DoNotOptimize(source);
+    }
+}
+BENCHMARK(BM_ParseShader)->DenseRange(0, 3);
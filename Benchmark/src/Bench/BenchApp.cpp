@@ -0,0 +1,25 @@
+#include "Bench/BenchApp.h"
+
+/**
+ * Generate a benchmark application.
+ *
+ * @param config The parameters of the run.
+ */
+BenchApp::BenchApp(const BenchConfig& config)
+    : Application("Renderer Benchmark", config.Width, config.Height, config.Visible)
+{
+    // Measure the rendering time instead of the refresh rate of the monitor
+    GetWindow().SetVerticalSync(false);
+    
+    // Push the benchmark layer to the layer stack
+    m_Bench = std::make_shared<BenchLayer>(config);
+    PushLayer(m_Bench);
+}
+
+/**
+ * Delete this application.
+ */
+BenchApp::~BenchApp()
+{
+    PopLayer(m_Bench);
+}
@@ -0,0 +1,115 @@
+#include "Bench/BenchConfig.h"
+
+#include <iostream>
+
+/**
+ * Define the benchmark parameters from the command line arguments.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments.
+ *
+ * @return `true` if the arguments are valid.
+ */
+bool BenchConfig::Parse(int argc, char** argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        
+        // Flags without value
+        if (arg == "--help" || arg == "-h")
+            return false;
+        if (arg == "--visible")
+        {
+            Visible = true;
+            continue;
+        }
+        if (arg == "--culling")
+        {
+            Culling = true;
+            continue;
+        }
+        
+        // Options with a value
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+        std::string value = argv[++i];
+        
+        try
+        {
+            if (arg == "--cubes")
+                Cubes = std::stoul(value);
+            else if (arg == "--spheres")
+                Spheres = std::stoul(value);
+            else if (arg == "--lights")
+                Lights = std::stoul(value);
+            else if (arg == "--materials")
+                Materials = std::max(1ul, std::stoul(value));
+            else if (arg == "--model")
+                Model = value;
+            else if (arg == "--warmup")
+                WarmupFrames = std::stoul(value);
+            else if (arg == "--frames")
+                Frames = std::max(1ul, std::stoul(value));
+            else if (arg == "--width")
+                Width = std::stoul(value);
+            else if (arg == "--height")
+                Height = std::stoul(value);
+            else if (arg == "--shadow-size")
+                ShadowMapSize = std::stoul(value);
+            else if (arg == "--gpu-budget")
+                GPUBudget = std::stof(value);
+            else if (arg == "--output")
+                Output = value;
+            else if (arg == "--baseline")
+                Baseline = value;
+            else if (arg == "--threshold")
+                Threshold = std::stof(value);
+            else
+            {
+                std::cerr << "Unknown argument " << arg << std::endl;
+                return false;
+            }
+        }
+        catch (const std::exception&)
+        {
+            std::cerr << "Invalid value " << value << " for " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Print the command line arguments of the benchmark.
+ */
+void BenchConfig::PrintUsage()
+{
+    std::cout <<
+        "Usage: RendererBench [options]\n"
+        "\n"
+        "Scene:\n"
+        "  --cubes N          Number of cubes (default 100)\n"
+        "  --spheres N        Number of spheres (default 100)\n"
+        "  --lights M         Number of positional lights with shadows (default 2)\n"
+        "  --materials K      Number of materials (default 8)\n"
+        "  --model PATH       Model loaded with Assimp (optional)\n"
+        "  --culling          Cull the shadow casters on the GPU\n"
+        "\n"
+        "Run:\n"
+        "  --warmup N         Frames rendered before measuring (default 100)\n"
+        "  --frames N         Frames measured (default 1000)\n"
+        "  --width W          Width of the rendered image (default 1280)\n"
+        "  --height H         Height of the rendered image (default 720)\n"
+        "  --shadow-size S    Size of the shadow maps (default 1024)\n"
+        "  --gpu-budget MS    Scale the rendered image to keep the GPU time under MS\n"
+        "  --visible          Show the window while rendering\n"
+        "\n"
+        "Results:\n"
+        "  --output PATH      Results file (default bench/results.json)\n"
+        "  --baseline PATH    Results of a previous run to compare with\n"
+        "  --threshold T      Relative increase reported as a regression (default 0.1)\n";
+}
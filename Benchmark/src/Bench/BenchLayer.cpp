@@ -0,0 +1,247 @@
+#include "Bench/BenchLayer.h"
+
+#include "Bench/BenchReport.h"
+
+#include <glm/gtc/constants.hpp>
+
+/// Maximum number of light casters supported by the shading shaders (`MAX_NUMBER_LIGHTS`).
+constexpr unsigned int g_MaxLights = 4;
+/// Distance between two objects of the grid.
+constexpr float g_GridSpacing = 3.0f;
+
+/**
+ * Define a layer for a benchmark run.
+ *
+ * @param config The parameters of the run.
+ */
+BenchLayer::BenchLayer(const BenchConfig& config)
+    : Layer("Benchmark Layer"), m_Config(config),
+      m_Scene(std::make_unique<Scene>(config.Width, config.Height))
+{}
+
+/**
+ * Attach (add) the benchmark layer to the rendering engine.
+ */
+void BenchLayer::OnAttach()
+{
+    // The history has to contain all the measured frames
+    if (m_Config.Frames > FrameStatistics::Capacity / 2)
+    {
+        CORE_WARN("Measuring {0} frames instead of {1}", FrameStatistics::Capacity / 2, m_Config.Frames);
+        m_Config.Frames = FrameStatistics::Capacity / 2;
+    }
+    
+    DefineLights();
+    DefineMaterials();
+    DefineSceneGeometry();
+    DefineRenderPasses();
+    
+    // Control the render scale from the GPU times (if a budget is defined)
+    if (m_Config.GPUBudget > 0.0f)
+    {
+        m_Scene->GetViewport()->GetDynamicResolution().SetBudget(m_Config.GPUBudget);
+        m_Scene->GetViewport()->SetDynamicResolution(true);
+    }
+    
+    CORE_INFO("Benchmark scene: {0} objects, {1} lights, {2} materials", m_Objects.size(),
+              m_Config.Lights, m_Materials.size());
+}
+
+/**
+ * Render the benchmark scene.
+ *
+ * @param deltaTime Times passed since the last update.
+ */
+void BenchLayer::OnUpdate(Timestep ts)
+{
+    // Reset rendering statistics
+    Renderer::ResetStats();
+    
+    m_Scene->Draw();
+    
+    if (m_Frame == m_Config.WarmupFrames)
+        m_FirstFrame = FrameStatistics::GetFrameIndex();
+    
+    // Wait a few more frames for the GPU times of the last measured frames
+    if (m_Frame == m_Config.WarmupFrames + m_Config.Frames + 8)
+        Finish();
+    
+    m_Frame++;
+}
+
+/**
+ * Define the positional lights (on a circle above the scene, pointing to its center).
+ */
+void BenchLayer::DefineLights()
+{
+    if (m_Config.Lights > g_MaxLights)
+    {
+        CORE_WARN("The shaders support up to {0} lights, using {0} instead of {1}", g_MaxLights,
+                  m_Config.Lights);
+        m_Config.Lights = g_MaxLights;
+    }
+    
+    for (unsigned int i = 0; i < m_Config.Lights; i++)
+    {
+        float angle = glm::two_pi<float>() * (float)i / (float)std::max(1u, m_Config.Lights);
+        glm::vec3 position(12.0f * std::cos(angle), 15.0f, 12.0f * std::sin(angle));
+        
+        auto light = std::make_shared<PositionalLight>(m_Config.ShadowMapSize, m_Config.ShadowMapSize,
+                                                       glm::vec3(1.0f), position);
+        light->SetDiffuseStrength(0.6f / (float)m_Config.Lights);
+        light->SetSpecularStrength(0.4f / (float)m_Config.Lights);
+        m_Scene->AddLight("Light-" + std::to_string(i), light);
+    }
+}
+
+/**
+ * Defines the materials assigned to the objects (same shader, different colors).
+ */
+void BenchLayer::DefineMaterials()
+{
+    auto& library = Renderer::GetMaterialLibrary();
+    
+    for (unsigned int i = 0; i < m_Config.Materials; i++)
+    {
+        // Spread the colors over the hue circle
+        float hue = (float)i / (float)m_Config.Materials;
+        glm::vec3 color = 0.5f + 0.4f * glm::cos(glm::two_pi<float>() *
+                                                 (hue + glm::vec3(0.0f, 1.0f / 3.0f, 2.0f / 3.0f)));
+        
+        std::string name = "Bench-" + std::to_string(i);
+        auto material = library.Create<PhongColorMaterial>(name,
+            "Resources/shaders/phong/PhongColorShadow.glsl");
+        material->SetAmbientColor(color);
+        material->SetDiffuseColor(color);
+        material->SetSpecularColor(glm::vec3(1.0f));
+        material->SetShininess(32.0f);
+        m_Materials.push_back(name);
+    }
+}
+
+/**
+ * Defines the scene geometry (a grid of cubes and spheres over a plane).
+ */
+void BenchLayer::DefineSceneGeometry()
+{
+    unsigned int count = m_Config.Cubes + m_Config.Spheres;
+    unsigned int columns = (unsigned int)std::ceil(std::sqrt((float)std::max(1u, count)));
+    float extent = g_GridSpacing * (float)columns;
+    
+    for (unsigned int i = 0; i < count; i++)
+    {
+        std::shared_ptr<BaseModel> model;
+        if (i < m_Config.Cubes)
+            model = utils::Geometry::ModelCube<GeoVertexData<glm::vec4, glm::vec3>>();
+        else
+            model = utils::Geometry::ModelSphere<GeoVertexData<glm::vec4, glm::vec3>>();
+        
+        float x = ((float)(i % columns) + 0.5f) * g_GridSpacing - 0.5f * extent;
+        float z = ((float)(i / columns) + 0.5f) * g_GridSpacing - 0.5f * extent;
+        model->SetPosition(glm::vec3(x, 0.0f, z));
+        
+        std::string name = "Object-" + std::to_string(i);
+        m_Scene->AddModel(name, model);
+        m_Objects.push_back(name);
+    }
+    
+    // Define the optional loaded model (using its own materials)
+    if (!m_Config.Model.empty())
+    {
+        auto model = std::make_shared<AssimpModel>(m_Config.Model);
+        model->SetPosition(glm::vec3(0.0f, 2.0f, 0.0f));
+        m_Scene->AddModel("Model", model);
+    }
+    
+    auto plane = utils::Geometry::ModelPlane<GeoVertexData<glm::vec4, glm::vec3>>();
+    plane->SetPosition(glm::vec3(0.0f, -1.0f, 0.0f));
+    plane->SetScale(glm::vec3(extent + g_GridSpacing));
+    plane->SetRotation(glm::vec3(-90.0f, 0.0f, 0.0f));
+    m_Scene->AddModel("Plane", plane);
+    
+    // Look at the whole grid
+    auto& camera = m_Scene->GetCamera();
+    camera->SetPosition(glm::vec3(0.0f, 0.6f * extent + 5.0f, 0.8f * extent + 5.0f));
+    camera->SetTarget(glm::vec3(0.0f));
+    camera->SetFarPlane(4.0f * extent + 50.0f);
+}
+
+/**
+ * Defines the rendering passes (one shadow pass per light, the scene and the viewport).
+ */
+void BenchLayer::DefineRenderPasses()
+{
+    auto& library = m_Scene->GetRenderPasses();
+    
+    // Models of the shadow and scene passes
+    std::unordered_multimap<std::string, std::string> depthModels, sceneModels;
+    for (unsigned int i = 0; i < m_Objects.size(); i++)
+    {
+        depthModels.insert({ m_Objects[i], "Depth" });
+        sceneModels.insert({ m_Objects[i], m_Materials[i % m_Materials.size()] });
+    }
+    depthModels.insert({ "Plane", "Depth" });
+    sceneModels.insert({ "Plane", m_Materials[0] });
+    
+    if (!m_Config.Model.empty())
+    {
+        depthModels.insert({ "Model", "Depth" });
+        sceneModels.insert({ "Model", "" });
+    }
+    sceneModels.insert({ "Light", "" });
+    
+    // First passes: shadows
+    //--------------------------------
+    for (auto& pair : m_Scene->GetLightSouces())
+    {
+        auto light = std::dynamic_pointer_cast<Light>(pair.second);
+        if (!light)
+            continue;
+        
+        RenderPassSpecification shadowPassSpec;
+        shadowPassSpec.Camera = light->GetShadowCamera();
+        shadowPassSpec.Framebuffer = light->GetFramebuffer();
+        shadowPassSpec.Models = depthModels;
+        if (m_Config.Culling)
+            shadowPassSpec.Culling = std::make_shared<GPUCulling>();
+        shadowPassSpec.PreRenderCode = []() { Renderer::SetFaceCulling(FaceCulling::Front); };
+        shadowPassSpec.PostRenderCode = []() { Renderer::SetFaceCulling(FaceCulling::Back); };
+        
+        library.Add("Shadow-" + pair.first, shadowPassSpec);
+    }
+    
+    // Second pass: scene
+    //--------------------------------
+    RenderPassSpecification scenePassSpec;
+    scenePassSpec.Camera = m_Scene->GetCamera();
+    scenePassSpec.Framebuffer = m_Scene->GetViewport()->GetFramebuffer();
+    scenePassSpec.Models = sceneModels;
+    scenePassSpec.Color = glm::vec4(0.93f, 0.93f, 0.93f, 1.0f);
+    library.Add("Scene", scenePassSpec);
+    
+    RenderPassSpecification screenPassSpec;
+    screenPassSpec.Models = { { "Viewport", "Viewport" } };
+    screenPassSpec.Size = { m_Scene->GetViewportWidth(), m_Scene->GetViewportHeight() };
+    library.Add("Viewport", screenPassSpec);
+}
+
+/**
+ * Collect the results, compare them with the baseline and close the application.
+ */
+void BenchLayer::Finish()
+{
+    BenchReport report(m_Config);
+    report.Collect(m_FirstFrame, m_Config.Frames);
+    report.Write(m_Config.Output);
+    
+    for (auto& metric : report.GetMetrics())
+        CORE_INFO("{0}: {1:.3f}", metric.Name, metric.Value);
+    if (m_Config.GPUBudget > 0.0f)
+        CORE_INFO("render_scale: {0:.3f}", m_Scene->GetViewport()->GetRenderScale());
+    
+    // A baseline that cannot be read fails the run (instead of passing it without comparison)
+    if (!m_Config.Baseline.empty())
+        m_Failed = !report.Compare(m_Config.Baseline, m_Config.Threshold, m_Regressions);
+    
+    Application::Get().Close();
+}
@@ -0,0 +1,229 @@
+#include "Bench/BenchReport.h"
+
+#include "Engine.h"
+
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <unordered_map>
+
+#if defined(_WIN32)
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+namespace
+{
+/**
+ * Get the value of a percentile from a list of values.
+ *
+ * @param values The values (reordered by the function).
+ * @param percentile The percentile (between 0 and 1).
+ *
+ * @return The value of the percentile (zero if the list is empty).
+ */
+double Percentile(std::vector<float>& values, float percentile)
+{
+    if (values.empty())
+        return 0.0;
+    
+    size_t n = (size_t)(percentile * (float)(values.size() - 1) + 0.5f);
+    std::nth_element(values.begin(), values.begin() + n, values.end());
+    return values[n];
+}
+
+/**
+ * Get the largest amount of physical memory used by the process.
+ *
+ * @return The peak resident memory (in megabytes).
+ */
+double GetPeakMemory()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0.0;
+    return (double)counters.PeakWorkingSetSize / (1024.0 * 1024.0);
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0.0;
+    #if defined(__APPLE__)
+        return (double)usage.ru_maxrss / (1024.0 * 1024.0);     // bytes
+    #else
+        return (double)usage.ru_maxrss / 1024.0;                // kilobytes
+    #endif
+#endif
+}
+
+/**
+ * Read the metrics of a results file.
+ *
+ * @param filePath The path of the results file (written by `BenchReport::Write`).
+ *
+ * @return The value of each metric.
+ */
+std::unordered_map<std::string, double> ReadMetrics(const std::filesystem::path& filePath)
+{
+    std::unordered_map<std::string, double> metrics;
+    
+    std::ifstream file(filePath);
+    if (!file.is_open())
+        return metrics;
+    
+    std::stringstream stream;
+    stream << file.rdbuf();
+    std::string content = stream.str();
+    
+    // Only the "metrics" object is read, its values are plain numbers
+    size_t begin = content.find("\"metrics\"");
+    if (begin == std::string::npos)
+        return metrics;
+    size_t end = content.find('}', begin);
+    std::string section = content.substr(begin, end - begin);
+    
+    std::regex pair("\"([A-Za-z0-9_]+)\"\\s*:\\s*(-?[0-9.eE+-]+)");
+    for (auto it = std::sregex_iterator(section.begin(), section.end(), pair);
+         it != std::sregex_iterator(); ++it)
+        metrics[(*it)[1]] = std::stod((*it)[2]);
+    
+    return metrics;
+}
+} // namespace
+
+/**
+ * Summarize the measurements of a range of frames.
+ *
+ * @param firstFrame The index of the first measured frame.
+ * @param frames The number of measured frames.
+ */
+void BenchReport::Collect(uint64_t firstFrame, unsigned int frames)
+{
+    std::vector<float> frameTimes, cpuTimes, gpuTimes;
+    double drawCalls = 0.0, triangles = 0.0;
+    
+    for (unsigned int i = 0; i < FrameStatistics::GetSize(); i++)
+    {
+        const FrameRecord& record = FrameStatistics::GetRecord(i);
+        if (record.Index < firstFrame || record.Index >= firstFrame + frames)
+            continue;
+        
+        frameTimes.push_back(record.FrameTime);
+        cpuTimes.push_back(record.CPUTime);
+        if (record.GPUTime >= 0.0f)
+            gpuTimes.push_back(record.GPUTime);
+        drawCalls += record.DrawCalls;
+        triangles += record.Triangles;
+    }
+    
+    unsigned int measured = (unsigned int)frameTimes.size();
+    double average = 0.0;
+    for (float time : frameTimes)
+        average += time;
+    average /= std::max(1u, measured);
+    
+    m_Metrics.clear();
+    m_Metrics.push_back({ "frames", (double)measured, false });
+    m_Metrics.push_back({ "fps", average > 0.0 ? 1000.0 / average : 0.0, false });
+    m_Metrics.push_back({ "frame_ms_avg", average });
+    m_Metrics.push_back({ "frame_ms_p50", Percentile(frameTimes, 0.50f) });
+    m_Metrics.push_back({ "frame_ms_p95", Percentile(frameTimes, 0.95f) });
+    m_Metrics.push_back({ "frame_ms_p99", Percentile(frameTimes, 0.99f) });
+    m_Metrics.push_back({ "cpu_ms_p50", Percentile(cpuTimes, 0.50f) });
+    m_Metrics.push_back({ "cpu_ms_p95", Percentile(cpuTimes, 0.95f) });
+    m_Metrics.push_back({ "cpu_ms_p99", Percentile(cpuTimes, 0.99f) });
+    m_Metrics.push_back({ "gpu_frames", (double)gpuTimes.size(), false });
+    m_Metrics.push_back({ "gpu_ms_p50", Percentile(gpuTimes, 0.50f) });
+    m_Metrics.push_back({ "gpu_ms_p95", Percentile(gpuTimes, 0.95f) });
+    m_Metrics.push_back({ "gpu_ms_p99", Percentile(gpuTimes, 0.99f) });
+    m_Metrics.push_back({ "draw_calls", drawCalls / std::max(1u, measured) });
+    m_Metrics.push_back({ "triangles", triangles / std::max(1u, measured) });
+    m_Metrics.push_back({ "peak_memory_mb", GetPeakMemory() });
+}
+
+/**
+ * Write the parameters and the results of the run as JSON.
+ *
+ * @param filePath The path of the results file.
+ *
+ * @return `true` if the file has been written.
+ */
+bool BenchReport::Write(const std::filesystem::path& filePath) const
+{
+    if (filePath.has_parent_path())
+        std::filesystem::create_directories(filePath.parent_path());
+    
+    std::ofstream file(filePath);
+    if (!file.is_open())
+    {
+        CORE_WARN("Failed to write the benchmark results into {0}", filePath.string());
+        return false;
+    }
+    
+    file << "{\n";
+    file << "  \"config\": {\"cubes\": " << m_Config.Cubes << ", \"spheres\": " << m_Config.Spheres
+         << ", \"lights\": " << m_Config.Lights << ", \"materials\": " << m_Config.Materials
+         << ", \"model\": \"" << m_Config.Model.generic_string() << "\", \"culling\": "
+         << (m_Config.Culling ? "true" : "false") << ", \"warmup\": " << m_Config.WarmupFrames
+         << ", \"frames\": " << m_Config.Frames << ", \"width\": " << m_Config.Width
+         << ", \"height\": " << m_Config.Height << ", \"shadow_size\": " << m_Config.ShadowMapSize
+         << "},\n";
+    
+    file << "  \"renderer\": {\"vendor\": \"" << (const char*)glGetString(GL_VENDOR)
+         << "\", \"device\": \"" << (const char*)glGetString(GL_RENDERER)
+         << "\", \"version\": \"" << (const char*)glGetString(GL_VERSION) << "\"},\n";
+    
+    file << "  \"metrics\": {\n";
+    for (unsigned int i = 0; i < m_Metrics.size(); i++)
+        file << "    \"" << m_Metrics[i].Name << "\": " << m_Metrics[i].Value
+             << (i + 1 < m_Metrics.size() ? "," : "") << "\n";
+    file << "  }\n}\n";
+    
+    CORE_INFO("Benchmark results written into {0}", filePath.string());
+    return true;
+}
+
+/**
+ * Compare the results with the ones of a previous run.
+ *
+ * @param baselinePath The path of the baseline results file.
+ * @param threshold The relative increase of a metric reported as a regression.
+ * @param regressions The number of regressions.
+ *
+ * @return `true` if the baseline could be read.
+ */
+bool BenchReport::Compare(const std::filesystem::path& baselinePath, float threshold,
+                          unsigned int& regressions) const
+{
+    regressions = 0;
+    auto baseline = ReadMetrics(baselinePath);
+    if (baseline.empty())
+    {
+        CORE_ERROR("Baseline {0} could not be read", baselinePath.string());
+        return false;
+    }
+    
+    for (auto& metric : m_Metrics)
+    {
+        auto it = baseline.find(metric.Name);
+        if (!metric.Compared || it == baseline.end() || it->second <= 0.0)
+            continue;
+        
+        double change = (metric.Value - it->second) / it->second;
+        if (change > threshold)
+        {
+            CORE_ERROR("Regression in {0}: {1:.3f} -> {2:.3f} (+{3:.1f}%)", metric.Name, it->second,
+                       metric.Value, change * 100.0);
+            regressions++;
+        }
+        else
+            CORE_INFO("{0}: {1:.3f} -> {2:.3f} ({3:+.1f}%)", metric.Name, it->second,
+                      metric.Value, change * 100.0);
+    }
+    
+    if (regressions == 0)
+        CORE_INFO("No regression above {0:.1f}% compared to {1}", threshold * 100.0f, baselinePath.string());
+    return true;
+}
@@ -0,0 +1,42 @@
+#ifdef __APPLE__
+    #define GL_SILENCE_DEPRECATION
+#endif
+
+#include "Engine.h"
+#include "Bench/BenchApp.h"
+
+/**
+ * Entry point of the benchmark.
+ *
+ * The `main` function parses the benchmark parameters, renders the stress scene for the requested
+ * number of frames and writes the results.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments (see `BenchConfig::PrintUsage`).
+ *
+ * @return Zero if the run succeeded without regressions, one otherwise (including a baseline that
+ * cannot be read).
+ */
+int main(int argc, char** argv)
+{
+    BenchConfig config;
+    if (!config.Parse(argc, argv))
+    {
+        BenchConfig::PrintUsage();
+        return 1;
+    }
+    
+    // Initialize the logging system
+    Log::Init();
+    
+    // Create the application
+    auto application = std::make_unique<BenchApp>(config);
+    application->Run();
+    bool failed = application->HasFailed() || application->GetRegressions() > 0;
+    
+    // Write the remaining messages once the application is destroyed
+    application.reset();
+    Log::Shutdown();
+    
+    return failed ? 1 : 0;
+}
@@ -93,4 +93,21 @@ source_group("include/backends" FILES ${imgui_backend_headers})
 source_group("src" FILES ${imgui_sources})
 source_group("src/backends" FILES ${imgui_backends_sources})
 
-add_library(imgui::imgui ALIAS imgui)
\ No newline at end of file
+add_library(imgui::imgui ALIAS imgui)
+
+## GOOGLE BENCHMARK
+if (RENDERER_BUILD_BENCHMARKS)
+    find_package(benchmark QUIET)
+    if (NOT benchmark_FOUND)
+        include(FetchContent)
+        set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+        set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+        set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+        FetchContent_Declare(
+            benchmark
+            GIT_REPOSITORY https://github.com/google/benchmark.git
+            GIT_TAG v1.8.3
+        )
+        FetchContent_MakeAvailable(benchmark)
+    endif()
+endif()
@@ -23,13 +23,14 @@ public:
     // Constructor(s)/Destructor
     // ----------------------------------------
     Application(const std::string &name = "Basic Renderer", const int width = 800,
-                const int height = 600);
-    /// @brief Delete the application.
-    virtual ~Application() = default;
+                const int height = 600, const bool visible = true);
+    virtual ~Application();
     
     // Run
     // ----------------------------------------
     void Run();
+    /// @brief Stop the application at the end of the current frame.
+    void Close() { m_Running = false; }
     
     // Events handler(s)
     // ----------------------------------------
@@ -26,6 +26,7 @@
             if (!(x))                                                           \
             {                                                                   \
                 CORE_ERROR("{0}", __VA_ARGS__);                                 \
+                ::Log::Shutdown(); /* write the queued messages first */        \
                 DEBUGBREAK();                                                   \
             }                                                                   \
         } while (false)
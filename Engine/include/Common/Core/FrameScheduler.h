@@ -0,0 +1,41 @@
+#pragma once
+
+/**
+ * Decides which frames have to be rendered (on-demand rendering).
+ *
+ * By default every frame is fully rendered. In on-demand mode, the offscreen render passes (e.g.,
+ * shadow maps, the viewport framebuffer) are only rendered again when something visible changed:
+ * the mutations of the scene, cameras, lights, models and materials request a redraw. The other
+ * frames only present the last rendered image (the passes drawing to the screen and the GUI).
+ *
+ * When there is nothing to redraw or present, the application waits for the window events (with a
+ * timeout) instead of running its loop, so an idle viewer does not keep the CPU and GPU busy.
+ * Every input event presents a few frames to let the GUI react to it, and the requests from the
+ * other threads wake the application up (see `SetWakeCallback`).
+ */
+class FrameScheduler
+{
+public:
+    // Frame scheduling
+    // ----------------------------------------
+    static void BeginFrame();
+    static bool ShouldRedraw();
+    static bool IsIdle();
+    
+    // Requests
+    // ----------------------------------------
+    static void RequestRedraw();
+    static void RequestPresent(unsigned int frames = 2);
+    static void Wake();
+    
+    // Getter(s)
+    // ----------------------------------------
+    static bool IsOnDemand();
+    static double GetIdleTimeout();
+    
+    // Setter(s)
+    // ----------------------------------------
+    static void SetOnDemand(bool enabled);
+    static void SetIdleTimeout(double seconds);
+    static void SetWakeCallback(const std::function<void()>& callback);
+};
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <atomic>
+
+struct Job;
+
+/**
+ * Enumeration of the threads where a job can be executed.
+ */
+enum class JobAffinity
+{
+    Any,        ///< The job can be executed by any thread.
+    MainThread, ///< The job must be executed by the main thread (e.g., it uses the GL context).
+};
+
+/**
+ * Counts the number of unfinished jobs of a group.
+ *
+ * The `JobCounter` class is incremented when a job is submitted with it and decremented when the
+ * job finishes. It can be waited on (`JobSystem::Wait`) or used as a dependency of other jobs,
+ * which are only scheduled once the counter reaches zero. The counter must outlive the jobs that
+ * reference it.
+ *
+ * Copying or moving `JobCounter` objects is disabled to ensure single ownership and prevent
+ * unintended duplication of the counter.
+ */
+class JobCounter
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Define a counter without pending jobs.
+    JobCounter() = default;
+    /// @brief Delete the counter.
+    ~JobCounter() = default;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Check if all the jobs of the counter have finished.
+    /// @return `true` if there are no pending jobs.
+    bool IsDone() const { return m_Count.load(std::memory_order_acquire) == 0; }
+    /// @brief Get the number of pending jobs.
+    /// @return The number of jobs.
+    int GetValue() const { return m_Count.load(std::memory_order_acquire); }
+    
+    // Counter variables
+    // ----------------------------------------
+private:
+    ///< Number of pending jobs.
+    std::atomic<int> m_Count = 0;
+    ///< Jobs waiting for the counter to reach zero.
+    std::vector<Job> m_Waiting;
+    ///< Protection of the waiting jobs.
+    std::mutex m_Mutex;
+    
+    // Friend classes
+    // ----------------------------------------
+public:
+    friend class JobSystem;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    JobCounter(const JobCounter&) = delete;
+    JobCounter(JobCounter&&) = delete;
+    
+    JobCounter& operator=(const JobCounter&) = delete;
+    JobCounter& operator=(JobCounter&&) = delete;
+};
+
+/**
+ * Represents a unit of work to be executed by the job system.
+ */
+struct Job
+{
+    ///< Work to be executed.
+    std::function<void()> Function;
+    ///< Counter decremented when the job finishes (optional).
+    JobCounter* Counter = nullptr;
+    ///< Threads allowed to execute the job.
+    JobAffinity Affinity = JobAffinity::Any;
+    ///< Name of the job (used for instrumentation).
+    const char* Name = "Job";
+};
+
+/**
+ * Callbacks used to instrument the execution of the jobs (e.g., by a profiler).
+ */
+struct JobHooks
+{
+    ///< Called before a job is executed, with the job name and the index of the thread.
+    std::function<void(const char*, unsigned int)> OnJobBegin;
+    ///< Called after a job is executed, with the job name and the index of the thread.
+    std::function<void(const char*, unsigned int)> OnJobEnd;
+};
+
+/**
+ * Execution statistics of the job system.
+ */
+struct JobStatistics
+{
+    unsigned int executed = 0;  ///< Number of jobs executed.
+    unsigned int stolen = 0;    ///< Number of jobs stolen from the queue of another thread.
+};
+
+/**
+ * Task scheduler distributing jobs over a pool of worker threads.
+ *
+ * The `JobSystem` class owns one worker thread per hardware thread (minus the main thread). Each
+ * thread, including the main one, has its own double-ended queue: a thread pushes and pops its jobs
+ * at the back, and idle threads steal jobs from the front of the other queues. Jobs can be grouped
+ * with a `JobCounter`, depend on another counter, and be restricted to the main thread (for work
+ * that requires the GL context), in which case they are executed by `ExecuteMainThreadJobs` or while
+ * the main thread waits.
+ *
+ * If the job system has not been initialized, jobs are executed immediately on the calling thread.
+ */
+class JobSystem
+{
+public:
+    // Initialization
+    // ----------------------------------------
+    static void Init(unsigned int threadCount = 0);
+    static void Shutdown();
+    
+    // Jobs
+    // ----------------------------------------
+    static void Run(const std::function<void()>& function, JobCounter* counter = nullptr,
+                    JobCounter* dependency = nullptr, JobAffinity affinity = JobAffinity::Any,
+                    const char* name = "Job");
+    static void ParallelFor(unsigned int count, unsigned int grainSize,
+                            const std::function<void(unsigned int, unsigned int)>& function,
+                            JobCounter* counter = nullptr, const char* name = "ParallelFor");
+    static void Wait(JobCounter& counter);
+    static unsigned int ExecuteMainThreadJobs();
+    
+    // Getter(s)
+    // ----------------------------------------
+    static bool IsInitialized();
+    static bool IsMainThread();
+    static unsigned int GetThreadCount();
+    static unsigned int GetThreadIndex();
+    static JobStatistics GetStats();
+    static void ResetStats();
+    
+    // Setter(s)
+    // ----------------------------------------
+    static void SetHooks(const JobHooks& hooks);
+
+private:
+    // Scheduling
+    // ----------------------------------------
+    static void Schedule(Job& job);
+    static void Complete(Job& job);
+    static bool ExecuteNext();
+    static void Execute(Job& job);
+    static void WorkerLoop(unsigned int index);
+};
@@ -1,5 +1,11 @@
 #pragma once
 
+/// Stable identifier of an object inside a library (valid for the lifetime of the library).
+using LibraryHandle = unsigned int;
+
+/// Identifier returned when an object is not found in a library.
+constexpr LibraryHandle InvalidLibraryHandle = ~0u;
+
 /**
  * A library for managing objects.
  *
@@ -7,6 +13,12 @@
  * for the existence of objects within the library. Each object is associated with
  * a unique name.
  *
+ * The objects are stored in the order they were added, and the names are indexed with a flat
+ * open-addressing hash table. Looking up a name hashes it once and does not allocate any memory.
+ * `Add` returns a stable handle that can be used later to retrieve the object without any lookup
+ * at all. The objects are kept in a deque, so the references returned by `Get` remain valid when
+ * more objects are added (only the iterators are invalidated).
+ *
  * @tparam ObjectType The type of object to be managed by the library.
  * @tparam OwnershipType The type of ownership for the objects (either direct or shared pointer).
  */
@@ -26,14 +38,22 @@ public:
     /// @brief Adds an object to the library.
     /// @param name The name to associate with the object.
     /// @param object The object to add.
+    /// @return The handle of the object.
     /// @note If an object with the same name already exists in the library, an assertion failure
-    /// will occur.
-    virtual void Add(const std::string& name,
-                     const ObjectType& object)
+    /// will occur (the existing object is replaced when assertions are disabled).
+    virtual LibraryHandle Add(const std::string& name,
+                              const ObjectType& object)
     {
-        std::string message = GetName() + " already exists!";
-        CORE_ASSERT(!Exists(name), message);
-        m_Objects[name] = object;
+        size_t hash = Hash(name);
+        LibraryHandle handle = Find(name, hash);
+        CORE_ASSERT(handle == InvalidLibraryHandle, GetName() + " " + name + " already exists!");
+        
+        if (handle != InvalidLibraryHandle)
+        {
+            m_Objects[handle].second = object;
+            return handle;
+        }
+        return Emplace(name, hash, object);
     }
     
     // Getter(s)
@@ -42,73 +62,351 @@ public:
     /// @param name The name of the object to retrieve.
     /// @return The retrieved object.
     /// @note If the object with the specified name does not exist in the library, an assertion
-    /// failure will occur.
-    ObjectType& Get(const std::string& name)
+    /// failure will occur (an empty object is added when assertions are disabled).
+    ObjectType& Get(std::string_view name)
+    {
+        size_t hash = Hash(name);
+        LibraryHandle handle = Find(name, hash);
+        CORE_ASSERT(handle != InvalidLibraryHandle, GetName() + " " + std::string(name) + " not found!");
+        
+        if (handle == InvalidLibraryHandle)
+            handle = Emplace(std::string(name), hash, ObjectType());
+        return m_Objects[handle].second;
+    }
+    /// @brief Retrieves an object from the library by its handle.
+    /// @param handle The handle returned when the object was added.
+    /// @return The retrieved object.
+    ObjectType& Get(const LibraryHandle handle)
     {
-        std::string message = GetName() + " not found!";
-        CORE_ASSERT(Exists(name), message);
-        return m_Objects[name];
+        CORE_ASSERT(handle < m_Objects.size(), GetName() + " handle is not valid!");
+        return m_Objects[handle].second;
     }
+    /// @brief Get the handle of an object.
+    /// @param name The name of the object.
+    /// @return The handle, or `InvalidLibraryHandle` if the object does not exist.
+    LibraryHandle GetHandle(std::string_view name) const { return Find(name, Hash(name)); }
+    /// @brief Get the name of an object.
+    /// @param handle The handle returned when the object was added.
+    /// @return The name of the object.
+    const std::string& GetKey(const LibraryHandle handle) const
+    {
+        CORE_ASSERT(handle < m_Objects.size(), GetName() + " handle is not valid!");
+        return m_Objects[handle].first;
+    }
+    
     /// @brief Updates the object with the specific name.
     /// @param name The name to associate with the object.
     /// @param object The object to add.
     /// @note If the object with the specified name does not exist in the library, an assertion
     /// failure will occur.
-    void Update(const std::string& name,
+    void Update(std::string_view name,
                 const ObjectType& object)
     {
-        std::string message = GetName() + " not found!";
-        CORE_ASSERT(Exists(name), message);
-        m_Objects[name] = object;
+        Get(name) = object;
+    }
+    /// @brief Updates the object with the specific handle.
+    /// @param handle The handle returned when the object was added.
+    /// @param object The object to add.
+    void Update(const LibraryHandle handle,
+                const ObjectType& object)
+    {
+        Get(handle) = object;
     }
     /// @brief Checks if an object with a given name exists in the library.
     /// @param name The name of the object to check for existence.
     /// @return True if an object with the specified name exists in the library, otherwise false.
-    bool Exists(const std::string& name) const
+    bool Exists(std::string_view name) const
     {
-        return m_Objects.find(name) != m_Objects.end();
+        return Find(name, Hash(name)) != InvalidLibraryHandle;
     }
+    /// @brief Get the number of objects in the library.
+    /// @return The number of objects.
+    unsigned int Size() const { return (unsigned int)m_Objects.size(); }
     
     // Iteration support
     // ----------------------------------------
     /// @brief Get the begin iterator for the library.
     /// @return Iterator pointing to the begin of the library.
-    typename std::unordered_map<std::string, ObjectType>::iterator begin()
+    typename std::deque<std::pair<std::string, ObjectType>>::iterator begin()
     {
         return m_Objects.begin();
     }
     /// @brief Get the end iterator for the library.
     /// @return Iterator pointing to the end of the library.
-    typename std::unordered_map<std::string, ObjectType>::iterator end()
+    typename std::deque<std::pair<std::string, ObjectType>>::iterator end()
     {
         return m_Objects.end();
     }
     /// @brief Get the begin iterator for the library (constant value).
     /// @return Iterator pointing to the begin of the library.
-    typename std::unordered_map<std::string, ObjectType>::const_iterator begin() const
+    typename std::deque<std::pair<std::string, ObjectType>>::const_iterator begin() const
     {
         return m_Objects.begin();
     }
     /// @brief Get the end iterator for the library (constant value).
     /// @return Iterator pointing to the end of the library.
-    typename std::unordered_map<std::string, ObjectType>::const_iterator end() const
+    typename std::deque<std::pair<std::string, ObjectType>>::const_iterator end() const
     {
         return m_Objects.end();
     }
-    
+
 protected:
+    // Remove
+    // ----------------------------------------
+    /// @brief Removes an object from the library.
+    /// @param name The name of the object to remove.
+    /// @return `true` if the object existed.
+    /// @note The objects added after it are moved one position back, so their handles are
+    /// invalidated (only the libraries that do not keep any handle can expose it).
+    bool Remove(std::string_view name)
+    {
+        LibraryHandle handle = Find(name, Hash(name));
+        if (handle == InvalidLibraryHandle)
+            return false;
+        
+        m_Objects.erase(m_Objects.begin() + handle);
+        Rehash(m_Slots.size());
+        return true;
+    }
+    
     // Getter(s)
     // ----------------------------------------
     /// @brief Get the name of the objects that are contained in the library.
     /// @return The name of the objects.
     const std::string& GetName() const { return m_ObjectsName; }
+
+private:
+    // Hash table
+    // ----------------------------------------
+    /// @brief Compute the hash of a name.
+    /// @param name The name.
+    /// @return The hash value.
+    static size_t Hash(std::string_view name) { return std::hash<std::string_view>()(name); }
+    
+    /// @brief Find the handle of an object in the hash table.
+    /// @param name The name of the object.
+    /// @param hash The hash of the name.
+    /// @return The handle, or `InvalidLibraryHandle` if the object does not exist.
+    LibraryHandle Find(std::string_view name, size_t hash) const
+    {
+        if (m_Slots.empty())
+            return InvalidLibraryHandle;
+        
+        size_t mask = m_Slots.size() - 1;
+        for (size_t i = hash & mask; ; i = (i + 1) & mask)
+        {
+            const Slot& slot = m_Slots[i];
+            if (slot.Handle == InvalidLibraryHandle)
+                return InvalidLibraryHandle;
+            if (slot.Hash == hash && m_Objects[slot.Handle].first == name)
+                return slot.Handle;
+        }
+    }
+    /// @brief Store a new object and index its name.
+    /// @param name The name of the object (not already in the library).
+    /// @param hash The hash of the name.
+    /// @param object The object.
+    /// @return The handle of the object.
+    LibraryHandle Emplace(const std::string& name, size_t hash, const ObjectType& object)
+    {
+        // Keep the table at most half full to have short probe sequences
+        if (2 * (m_Objects.size() + 1) > m_Slots.size())
+            Rehash(m_Slots.empty() ? 16 : 2 * m_Slots.size());
+        
+        LibraryHandle handle = (LibraryHandle)m_Objects.size();
+        m_Objects.emplace_back(name, object);
+        Insert(hash, handle);
+        return handle;
+    }
+    /// @brief Insert a handle into the hash table (the table must have free slots).
+    /// @param hash The hash of the object name.
+    /// @param handle The handle of the object.
+    void Insert(size_t hash, LibraryHandle handle)
+    {
+        size_t mask = m_Slots.size() - 1;
+        size_t i = hash & mask;
+        while (m_Slots[i].Handle != InvalidLibraryHandle)
+            i = (i + 1) & mask;
+        m_Slots[i] = { hash, handle };
+    }
+    /// @brief Resize the hash table and insert all the objects again.
+    /// @param size The new number of slots (power of two).
+    void Rehash(size_t size)
+    {
+        m_Slots.assign(size, Slot());
+        for (LibraryHandle handle = 0; handle < m_Objects.size(); handle++)
+            Insert(Hash(m_Objects[handle].first), handle);
+    }
+    
+    /**
+     * Represents an entry of the hash table.
+     */
+    struct Slot
+    {
+        size_t Hash = 0;                                ///< Hash of the object name.
+        LibraryHandle Handle = InvalidLibraryHandle;    ///< Handle of the object (or empty slot).
+    };
+    
+    // Library variables
+    // ----------------------------------------
+private:
+    ///< The objects (with their names) in the order they were added.
+    std::deque<std::pair<std::string, ObjectType>> m_Objects;
+    ///< Open-addressing hash table from the names to the objects.
+    std::vector<Slot> m_Slots;
+    
+    ///< The name of the objects contained in the library.
+    std::string m_ObjectsName;
+};
+
+/**
+ * A library for managing objects that can be accessed from multiple threads.
+ *
+ * The `ConcurrentLibrary` class is an opt-in variant of `Library` meant for assets that are
+ * registered by asynchronous loaders while the render thread reads them. The objects are
+ * distributed over several shards (by the hash of their names), each protected by its own
+ * reader-writer lock, so readers never block each other and writers only block the readers
+ * of one shard. Objects are returned by value, since a reference could be invalidated by a
+ * concurrent `Add`.
+ *
+ * @tparam ObjectType The type of object to be managed by the library.
+ * @tparam ShardCount The number of shards (power of two).
+ */
+template<typename ObjectType, unsigned int ShardCount = 16>
+class ConcurrentLibrary
+{
+    static_assert((ShardCount & (ShardCount - 1)) == 0, "The number of shards must be a power of two!");
+
+public:
+    // Constructor/Destructor
+    // ----------------------------------------
+    /// @brief Create a new library.
+    ConcurrentLibrary(const std::string& name = "Object") : m_ObjectsName(name)
+    {
+        for (auto& shard : m_Shards)
+            shard.Objects = std::make_unique<Library<ObjectType>>(name);
+    }
+    /// @brief Delete the library.
+    ~ConcurrentLibrary() = default;
+    
+    // Add
+    // ----------------------------------------
+    /// @brief Adds an object to the library.
+    /// @param name The name to associate with the object.
+    /// @param object The object to add.
+    /// @return The handle of the object.
+    LibraryHandle Add(const std::string& name, const ObjectType& object)
+    {
+        unsigned int index = GetShard(name);
+        Shard& shard = m_Shards[index];
+        
+        std::unique_lock lock(shard.Mutex);
+        LibraryHandle handle = shard.Objects->Add(name, object);
+        return handle * ShardCount + index;
+    }
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Retrieves a copy of an object from the library by its name.
+    /// @param name The name of the object to retrieve.
+    /// @return The retrieved object (an empty object if it does not exist).
+    ObjectType Get(std::string_view name) const
+    {
+        const Shard& shard = m_Shards[GetShard(name)];
+        
+        // Only read the shard (a missing object must not be added under a shared lock)
+        std::shared_lock lock(shard.Mutex);
+        LibraryHandle handle = shard.Objects->GetHandle(name);
+        CORE_ASSERT(handle != InvalidLibraryHandle, m_ObjectsName + " " + std::string(name) + " not found!");
+        
+        if (handle == InvalidLibraryHandle)
+            return ObjectType();
+        return shard.Objects->Get(handle);
+    }
+    /// @brief Retrieves a copy of an object from the library by its handle.
+    /// @param handle The handle returned when the object was added.
+    /// @return The retrieved object.
+    ObjectType Get(const LibraryHandle handle) const
+    {
+        const Shard& shard = m_Shards[handle % ShardCount];
+        
+        std::shared_lock lock(shard.Mutex);
+        return shard.Objects->Get(handle / ShardCount);
+    }
+    /// @brief Retrieves a copy of an object from the library, if it exists.
+    /// @param name The name of the object to retrieve.
+    /// @param object The retrieved object.
+    /// @return `true` if the object exists.
+    bool TryGet(std::string_view name, ObjectType& object) const
+    {
+        const Shard& shard = m_Shards[GetShard(name)];
+        
+        std::shared_lock lock(shard.Mutex);
+        LibraryHandle handle = shard.Objects->GetHandle(name);
+        if (handle == InvalidLibraryHandle)
+            return false;
+        
+        object = shard.Objects->Get(handle);
+        return true;
+    }
+    /// @brief Updates the object with the specific name.
+    /// @param name The name to associate with the object.
+    /// @param object The object to add.
+    void Update(std::string_view name, const ObjectType& object)
+    {
+        Shard& shard = m_Shards[GetShard(name)];
+        
+        std::unique_lock lock(shard.Mutex);
+        shard.Objects->Update(name, object);
+    }
+    /// @brief Checks if an object with a given name exists in the library.
+    /// @param name The name of the object to check for existence.
+    /// @return True if an object with the specified name exists in the library, otherwise false.
+    bool Exists(std::string_view name) const
+    {
+        const Shard& shard = m_Shards[GetShard(name)];
+        
+        std::shared_lock lock(shard.Mutex);
+        return shard.Objects->Exists(name);
+    }
+
+private:
+    // Shards
+    // ----------------------------------------
+    /// @brief Get the shard where an object is stored.
+    /// @param name The name of the object.
+    /// @return The index of the shard.
+    static unsigned int GetShard(std::string_view name)
+    {
+        // Use the high bits, the low ones select the slot inside the shard table
+        size_t hash = std::hash<std::string_view>()(name);
+        return (unsigned int)((hash >> (sizeof(size_t) * 4)) & (ShardCount - 1));
+    }
+    
+    /**
+     * Represents a subset of the objects protected by its own lock.
+     */
+    struct Shard
+    {
+        mutable std::shared_mutex Mutex;                ///< Lock of the shard.
+        std::unique_ptr<Library<ObjectType>> Objects;   ///< Objects of the shard.
+    };
     
     // Library variables
     // ----------------------------------------
 private:
-    ///< A map of object names to their corresponding objects.
-    std::unordered_map<std::string, ObjectType> m_Objects;
+    ///< Shards of the library.
+    std::array<Shard, ShardCount> m_Shards;
     
     ///< The name of the objects contained in the library.
     std::string m_ObjectsName;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    ConcurrentLibrary(const ConcurrentLibrary&) = delete;
+    ConcurrentLibrary(ConcurrentLibrary&&) = delete;
+    
+    ConcurrentLibrary& operator=(const ConcurrentLibrary&) = delete;
+    ConcurrentLibrary& operator=(ConcurrentLibrary&&) = delete;
 };
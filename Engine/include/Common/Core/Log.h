@@ -4,11 +4,22 @@
 #include <spdlog/fmt/ostr.h>
 #include <spdlog/pattern_formatter.h>
 
+#include <atomic>
+
+/// Lowest log level compiled into the engine (the macros of lower levels are removed).
+#ifndef CORE_LOG_LEVEL
+    #define CORE_LOG_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+
 /**
  * Logging manager used as a wraper for spdlog.
  *
  * The `Log` class provides a centralized logging manager that serves as a wrapper for the spdlog
  * library. It allows initializing the logging system and provides access to the logger instance.
+ *
+ * The core logger is asynchronous: the messages are formatted on the calling thread and pushed
+ * into a bounded queue, while a background thread writes them to the console. When the queue is
+ * full the oldest messages are dropped, so logging never blocks the rendering thread.
  */
 class Log
 {
@@ -16,6 +27,7 @@ public:
     // Initialization
     // ----------------------------------------
     static void Init();
+    static void Shutdown();
     
     // Getter(s)
     // ----------------------------------------
@@ -31,6 +43,11 @@ public:
 private:
     ///< Core logger
     static std::shared_ptr<spdlog::logger> s_CoreLogger;
+    
+    ///< Number of messages that can be queued before the oldest ones are dropped.
+    static constexpr size_t s_QueueSize = 8192;
+    ///< Interval at which the background thread flushes the console output.
+    static constexpr std::chrono::seconds s_FlushInterval = std::chrono::seconds(1);
 };
 
 /**
@@ -62,9 +79,57 @@ private:
 // --------------------------------------------
 // Definition of the logging macros.
 // --------------------------------------------
-#define CORE_TRACE(...)     ::Log::GetCoreLogger()->trace(__VA_ARGS__)
-#define CORE_DEBUG(...)     ::Log::GetCoreLogger()->debug(__VA_ARGS__)
-#define CORE_INFO(...)      ::Log::GetCoreLogger()->info(__VA_ARGS__)
-#define CORE_WARN(...)      ::Log::GetCoreLogger()->warn(__VA_ARGS__)
-#define CORE_ERROR(...)     ::Log::GetCoreLogger()->error(__VA_ARGS__)
-#define CORE_CRITICAL(...)  ::Log::GetCoreLogger()->critical(__VA_ARGS__)
+#if CORE_LOG_LEVEL <= SPDLOG_LEVEL_TRACE
+    #define CORE_TRACE(...)     ::Log::GetCoreLogger()->trace(__VA_ARGS__)
+#else
+    #define CORE_TRACE(...)     (void)0
+#endif
+
+#if CORE_LOG_LEVEL <= SPDLOG_LEVEL_DEBUG
+    #define CORE_DEBUG(...)     ::Log::GetCoreLogger()->debug(__VA_ARGS__)
+#else
+    #define CORE_DEBUG(...)     (void)0
+#endif
+
+#if CORE_LOG_LEVEL <= SPDLOG_LEVEL_INFO
+    #define CORE_INFO(...)      ::Log::GetCoreLogger()->info(__VA_ARGS__)
+#else
+    #define CORE_INFO(...)      (void)0
+#endif
+
+#if CORE_LOG_LEVEL <= SPDLOG_LEVEL_WARN
+    #define CORE_WARN(...)      ::Log::GetCoreLogger()->warn(__VA_ARGS__)
+#else
+    #define CORE_WARN(...)      (void)0
+#endif
+
+#if CORE_LOG_LEVEL <= SPDLOG_LEVEL_ERROR
+    #define CORE_ERROR(...)     ::Log::GetCoreLogger()->error(__VA_ARGS__)
+#else
+    #define CORE_ERROR(...)     (void)0
+#endif
+
+#if CORE_LOG_LEVEL <= SPDLOG_LEVEL_CRITICAL
+    #define CORE_CRITICAL(...)  ::Log::GetCoreLogger()->critical(__VA_ARGS__)
+#else
+    #define CORE_CRITICAL(...)  (void)0
+#endif
+
+// --------------------------------------------
+// Definition of the rate limited logging macros (for per-frame code paths).
+// --------------------------------------------
+/// Log a warning only the first time the call site is reached.
+#define CORE_WARN_ONCE(...)                                                                     \
+    do {                                                                                        \
+        static std::atomic<bool> s_Logged = false;                                              \
+        if (!s_Logged.exchange(true, std::memory_order_relaxed))                                \
+            CORE_WARN(__VA_ARGS__);                                                             \
+    } while (0)
+
+/// Log a warning the first time and then every `n` times the call site is reached.
+#define CORE_WARN_EVERY_N(n, ...)                                                               \
+    do {                                                                                        \
+        static std::atomic<uint64_t> s_Count = 0;                                               \
+        if (s_Count.fetch_add(1, std::memory_order_relaxed) % (n) == 0)                         \
+            CORE_WARN(__VA_ARGS__);                                                             \
+    } while (0)
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Common/Core/JobSystem.h"
+
+#include <atomic>
+#include <chrono>
+
+/**
+ * Represents a timed zone recorded by the profiler.
+ */
+struct ProfileEvent
+{
+    const char* Name = nullptr;     ///< Name of the zone (static or interned string).
+    uint64_t Start = 0;             ///< Start time (in nanoseconds since the profiler started).
+    uint64_t End = 0;               ///< End time (in nanoseconds since the profiler started).
+};
+
+/**
+ * CPU profiler recording timed zones into per-thread ring buffers.
+ *
+ * The `Profiler` class records the zones defined with `PROFILE_SCOPE` and `PROFILE_FUNCTION` while
+ * a capture is active. Each thread writes its events into its own ring buffer without any lock
+ * (the thread is the only producer), so recording a zone costs two clock reads and a few stores.
+ * When the capture stops, the profiler waits for the threads that are still recording an event
+ * before reading their buffers. Once the requested number of frames has been captured, the events
+ * are written as a Chrome trace (JSON), which can be opened in `chrome://tracing` or in Perfetto (https://ui.perfetto.dev).
+ *
+ * Zones are compiled out if `ENGINE_ENABLE_PROFILING` is not defined (see the
+ * `RENDERER_ENABLE_PROFILING` build option).
+ */
+class Profiler
+{
+public:
+    // Capture
+    // ----------------------------------------
+    static void BeginCapture(unsigned int frames, const std::filesystem::path& filePath);
+    static void EndCapture();
+    static void EndFrame();
+    
+    /// @brief Check if the zones are being recorded.
+    /// @return `true` if a capture is active.
+    static bool IsCapturing() { return s_Capturing.load(std::memory_order_relaxed); }
+    
+    // Recording
+    // ----------------------------------------
+    static void Record(const char* name, uint64_t start, uint64_t end);
+    static const char* Intern(const std::string& name);
+    static void SetThreadName(const std::string& name);
+    static JobHooks GetJobHooks();
+    
+    /// @brief Get the current time of the profiler.
+    /// @return The time (in nanoseconds) since the profiler started.
+    static uint64_t Now()
+    {
+        return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - s_Origin).count();
+    }
+
+private:
+    // Export
+    // ----------------------------------------
+    static void WriteChromeTrace(const std::filesystem::path& filePath);
+    
+    // Profiler variables
+    // ----------------------------------------
+private:
+    ///< Recording state.
+    static inline std::atomic<bool> s_Capturing = false;
+    ///< Reference time of the timestamps.
+    static inline const std::chrono::steady_clock::time_point s_Origin = std::chrono::steady_clock::now();
+};
+
+/**
+ * Records the time spent in a scope (from its construction to its destruction).
+ */
+class ProfileScope
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Start timing a zone.
+    /// @param name The name of the zone (must outlive the capture, e.g., a string literal).
+    ProfileScope(const char* name)
+        : m_Name(name), m_Start(Profiler::IsCapturing() ? Profiler::Now() : 0)
+    {}
+    /// @brief Stop timing the zone and record it.
+    ~ProfileScope()
+    {
+        if (m_Start && Profiler::IsCapturing())
+            Profiler::Record(m_Name, m_Start, Profiler::Now());
+    }
+    
+    // Scope variables
+    // ----------------------------------------
+private:
+    ///< Name of the zone.
+    const char* m_Name;
+    ///< Start time of the zone (zero if not recorded).
+    uint64_t m_Start;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope(ProfileScope&&) = delete;
+    
+    ProfileScope& operator=(const ProfileScope&) = delete;
+    ProfileScope& operator=(ProfileScope&&) = delete;
+};
+
+// Define the profiling macros (only if profiling is enabled)
+#ifdef ENGINE_ENABLE_PROFILING
+    #if defined(_MSC_VER)
+        #define PROFILE_FUNCTION_NAME __FUNCSIG__
+    #else
+        #define PROFILE_FUNCTION_NAME __PRETTY_FUNCTION__
+    #endif
+    
+    #define PROFILE_CONCAT_IMPL(a, b) a##b
+    #define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+    
+    #define PROFILE_SCOPE(name) ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(name)
+    #define PROFILE_FUNCTION() PROFILE_SCOPE(PROFILE_FUNCTION_NAME)
+    #define PROFILE_FRAME() Profiler::EndFrame()
+#else
+    #define PROFILE_SCOPE(name)
+    #define PROFILE_FUNCTION()
+    #define PROFILE_FRAME()
+#endif
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Common/Event/Event.h"
+#include "Common/Event/EventQueue.h"
+#include "Common/Input/Input.h"
 #include "Common/Renderer/GraphicsContext.h"
 
 struct GLFWwindow;
@@ -18,9 +20,15 @@ struct WindowData
     int Width, Height;
     ///< Vertical synchronization with the monitor.
     bool VerticalSync;
+    ///< Window shown on the screen (hidden windows are used for headless rendering).
+    bool Visible;
     
     ///< Callback function to handle events.
     std::function<void(Event&)> EventCallback;
+    ///< Events received since the last frame.
+    EventQueue Events;
+    ///< Input state (updated with every received event).
+    InputState Input;
     
     // Constructor(s)/Destructor
     // ----------------------------------------
@@ -28,9 +36,11 @@ struct WindowData
     /// @param title Window name.
     /// @param width Size (width) of the window.
     /// @param height Size (height) of the window.
+    /// @param verticalSync Synchronize the window with the monitor.
+    /// @param visible Show the window on the screen.
     WindowData(const std::string& title, const int width, const int height,
-               bool verticalSync = true)
-        : Title(title), Width(width), Height(height), VerticalSync(verticalSync)
+               bool verticalSync = true, bool visible = true)
+        : Title(title), Width(width), Height(height), VerticalSync(verticalSync), Visible(visible)
     {}
     /// @brief delete the data of the window.
     ~WindowData() = default;
@@ -42,6 +52,9 @@ struct WindowData
  * The `Window` class represents a window in the application. It provides methods to create, update,
  * and interact with the window. The event callback function can be set to handle window events.
  *
+ * The events received from GLFW are buffered and dispatched once per frame (`ProcessEvents`),
+ * with the consecutive mouse moves, scrolls and key repeats coalesced.
+ *
  * Copying or moving `Window` objects is disabled to ensure single ownership and prevent unintended
  * window duplication.
  */
@@ -50,12 +63,16 @@ class Window
 public:
     // Constructor(s)/Destructor
     // ----------------------------------------
-    Window(const std::string& title, const int width, const int height);
+    Window(const std::string& title, const int width, const int height,
+           const bool visible = true);
     ~Window();
     
     // Update
     // ----------------------------------------
     void OnUpdate() const;
+    void WaitEvents(double timeout) const;
+    static void Wake();
+    void ProcessEvents();
     
     // Getter(s)
     // ----------------------------------------
@@ -71,9 +88,18 @@ public:
     /// @brief Check if there is a vertical synchronization with the monitor.
     /// @return `true` if the window is synchronized.
     bool IsVerticalSync() const { return m_Data.VerticalSync; }
+    /// @brief Check if the window is shown on the screen.
+    /// @return `true` if the window is visible.
+    bool IsVisible() const { return m_Data.Visible; }
     /// @brief Get the GLFW window.
     /// @return The native window.
     void* GetNativeWindow() const { return m_Window; }
+    /// @brief Get the input state of the window (updated as the events are received).
+    /// @return The input state.
+    const InputState& GetInputState() const { return m_Data.Input; }
+    /// @brief Get the events waiting to be dispatched.
+    /// @return The event queue.
+    const EventQueue& GetEventQueue() const { return m_Data.Events; }
     
     // Setter(s)
     // ----------------------------------------
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "Common/Event/Event.h"
+#include "Common/Event/KeyEvent.h"
+#include "Common/Event/MouseEvent.h"
+#include "Common/Event/WindowEvent.h"
+
+/**
+ * Buffers the events received from the window until they are dispatched.
+ *
+ * The `EventQueue` class stores the events in the order they are received, so that they can be
+ * dispatched once per frame instead of from inside the window callbacks. Consecutive events that
+ * only describe the latest state are coalesced into the last queued event: mouse moves keep the
+ * last position, scrolls add their offsets, key repeats of the same key keep the last count and
+ * window resizes keep the last size. Any other event in between stops the coalescing, so the
+ * relative order of the events is preserved.
+ *
+ * Copying or moving `EventQueue` objects is disabled to ensure single ownership and prevent
+ * unintended event duplication.
+ */
+class EventQueue
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate an empty event queue.
+    EventQueue() = default;
+    /// @brief Delete the event queue.
+    ~EventQueue() = default;
+    
+    // Queue
+    // ----------------------------------------
+    /// @brief Add an event at the end of the queue (or coalesce it with the last event).
+    /// @tparam E Event type.
+    /// @param args The arguments to construct the event.
+    template<typename E, typename... Args>
+    void Push(Args&&... args)
+    {
+        E event(std::forward<Args>(args)...);
+        m_Received++;
+        
+        if (!m_Events.empty() && Coalesce(*m_Events.back(), event))
+            return;
+        m_Events.push_back(std::make_unique<E>(std::move(event)));
+    }
+    /// @brief Dispatch the queued events (in order) and empty the queue.
+    /// @param callback The function handling each event.
+    void Dispatch(const std::function<void(Event&)>& callback)
+    {
+        // Swap the queue, in case new events are pushed while dispatching
+        m_Dispatching.swap(m_Events);
+        m_Dispatched += m_Dispatching.size();
+        
+        if (callback)
+        {
+            for (std::unique_ptr<Event>& event : m_Dispatching)
+                callback(*event);
+        }
+        m_Dispatching.clear();
+    }
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the number of events waiting to be dispatched.
+    /// @return The number of queued events.
+    size_t GetSize() const { return m_Events.size(); }
+    /// @brief Get the number of events received since the queue was created.
+    /// @return The number of received events.
+    uint64_t GetReceivedCount() const { return m_Received; }
+    /// @brief Get the number of events dispatched since the queue was created.
+    /// @return The number of dispatched events (the received ones minus the coalesced ones).
+    uint64_t GetDispatchedCount() const { return m_Dispatched; }
+
+private:
+    // Coalescing
+    // ----------------------------------------
+    /// @brief Merge an event into the last queued event when it only updates its state.
+    /// @tparam E Event type.
+    /// @param last The last queued event.
+    /// @param event The new event.
+    /// @return `true` if the event has been merged into the last one.
+    template<typename E>
+    static bool Coalesce(Event& last, const E& event)
+    {
+        if (last.GetEventType() != E::GetEventTypeStatic())
+            return false;
+        
+        E& previous = static_cast<E&>(last);
+        if constexpr (std::is_same_v<E, MouseMovedEvent> || std::is_same_v<E, WindowResizeEvent>)
+        {
+            previous = event;
+            return true;
+        }
+        else if constexpr (std::is_same_v<E, MouseScrolledEvent>)
+        {
+            previous = MouseScrolledEvent(previous.GetXOffset() + event.GetXOffset(),
+                                          previous.GetYOffset() + event.GetYOffset());
+            return true;
+        }
+        else if constexpr (std::is_same_v<E, KeyPressedEvent>)
+        {
+            // Only the repeats of the same key are merged (a new press is always kept)
+            if (previous.GetRepeatCount() <= 1 || previous.GetKeyCode() != event.GetKeyCode())
+                return false;
+            previous = event;
+            return true;
+        }
+        return false;
+    }
+    
+    // Event queue variables
+    // ----------------------------------------
+private:
+    ///< Events waiting to be dispatched.
+    std::vector<std::unique_ptr<Event>> m_Events;
+    ///< Events being dispatched.
+    std::vector<std::unique_ptr<Event>> m_Dispatching;
+    
+    ///< Number of events received.
+    uint64_t m_Received = 0;
+    ///< Number of events dispatched.
+    uint64_t m_Dispatched = 0;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    EventQueue(const EventQueue&) = delete;
+    EventQueue(EventQueue&&) = delete;
+    
+    EventQueue& operator=(const EventQueue&) = delete;
+    EventQueue& operator=(EventQueue&&) = delete;
+};
@@ -5,16 +5,58 @@
 
 #include <glm/glm.hpp>
 
+#include <bitset>
+
+/**
+ * Represents the state of the keyboard and the mouse at a given time.
+ */
+struct InputState
+{
+    ///< Keys currently pressed (indexed by key code).
+    std::bitset<Key::Menu + 1> Keys;
+    ///< Mouse buttons currently pressed (indexed by mouse code).
+    std::bitset<Mouse::ButtonLast + 1> MouseButtons;
+    ///< Position of the mouse cursor.
+    glm::vec2 MousePosition = glm::vec2(0.0f);
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Define if a key is pressed (unknown keys are ignored).
+    /// @param key The key code.
+    /// @param pressed The key is pressed.
+    void SetKey(const int key, const bool pressed)
+    {
+        if (key >= 0 && key < (int)Keys.size())
+            Keys.set(key, pressed);
+    }
+    /// @brief Define if a mouse button is pressed (unknown buttons are ignored).
+    /// @param button The mouse code.
+    /// @param pressed The button is pressed.
+    void SetMouseButton(const int button, const bool pressed)
+    {
+        if (button >= 0 && button < (int)MouseButtons.size())
+            MouseButtons.set(button, pressed);
+    }
+};
+
 /**
  * Static class for handling user input.
  *
  * The `Input` class provides static methods for checking and retrieving user input such as keyboard
  * and mouse events. It serves as a convenient interface to query input state without the need to
  * instantiate an object of this class.
+ *
+ * The queries read a snapshot of the input state captured once at the beginning of each frame
+ * (`Update`), so they do not call into the window system and every layer sees the same state
+ * during the frame.
  */
 class Input
 {
 public:
+    // Update
+    // ----------------------------------------
+    static void Update();
+    
     // Input checking
     // ----------------------------------------
     static bool IsKeyPressed(const KeyCode key);
@@ -22,11 +64,22 @@ public:
     
     // Getter(s)
     // ----------------------------------------
-    static glm::vec2 GetMousePosition();
+    /// @brief Get the mouse position.
+    /// @return A 2D vector representing the mouse position.
+    static glm::vec2 GetMousePosition() { return s_State.MousePosition; }
     /// @brief Get the current x-coordinate of the mouse position.
     /// @return The current x-coordinate of the mouse position.
     static float GetMouseX() { return GetMousePosition().x; }
     /// @brief Get the current y-coordinate of the mouse position.
     /// @return The current y-coordinate of the mouse position.
     static float GetMouseY() { return GetMousePosition().y; }
+    /// @brief Get the input state captured for the current frame.
+    /// @return The input snapshot.
+    static const InputState& GetState() { return s_State; }
+    
+    // Input variables
+    // ----------------------------------------
+private:
+    ///< Input state captured at the beginning of the frame.
+    static InputState s_State;
 };
@@ -6,11 +6,11 @@
  * Enumeration of vertex attribute data types.
  *
  * The `DataType` enumeration represents different data types that can be used for vertex attributes.
- * It includes boolean, integer, floating-point, vectors (2D, 3D, 4D), and matrices (2x2, 3x3, 4x4) types.
+ * It includes boolean, integer (signed and unsigned), floating-point, vectors (2D, 3D, 4D), and matrices (2x2, 3x3, 4x4) types.
  */
 enum class DataType
 {
-    Bool, Int, Float,
+    Bool, Int, UInt, Float,
     Vec2, Vec3, Vec4,
     Mat2, Mat3, Mat4
 };
@@ -30,6 +30,7 @@ inline unsigned int GetCompCountOfType(DataType type)
     {
         case DataType::Bool: return 1;
         case DataType::Int: return 1;
+        case DataType::UInt: return 1;
         case DataType::Float: return 1;
         case DataType::Vec2: return 2;
         case DataType::Vec3: return 3;
@@ -56,6 +57,7 @@ inline unsigned int GetSizeOfType(DataType type)
     {
         case DataType::Bool: return 1;
         case DataType::Int: return 4;
+        case DataType::UInt: return 4;
         case DataType::Float: return 4;
         case DataType::Vec2: return 4 * 2;
         case DataType::Vec3: return 4 * 3;
@@ -84,6 +86,7 @@ inline GLenum DataTypeToOpenGLType(DataType type)
     {
         case DataType::Bool: return GL_BOOL;
         case DataType::Int: return GL_INT;
+        case DataType::UInt: return GL_UNSIGNED_INT;
         case DataType::Float: return GL_FLOAT;
         case DataType::Vec2: return GL_FLOAT;
         case DataType::Vec3: return GL_FLOAT;
@@ -112,13 +112,23 @@ public:
     /// @return The state of the color, depth and stencil buffers.
     BufferState GetActiveBuffers() const { return m_ActiveBuffers; }
     
+    /// @brief Get the width of the area rendered when binding the framebuffer.
+    /// @return The render area size (width).
+    unsigned int GetRenderWidth() const { return m_RenderWidth; }
+    /// @brief Get the height of the area rendered when binding the framebuffer.
+    /// @return The render area size (height).
+    unsigned int GetRenderHeight() const { return m_RenderHeight; }
+    
+    // Setter(s)
+    // ----------------------------------------
+    void SetRenderArea(const unsigned int width, const unsigned int height);
+    
     // Usage
     // ----------------------------------------
     void Bind() const;
     void BindForDrawAttachment(const unsigned int index) const;
     void BindForReadAttachment(const unsigned int index) const;
-    void BindForDrawAttachmentCube(const unsigned int index, const unsigned int face,
-                                   const unsigned int level = 0) const;
+    void BindForDrawAttachmentLayers(const unsigned int index, const unsigned int level = 0) const;
     void Unbind(const bool& genMipMaps = true) const;
     
     // Draw
@@ -135,6 +145,10 @@ public:
                                      const std::shared_ptr<FrameBuffer>& dst,
                                      const unsigned int srcIndex, const unsigned int dstIndex,
                                      const TextureFilter& filter = TextureFilter::Nearest);
+    static void BlitToScreen(const std::shared_ptr<FrameBuffer>& src,
+                             const unsigned int width, const unsigned int height,
+                             const unsigned int srcIndex = 0,
+                             const TextureFilter& filter = TextureFilter::Linear);
     
     // Getter(s)
     // ----------------------------------------
@@ -214,6 +228,9 @@ private:
     ///< The states active in the framebuffer.
     BufferState m_ActiveBuffers = { false, false, false };
     
+    ///< Size of the area rendered into (the lower-left corner of the attachments).
+    unsigned int m_RenderWidth = 0, m_RenderHeight = 0;
+    
     // Disable the copying or moving of this resource
     // ----------------------------------------
 public:
@@ -0,0 +1,61 @@
+#pragma once
+
+/**
+ * Represents a shader storage buffer for reading and writing data from shaders.
+ *
+ * The `StorageBuffer` class manages shader storage buffer objects (SSBO), large buffers that can
+ * be read and written from any shader stage (mostly compute shaders). It provides functions for
+ * creation, binding to an indexed binding point, and updating or reading back its data. The same
+ * buffer can also be used as the source of indirect draw commands or per-instance attributes.
+ *
+ * Copying or moving `StorageBuffer` objects is disabled to ensure single ownership and prevent
+ * unintended buffer duplication.
+ */
+class StorageBuffer
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    StorageBuffer(const unsigned int size, const void *data = nullptr);
+    ~StorageBuffer();
+    
+    // Usage
+    // ----------------------------------------
+    void Bind() const;
+    void BindToBindingPoint(const unsigned int binding) const;
+    void Unbind() const;
+    
+    // Data
+    // ----------------------------------------
+    void SetData(const void *data, const unsigned int size, const unsigned int offset = 0);
+    void GetData(void *data, const unsigned int size, const unsigned int offset = 0) const;
+    void Clear();
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the size of the buffer.
+    /// @return The size in bytes.
+    unsigned int GetSize() const { return m_Size; }
+    
+    // Friend class definition(s)
+    // ----------------------------------------
+    friend class Renderer;
+    friend class VertexArray;
+    
+    // Storage buffer variables
+    // ----------------------------------------
+private:
+    ///< ID of the storage buffer.
+    unsigned int m_ID = 0;
+    ///< Size of the buffer (in bytes).
+    unsigned int m_Size = 0;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    StorageBuffer(const StorageBuffer&) = delete;
+    StorageBuffer(StorageBuffer&&) = delete;
+    
+    StorageBuffer& operator=(const StorageBuffer&) = delete;
+    StorageBuffer& operator=(StorageBuffer&&) = delete;
+};
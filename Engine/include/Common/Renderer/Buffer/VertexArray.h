@@ -2,6 +2,7 @@
 
 #include "Common/Renderer/Buffer/VertexBuffer.h"
 #include "Common/Renderer/Buffer/IndexBuffer.h"
+#include "Common/Renderer/Buffer/StorageBuffer.h"
 #include "Common/Renderer/Buffer/BufferLayout.h"
 
 /**
@@ -45,6 +46,7 @@ public:
     // Setter(s)
     // ----------------------------------------
     void AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vbo);
+    void AddInstanceBuffer(const std::shared_ptr<StorageBuffer>& sbo, const BufferLayout& layout);
     /// @brief Link an input index buffer to the vertex array.
     /// @param ibo Index buffer object.
     void SetIndexBuffer(const std::shared_ptr<IndexBuffer>& ibo)
@@ -62,6 +64,8 @@ private:
     
     ///< Linked vertex buffers (possible to have more than one).
     std::vector<std::shared_ptr<VertexBuffer>> m_VertexBuffers;
+    ///< Linked instance buffers (read once per instance).
+    std::vector<std::shared_ptr<StorageBuffer>> m_InstanceBuffers;
     ///< Linked index buffer.
     std::shared_ptr<IndexBuffer> m_IndexBuffer;
     
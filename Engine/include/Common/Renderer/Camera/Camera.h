@@ -114,6 +114,8 @@ public:
         UpdateViewMatrix();
     }
     
+    void SetPose(const glm::vec3& position, const glm::quat& orientation);
+    
     /// @brief Change the camera target coordinates.
     /// @param target The camera target (x, y, z).
     void SetTarget(const glm::vec3& target)
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "Common/Renderer/Buffer/VertexArray.h"
+#include "Common/Renderer/Buffer/VertexBuffer.h"
+#include "Common/Renderer/Buffer/IndexBuffer.h"
+#include "Common/Renderer/Buffer/StorageBuffer.h"
+
+#include "Common/Renderer/Shader/Shader.h"
+#include "Common/Renderer/Texture/Texture.h"
+#include "Common/Renderer/Material/Material.h"
+#include "Common/Renderer/Model/Model.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * Represents an indirect draw command for indexed geometry.
+ *
+ * The layout of the `DrawElementsIndirectCommand` structure matches the one expected by
+ * `glMultiDrawElementsIndirect` and the `DrawCommand` structure of the culling shaders.
+ */
+struct DrawElementsIndirectCommand
+{
+    unsigned int Count = 0;             ///< Number of indices to be drawn.
+    unsigned int InstanceCount = 0;     ///< Number of instances to be drawn.
+    unsigned int FirstIndex = 0;        ///< Offset of the first index.
+    int BaseVertex = 0;                 ///< Offset added to each index.
+    unsigned int BaseInstance = 0;      ///< Offset of the first instance.
+};
+
+/**
+ * Culling stage that selects and draws the visible objects of a pass entirely on the GPU.
+ *
+ * The `GPUCulling` class packs the geometry (positions) of a set of models into shared buffers and
+ * uploads the per-object bounds and transforms into a shader storage buffer. Every frame, a compute
+ * shader tests each object against the view frustum (and optionally against a hierarchical depth map)
+ * and writes a compacted list of `DrawElementsIndirectCommand` together with the index of the
+ * visible objects. The list is then drawn with a single multi-draw indirect call, so the CPU cost
+ * of the pass no longer depends on the number of objects.
+ *
+ * The objects are drawn with one material only (e.g., the depth material of the shadow passes),
+ * which must read the model matrices from the objects buffer (see `DepthMapIndirect.glsl`).
+ *
+ * Copying or moving `GPUCulling` objects is disabled to ensure single ownership and prevent
+ * unintended duplication of the GPU buffers.
+ */
+class GPUCulling
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    GPUCulling(const std::filesystem::path& filePath = "Resources/shaders/culling/DepthMapIndirect.glsl");
+    GPUCulling(const std::shared_ptr<Material>& material);
+    /// @brief Delete the culling stage.
+    ~GPUCulling() = default;
+    
+    // Definition
+    // ----------------------------------------
+    void Build(const std::vector<std::shared_ptr<BaseModel>>& models);
+    /// @brief Mark the culling stage as out of date (e.g., the set of models has changed).
+    void Invalidate() { m_Built = false; }
+    
+    // Render
+    // ----------------------------------------
+    void Cull(const glm::mat4& viewProjection);
+    void Draw();
+    
+    // Getter(s)
+    // ----------------------------------------
+    static bool IsSupported();
+    
+    bool IsBuilt() const;
+    /// @brief Get the number of objects tested by the culling stage.
+    /// @return The number of objects.
+    unsigned int GetObjectCount() const { return (unsigned int)m_Objects.size(); }
+    /// @brief Get the material used to draw the visible objects.
+    /// @return The material.
+    const std::shared_ptr<Material>& GetMaterial() const { return m_Material; }
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Set the hierarchical depth map used for the occlusion test.
+    /// @param texture The depth map (each mip level stores the farthest depth), or `nullptr`
+    /// to disable the occlusion test.
+    void SetOcclusionMap(const std::shared_ptr<Texture>& texture) { m_OcclusionMap = texture; }
+    void SetModelEnabled(unsigned int model, bool enabled);
+
+private:
+    // Shader
+    // ----------------------------------------
+    static std::shared_ptr<Shader> GetCullingShader();
+    
+    // Buffers
+    // ----------------------------------------
+    void UpdateObjects();
+    
+    // Culling structures
+    // ----------------------------------------
+private:
+    /**
+     * Represents the information of an object as it is stored in the objects buffer (std430).
+     */
+    struct ObjectData
+    {
+        ///< Model matrix of the object.
+        glm::mat4 Model = glm::mat4(1.0f);
+        ///< Minimum coordinates of the bounding box.
+        glm::vec4 BBoxMin = glm::vec4(0.0f);
+        ///< Maximum coordinates of the bounding box.
+        glm::vec4 BBoxMax = glm::vec4(0.0f);
+        ///< Draw range (index count, first index, base vertex) and state (enabled if not zero).
+        glm::uvec4 Draw = glm::uvec4(0);
+    };
+    
+    // Culling variables
+    // ----------------------------------------
+private:
+    ///< Models drawn by the culling stage.
+    std::vector<std::shared_ptr<BaseModel>> m_Models;
+    ///< Revision of each model when the culling stage was built.
+    std::vector<unsigned int> m_Revisions;
+    ///< Drawing state of each model.
+    std::vector<bool> m_Enabled;
+    ///< Objects (meshes) to be tested.
+    std::vector<ObjectData> m_Objects;
+    ///< Index of the model owning each object.
+    std::vector<unsigned int> m_ObjectModel;
+    
+    ///< Vertex array with the packed geometry.
+    std::shared_ptr<VertexArray> m_VertexArray;
+    ///< Vertex buffer with the packed positions.
+    std::shared_ptr<VertexBuffer> m_VertexBuffer;
+    ///< Index buffer with the packed indices.
+    std::shared_ptr<IndexBuffer> m_IndexBuffer;
+    
+    ///< Storage buffer with the objects.
+    std::shared_ptr<StorageBuffer> m_ObjectBuffer;
+    ///< Storage buffer with the compacted draw commands.
+    std::shared_ptr<StorageBuffer> m_CommandBuffer;
+    ///< Storage buffer with the object index of each visible draw.
+    std::shared_ptr<StorageBuffer> m_InstanceBuffer;
+    ///< Storage buffer with the number of visible draws.
+    std::shared_ptr<StorageBuffer> m_ParameterBuffer;
+    
+    ///< Compute shader performing the culling.
+    std::shared_ptr<Shader> m_CullingShader;
+    ///< Material used to draw the visible objects.
+    std::shared_ptr<Material> m_Material;
+    ///< Hierarchical depth map for the occlusion test.
+    std::shared_ptr<Texture> m_OcclusionMap;
+    
+    ///< Build state.
+    bool m_Built = false;
+    
+    ///< Compute shader performing the culling (shared by the existing culling stages, without
+    ///< owning it).
+    static inline std::weak_ptr<Shader> s_CullingShader;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    GPUCulling(const GPUCulling&) = delete;
+    GPUCulling(GPUCulling&&) = delete;
+    
+    GPUCulling& operator=(const GPUCulling&) = delete;
+    GPUCulling& operator=(GPUCulling&&) = delete;
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+/**
+ * Controls the resolution scale of a render target from the measured GPU frame times.
+ *
+ * The `DynamicResolution` class reads the GPU times recorded by `FrameStatistics` and adjusts a
+ * render scale (applied to both dimensions of the target) to keep the frames within a time
+ * budget. The cost of a frame is assumed to grow with the number of rendered pixels, so the
+ * scale is corrected by the square root of the ratio between the budget and the measured time.
+ * To avoid oscillations, the scale is only modified when the smoothed time leaves a band below
+ * the budget, each correction is limited to a small step, and the frames rendered before the last
+ * correction are not considered.
+ *
+ * Copying or moving `DynamicResolution` objects is disabled to ensure single ownership and
+ * prevent unintended controller duplication.
+ */
+class DynamicResolution
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate a (disabled) resolution controller.
+    DynamicResolution() = default;
+    /// @brief Delete the resolution controller.
+    ~DynamicResolution() = default;
+    
+    // Update
+    // ----------------------------------------
+    bool Update();
+    void Reset();
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Check if the scale is controlled from the GPU times.
+    /// @return `true` if the controller is enabled.
+    bool IsEnabled() const { return m_Enabled; }
+    /// @brief Get the current render scale.
+    /// @return The scale of the render target dimensions.
+    float GetScale() const { return m_Scale; }
+    /// @brief Get the GPU time budget of a frame.
+    /// @return The budget (in milliseconds).
+    float GetBudget() const { return m_Budget; }
+    /// @brief Get the smoothed GPU time of the frames rendered at the current scale.
+    /// @return The GPU time (in milliseconds, negative if not measured yet).
+    float GetGPUTime() const { return m_GPUTime; }
+    /// @brief Get the minimum render scale.
+    /// @return The minimum scale.
+    float GetMinScale() const { return m_MinScale; }
+    /// @brief Get the maximum render scale.
+    /// @return The maximum scale.
+    float GetMaxScale() const { return m_MaxScale; }
+    
+    // Setter(s)
+    // ----------------------------------------
+    void SetEnabled(bool enabled);
+    void SetBudget(float budget);
+    void SetScaleRange(float minScale, float maxScale);
+
+private:
+    // Update
+    // ----------------------------------------
+    void SetScale(float scale);
+    
+    // Dynamic resolution variables
+    // ----------------------------------------
+private:
+    ///< Enabled flag.
+    bool m_Enabled = false;
+    ///< Current render scale.
+    float m_Scale = 1.0f;
+    ///< Range of the render scale.
+    float m_MinScale = 0.5f, m_MaxScale = 1.0f;
+    ///< GPU time budget of a frame (in milliseconds).
+    float m_Budget = 16.0f;
+    
+    ///< Smoothed GPU time of the frames rendered at the current scale (in milliseconds).
+    float m_GPUTime = -1.0f;
+    ///< Number of GPU times measured at the current scale.
+    unsigned int m_Samples = 0;
+    ///< Index of the next frame to be measured.
+    uint64_t m_NextFrame = 0;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    DynamicResolution(const DynamicResolution&) = delete;
+    DynamicResolution(DynamicResolution&&) = delete;
+    
+    DynamicResolution& operator=(const DynamicResolution&) = delete;
+    DynamicResolution& operator=(DynamicResolution&&) = delete;
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+
+/// Maximum number of render passes timed per frame.
+constexpr unsigned int g_MaxTimedPasses = 16;
+/// Maximum number of lights whose shadow casters are counted per frame.
+constexpr unsigned int g_MaxCountedLights = 16;
+
+/**
+ * Represents the measurements of a rendered frame.
+ */
+struct FrameRecord
+{
+    ///< Index of the frame since the application started.
+    uint64_t Index = 0;
+    ///< Time between the start of this frame and the start of the previous one, without the time
+    ///< waiting for the events in between (in milliseconds).
+    float FrameTime = 0.0f;
+    ///< Time spent by the CPU to record the frame, excluding the buffer swap (in milliseconds).
+    float CPUTime = 0.0f;
+    ///< Time spent by the GPU to execute the frame (in milliseconds, negative if not available).
+    float GPUTime = -1.0f;
+    ///< Number of draw calls.
+    unsigned int DrawCalls = 0;
+    ///< Number of rendered triangles.
+    unsigned int Triangles = 0;
+    ///< GPU time of each timed render pass (in milliseconds, negative if not rendered or not available).
+    std::array<float, g_MaxTimedPasses> PassTimes;
+    ///< Number of shadow casters kept for each light (negative if not counted).
+    std::array<int, g_MaxCountedLights> ShadowCasters;
+};
+
+/**
+ * Represents the distribution of the frame times of the recorded history.
+ */
+struct FrameTimeSummary
+{
+    unsigned int Frames = 0;    ///< Number of frames considered.
+    float Average = 0.0f;       ///< Average frame time (in milliseconds).
+    float P50 = 0.0f;           ///< Median frame time (in milliseconds).
+    float P95 = 0.0f;           ///< 95th percentile of the frame times (in milliseconds).
+    float P99 = 0.0f;           ///< 99th percentile of the frame times (in milliseconds).
+    float Max = 0.0f;           ///< Longest frame time (in milliseconds).
+    unsigned int Hitches = 0;   ///< Number of frames longer than the hitch threshold.
+};
+
+/**
+ * Rolling history of the frame measurements.
+ *
+ * The `FrameStatistics` class keeps the measurements of the last `Capacity` frames in a ring
+ * buffer: frame, CPU and GPU times, draw calls, triangles, the GPU time of each render pass, and
+ * the number of shadow casters kept for each light.
+ * The GPU times are measured with timestamp queries that are read back a few frames later (to
+ * avoid stalling the pipeline), so the most recent records can still miss their GPU times.
+ *
+ * Average values hide the stutters, so the history is summarized with percentiles and a hitch
+ * count (frames longer than `HitchFactor` times the median frame time). The whole history can be
+ * exported as CSV or JSON on demand, or automatically when the application ends.
+ */
+class FrameStatistics
+{
+public:
+    /// Number of frames kept in the history.
+    static constexpr unsigned int Capacity = 10000;
+    /// Number of frames after which the GPU times of a frame are read back (or discarded).
+    static constexpr unsigned int QueryLatency = 4;
+    
+    // Frame recording
+    // ----------------------------------------
+    static void BeginFrame();
+    static void EndFrame();
+    static void BeginPass(const char* name);
+    static void EndPass();
+    static void SetShadowCasters(const char* light, unsigned int count);
+    static void BeginWait();
+    static void EndWait();
+    static void Shutdown();
+    
+    // Getter(s)
+    // ----------------------------------------
+    static unsigned int GetSize();
+    static uint64_t GetFrameIndex();
+    static const FrameRecord& GetRecord(unsigned int index);
+    static FrameTimeSummary GetSummary();
+    static FrameTimeSummary GetSummary(unsigned int frames);
+    static const std::vector<const char*>& GetPassNames();
+    static const std::vector<const char*>& GetLightNames();
+    static float GetHitchFactor();
+    
+    // Setter(s)
+    // ----------------------------------------
+    static void SetHitchFactor(float factor);
+    static void SetExportPath(const std::filesystem::path& filePath);
+    
+    // Export
+    // ----------------------------------------
+    static bool ExportCSV(const std::filesystem::path& filePath);
+    static bool ExportJSON(const std::filesystem::path& filePath);
+
+private:
+    // GPU queries
+    // ----------------------------------------
+    static void ReadQueries();
+};
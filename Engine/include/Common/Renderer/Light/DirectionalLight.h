@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Common/Renderer/Light/Light.h"
+#include "Common/Renderer/Light/ShadowCascades.h"
 
 #include <glm/glm.hpp>
 
@@ -9,7 +10,8 @@
  *
  * The `DirectionalLight` class extends the `Light` base class to define a directional light source.
  * It provides methods to set and retrieve the light's direction, distance, and additional properties
- * such as the shadow camera.
+ * such as the shadow camera. The shadows can be split into cascades fitted to the view of a camera
+ * (see `ShadowCascades`), in which case the shadow camera encloses all the cascades.
  *
  * Copying or moving `DirectionalLight` objects is disabled to ensure single ownership and prevent
  * unintended duplication of light resources.
@@ -51,6 +53,7 @@ public:
     {
         m_Vector = glm::vec4(direction, 0.0f);
         UpdateShadowCamera();
+        FrameScheduler::RequestRedraw();
     }
     /// @brief Change the distance of the light.
     /// @param distance The light distance.
@@ -58,6 +61,25 @@ public:
     {
         m_Distance = distance;
         UpdateShadowCamera();
+        FrameScheduler::RequestRedraw();
+    }
+    /// @brief Split the shadow map of the light into cascades.
+    /// @param count The number of cascades.
+    /// @param resolution The size of each cascade (in pixels).
+    /// @note The shadow map framebuffer is replaced by the layered one of the cascades, so it must
+    /// be enabled before defining the shadow render pass.
+    void EnableCascades(unsigned int count = ShadowCascades::MaxCascades,
+                        unsigned int resolution = 2048)
+    {
+        m_Cascades = std::make_shared<ShadowCascades>(resolution, count);
+        m_Framebuffer = m_Cascades->GetFramebuffer();
+        FrameScheduler::RequestRedraw();
+    }
+    /// @brief Orient the light along the down axis (-Y) of a node.
+    /// @param transform The world matrix of the node the light is attached to.
+    void SetTransform(const glm::mat4& transform) override
+    {
+        SetDirection(glm::normalize(glm::vec3(transform * glm::vec4(0.0f, -1.0f, 0.0f, 0.0f))));
     }
     
     // Getter(s)
@@ -68,7 +90,64 @@ public:
     /// @brief Get the distance of the light source.
     /// @return The light distance.
     float GetDistance() const { return m_Distance; }
+    /// @brief Get the shadow cascades of the light.
+    /// @return The shadow cascades (`nullptr` if the shadows are not split into cascades).
+    const std::shared_ptr<ShadowCascades>& GetCascades() const { return m_Cascades; }
+    
+    // Update(s)
+    // ----------------------------------------
+    /// @brief Fit the shadow cascades (and the shadow camera) to the view of a camera.
+    /// @param camera The camera rendering the shadowed scene.
+    /// @param casters The bounds of the shadow casters (in world space, empty if `min > max`).
+    /// @return `true` if the shadow cascades have been modified.
+    bool UpdateCascades(const Camera& camera, const BBox& casters)
+    {
+        if (!m_Cascades)
+            return false;
+        
+        glm::vec3 direction = glm::normalize(glm::vec3(m_Vector));
+        bool changed = m_Cascades->Update(camera, direction, casters);
+        
+        // The shadow camera encloses all the cascades (e.g., to cull the shadow casters)
+        float distance = m_Cascades->GetCasterDistance();
+        auto shadowCamera = std::static_pointer_cast<OrthographicShadow>(m_ShadowCamera);
+        shadowCamera->SetTarget(m_Cascades->GetCenter());
+        shadowCamera->SetPosition(m_Cascades->GetCenter() - direction * distance);
+        shadowCamera->SetOrthographicSize(2.0f * m_Cascades->GetRadius());
+        shadowCamera->SetNearPlane(0.0f);
+        shadowCamera->SetFarPlane(distance + m_Cascades->GetRadius());
+        
+        return changed;
+    }
     
+    // Properties
+    // ----------------------------------------
+    /// @brief Define light properties into the uniforms of the shader program.
+    /// @param shader The shader program.
+    /// @param flags The flags indicating which light properties should be defined.
+    void DefineLightProperties(const std::shared_ptr<Shader>& shader,
+                               const LightFlags& flags,
+                               unsigned int& slot) override
+    {
+        if (!m_Cascades)
+        {
+            Light::DefineLightProperties(shader, flags, slot);
+            return;
+        }
+        
+        // The cascades replace the shadow map of the light
+        LightFlags lightFlags = flags;
+        lightFlags.ShadowProperties = false;
+        Light::DefineLightProperties(shader, lightFlags, slot);
+        
+        if (flags.ShadowProperties)
+        {
+            DefineTranformProperties(shader);
+            DefineFilterProperties(shader);
+            m_Cascades->DefineProperties(shader, m_ID, slot);
+        }
+    }
+
 private:
     // Update(s)
     // ----------------------------------------
@@ -84,6 +163,8 @@ private:
 private:
     ///< The distance from the (shadow camera) target to the light source.
     float m_Distance;
+    ///< Cascades of the shadow map (if enabled).
+    std::shared_ptr<ShadowCascades> m_Cascades;
     
     // Disable the copying or moving of this resource
     // ----------------------------------------
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Common/Renderer/Texture/TextureCube.h"
+
+/**
+ * Stores the precomputed lighting of environment maps on disk.
+ *
+ * The `EnvironmentCache` class keeps the result of the environment precomputation (the cube maps
+ * with all their mipmap levels and the spherical harmonics coefficients) in a compact binary file,
+ * so that an environment map is only processed the first time it is used. The files are content
+ * addressed: their name is a hash of the source image and of the processing parameters (e.g., the
+ * orientation and the size of the cube maps), so a modified image or a different processing never
+ * reuses an outdated file. The pixels are stored in the format of the textures (16-bit values for
+ * the half-float formats) and loaded directly into the storage of each `TextureCube`.
+ *
+ * The content hash of a source file is only computed again when its size or modification time
+ * changes, so switching between already processed images does not read them again.
+ */
+class EnvironmentCache
+{
+public:
+    // Files
+    // ----------------------------------------
+    static std::filesystem::path GetFilePath(const std::filesystem::path& source,
+                                             const std::string& parameters);
+    static bool Load(const std::filesystem::path& filePath, std::vector<float>& coefficients,
+                     const std::vector<std::shared_ptr<TextureCube>>& maps);
+    static bool Save(const std::filesystem::path& filePath, const std::vector<float>& coefficients,
+                     const std::vector<std::shared_ptr<TextureCube>>& maps);
+    
+    // Getter(s)
+    // ----------------------------------------
+    static const std::filesystem::path& GetDirectory();
+    static bool IsEnabled();
+    
+    // Setter(s)
+    // ----------------------------------------
+    static void SetDirectory(const std::filesystem::path& directory);
+    static void SetEnabled(bool enabled);
+};
@@ -5,6 +5,7 @@
 #include "Common/Renderer/Light/Light.h"
 
 #include "Common/Renderer/Material/SimpleMaterial.h"
+#include "Common/Renderer/Material/CubeMapMaterial.h"
 
 #include "Common/Renderer/Mesh/MeshUtils.h"
 #include "Common/Renderer/Model/ModelUtils.h"
@@ -66,7 +67,11 @@ public:
     // ----------------------------------------
     /// @brief Set the strength of the ambient light.
     /// @param s The strength of the ambient component (a value between 0 and 1).
-    void SetAmbientStrength(float s) { m_AmbientStrength = s; }
+    void SetAmbientStrength(float s)
+    {
+        m_AmbientStrength = s;
+        FrameScheduler::RequestRedraw();
+    }
     
     void SetEnvironmentMap(const std::shared_ptr<Texture>& texture);
     
@@ -112,7 +117,7 @@ private:
     // Update
     // ----------------------------------------
     void UpdateEnvironment();
-    void UpdateSphericalHarmonics();
+    std::vector<float> UpdateSphericalHarmonics();
     
     // Render
     // ----------------------------------------
@@ -1,10 +1,14 @@
 #pragma once
 
+#include "Common/Core/FrameScheduler.h"
+
 #include "Common/Renderer/Shader/Shader.h"
 #include "Common/Renderer/Material/Material.h"
 #include "Common/Renderer/Buffer/FrameBuffer.h"
 
 #include "Common/Renderer/Light/ShadowCamera.h"
+#include "Common/Renderer/Light/ShadowAtlas.h"
+#include "Common/Renderer/Light/ShadowMoments.h"
 #include "Common/Renderer/Model/Model.h"
 
 #include <glm/glm.hpp>
@@ -27,6 +31,19 @@ struct LightFlags
     bool IsotropicShading = true;           ///< Indicates whether to use normal-based isotropic shading or tangent-based anisotropic shading.
 };
 
+/**
+ * Filters used to soften the edges of the shadows of a light.
+ *
+ * All the filters compare the depth of the fragment with the shadow map in hardware, so each sample
+ * is already filtered bilinearly (see `TextureSpecification::Compare`).
+ */
+enum class ShadowFilter
+{
+    Grid = 0,           ///< Regular grid of samples, two texels apart (defined by the kernel size).
+    PoissonDisk = 1,    ///< Fixed number of samples in a Poisson disk (with the kernel size as diameter).
+    RotatedDisk = 2,    ///< Poisson disk rotated for each pixel (trades the banding for noise).
+};
+
 /**
  * Base class for light.
  *
@@ -63,6 +80,12 @@ public:
                                        const LightFlags& flags,
                                        unsigned int& slot) = 0;
     
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Place the light using the world matrix of a node (e.g., from a transform hierarchy).
+    /// @param transform The world matrix of the node the light is attached to.
+    virtual void SetTransform(const glm::mat4& transform) {}
+    
 protected:
     // Constructor(s)
     // ----------------------------------------
@@ -114,14 +137,52 @@ public:
     // ----------------------------------------
     /// @brief Set the color of the light source.
     /// @param color The color of the light source.
-    void SetColor(const glm::vec3 &color) { m_Color = color; }
+    void SetColor(const glm::vec3 &color)
+    {
+        m_Color = color;
+        FrameScheduler::RequestRedraw();
+    }
     
     /// @brief Set the strength of the diffuse component of the light source.
     /// @param s The strength of the diffuse component (a value between 0 and 1).
-    void SetDiffuseStrength(float s) { m_DiffuseStrength = s; }
+    void SetDiffuseStrength(float s)
+    {
+        m_DiffuseStrength = s;
+        FrameScheduler::RequestRedraw();
+    }
     /// @brief Set the strength of the specular component of the light source.
     /// @param s The strength of the specular component (a value between 0 and 1).
-    void SetSpecularStrength(float s) { m_SpecularStrength = s; }
+    void SetSpecularStrength(float s)
+    {
+        m_SpecularStrength = s;
+        FrameScheduler::RequestRedraw();
+    }
+    /// @brief Set the filter used to soften the edges of the shadows.
+    /// @param filter The shadow filter.
+    void SetShadowFilter(ShadowFilter filter)
+    {
+        m_ShadowFilter = filter;
+        FrameScheduler::RequestRedraw();
+    }
+    /// @brief Render the shadows into a prefiltered moments shadow map (EVSM) instead of a depth map.
+    /// @param format The format of the moments (`RGBA32F` or `RGBA16F`).
+    /// @note Only the lights with a single shadow map (without cascades, shadow cube or tile of a
+    /// shadow atlas) support the moments. The shadow map framebuffer of the light is replaced, so
+    /// they must be enabled before defining the shadow render passes.
+    void EnableShadowMoments(TextureFormat format = TextureFormat::RGBA32F)
+    {
+        auto& depth = m_Framebuffer->GetDepthAttachment();
+        if ((depth && depth->GetSpecification().Type != TextureType::TEXTURE2D) || m_ShadowTile.z > 0.0f)
+        {
+            CORE_WARN("Only the lights with a single shadow map can use shadow moments!");
+            return;
+        }
+        
+        const FrameBufferSpecification& spec = m_Framebuffer->GetSpec();
+        m_Moments = std::make_shared<ShadowMoments>(spec.Width, spec.Height, format);
+        m_Framebuffer = m_Moments->GetFramebuffer();
+        FrameScheduler::RequestRedraw();
+    }
     
     // Getter(s)
     // ----------------------------------------
@@ -138,6 +199,9 @@ public:
     /// @brief Get the specular strength of the light source.
     /// @return The specular strength of the light source.
     float GetSpecularStrength() const { return m_SpecularStrength; }
+    /// @brief Get the filter used to soften the edges of the shadows.
+    /// @return The shadow filter.
+    ShadowFilter GetShadowFilter() const { return m_ShadowFilter; }
     
     /// @brief Get the texture containing the shadow map of the light source.
     /// @return The shadow map.
@@ -146,12 +210,20 @@ public:
         return m_Framebuffer->GetDepthAttachment();
     }
     
+    /// @brief Get the rectangle of the shadow atlas with the shadow map of the light source.
+    /// @return The tile offset (xy) and size (zw) in texture coordinates, or zero if the light
+    /// has its own shadow map.
+    const glm::vec4& GetShadowTile() const { return m_ShadowTile; }
+    
     /// @brief Get the camera used for shadow mapping to generate depth maps for shadow calculations.
     /// @return The viewpoint of the light source.
     const std::shared_ptr<Camera>& GetShadowCamera() const { return m_ShadowCamera; }
     /// @brief Get the framebuffer with the rendered shadow map.
     /// @return The shadow map framebuffer.
     const std::shared_ptr<FrameBuffer>&  GetFramebuffer() const { return m_Framebuffer; }
+    /// @brief Get the moments shadow map of the light.
+    /// @return The shadow moments (`nullptr` if the shadows are rendered into a depth map).
+    const std::shared_ptr<ShadowMoments>& GetShadowMoments() const { return m_Moments; }
     
     // Properties
     // ----------------------------------------
@@ -180,6 +252,12 @@ public:
                         m_ShadowCamera->GetProjectionMatrix() *
                         m_ShadowCamera->GetViewMatrix());
     }
+    /// @brief Define the shadow filter (from the light) into the uniforms of the shader program.
+    /// @param shader Shader program to be used.
+    void DefineFilterProperties(const std::shared_ptr<Shader> &shader)
+    {
+        shader->SetInt("u_Light[" + std::to_string(m_ID) + "].ShadowFilter", (int)m_ShadowFilter);
+    }
     
     /// @brief Define light properties into the uniforms of the shader program.
     /// @param shader The shader program.
@@ -199,11 +277,22 @@ public:
         if (flags.ShadowProperties)
         {
             DefineTranformProperties(shader);
-            utils::Texturing::SetTextureMap(shader, "u_Light[" + std::to_string(GetID()) + "].ShadowMap",
-                                            GetShadowMap(), slot++);
+            DefineFilterProperties(shader);
+            
+            // The lights in a shadow atlas only define their tile (the atlas is bound once)
+            shader->SetVec4("u_Light[" + std::to_string(GetID()) + "].ShadowTile", m_ShadowTile);
+            if (m_Moments)
+                m_Moments->DefineProperties(shader, m_ID, slot);
+            else if (m_ShadowTile.z == 0.0f)
+                utils::Texturing::SetTextureMap(shader, "u_Light[" + std::to_string(GetID()) + "].ShadowMap",
+                                                GetShadowMap(), slot++);
         }
     }
     
+    // Friend class definition(s)
+    // ----------------------------------------
+    friend class ShadowAtlas;
+    
 protected:
     // Constructor(s)
     // ----------------------------------------
@@ -218,9 +307,12 @@ protected:
     /// @param height Framebuffer's height.
     void InitShadowMapBuffer(int width, int height)
     {
+        TextureSpecification depthSpec(TextureFormat::DEPTH24);
+        depthSpec.Compare = true;
+        
         FrameBufferSpecification spec;
         spec.SetFrameBufferSize(width, height);
-        spec.AttachmentsSpec = { TextureFormat::DEPTH24 };
+        spec.AttachmentsSpec = { depthSpec };
         m_Framebuffer = std::make_shared<FrameBuffer>(spec);
     }
     
@@ -241,10 +333,17 @@ protected:
     float m_DiffuseStrength = 0.6f;
     float m_SpecularStrength = 0.4f;
     
+    ///< The filter of the shadow edges.
+    ShadowFilter m_ShadowFilter = ShadowFilter::Grid;
+    
     ///< The light viewpoint (used for rendering shadows).
     std::shared_ptr<Camera> m_ShadowCamera;
     ///< Framebuffer to render into the shadow map.
     std::shared_ptr<FrameBuffer> m_Framebuffer;
+    ///< Rectangle of the shadow atlas with the shadow map (zero if not in an atlas).
+    glm::vec4 m_ShadowTile = glm::vec4(0.0f);
+    ///< Moments shadow map (if enabled).
+    std::shared_ptr<ShadowMoments> m_Moments;
     
     static inline unsigned int s_IndexCount = 0;
     
@@ -278,17 +377,25 @@ public:
     /// @brief Adds an object to the library.
     /// @param name The name to associate with the object.
     /// @param object The object to add.
+    /// @return The handle of the light.
     /// @note If an object with the same name already exists in the library, an assertion failure
-    /// will occur.
-    void Add(const std::string& name,
-             const std::shared_ptr<BaseLight>& light) override
+    /// will occur (the existing light is replaced when assertions are disabled).
+    LibraryHandle Add(const std::string& name,
+                      const std::shared_ptr<BaseLight>& light) override
     {
+        // Stop counting the replaced light (if any)
+        LibraryHandle existing = GetHandle(name);
+        if (existing != InvalidLibraryHandle && std::dynamic_pointer_cast<Light>(Get(existing)))
+            m_Casters--;
+        
         // Add the light to the library
-        Library::Add(name, light);
+        LibraryHandle handle = Library::Add(name, light);
         
         // Count it as light caster if necessary
         if (std::dynamic_pointer_cast<Light>(light))
             m_Casters++;
+        
+        return handle;
     }
     
     /// @brief Loads a material and adds it to the library.
@@ -302,22 +409,55 @@ public:
     {
         auto light = std::make_shared<Type>(std::forward<Args>(args)...);
         
-        std::string message = GetName() + " " + name + " is not of the specified type!";
-        CORE_ASSERT(std::dynamic_pointer_cast<BaseLight>(light), message);
+        CORE_ASSERT(std::dynamic_pointer_cast<BaseLight>(light),
+                    GetName() + " " + name + " is not of the specified type!");
         
         Add(name, light);
         return light;
     }
     
+    // Remove
+    // ----------------------------------------
+    /// @brief Removes a light from the library (and from the shadow atlas).
+    /// @param name The name of the light.
+    /// @return `true` if the light existed.
+    bool Remove(std::string_view name)
+    {
+        LibraryHandle handle = GetHandle(name);
+        if (handle == InvalidLibraryHandle)
+            return false;
+        
+        // Stop counting it as light caster, and release its tile of the atlas
+        if (auto light = std::dynamic_pointer_cast<Light>(Get(handle)))
+        {
+            m_Casters--;
+            if (m_ShadowAtlas)
+                m_ShadowAtlas->Remove(light);
+        }
+        
+        return Library::Remove(name);
+    }
+    
     // Getter(s)
     // ----------------------------------------
     /// @brief Get the number of direct lights (light casters)
     /// @return The counter of lights.
     int GetLightCastersNumber() const { return m_Casters; }
+    /// @brief Get the atlas with the shadow maps of the lights.
+    /// @return The shadow atlas (`nullptr` if each light has its own shadow map).
+    const std::shared_ptr<ShadowAtlas>& GetShadowAtlas() const { return m_ShadowAtlas; }
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Set the atlas with the shadow maps of the lights.
+    /// @param atlas The shadow atlas.
+    void SetShadowAtlas(const std::shared_ptr<ShadowAtlas>& atlas) { m_ShadowAtlas = atlas; }
     
     // Library variables
     // ----------------------------------------
 private:
     ///< Number of light casters in the library.
     int m_Casters;
+    ///< Atlas with the shadow maps of the lights (if any).
+    std::shared_ptr<ShadowAtlas> m_ShadowAtlas;
 };
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Common/Renderer/Light/Light.h"
+#include "Common/Renderer/Light/ShadowCube.h"
 
 #include "Common/Renderer/Material/SimpleMaterial.h"
 
@@ -14,7 +15,8 @@
  *
  * The `PositionalLight` class extends the `Light` base class to define a positional light source.
  * It provides methods to set and retrieve the light's position, as well as additional properties
- * such as the shadow camera and 3D model representation.
+ * such as the shadow camera and 3D model representation. The shadows can cover all the directions
+ * around the light (see `ShadowCube`), in which case the shadow camera is not used for rendering.
  *
  * Copying or moving `PositionalLight` objects is disabled to ensure single ownership and prevent
  * unintended duplication of light resources.
@@ -52,6 +54,7 @@ public:
         m_Model = utils::Geometry::ModelSphere<VertexData>(material);
         m_Model->SetScale(glm::vec3(0.25f));
         m_Model->SetPosition(position);
+        FrameScheduler::RequestRedraw();
     }
     
     /// @brief Destructor for the positional light.
@@ -66,12 +69,76 @@ public:
         m_ShadowCamera->SetPosition(position);
         m_Model->SetPosition(position);
     }
+    /// @brief Place the light at the origin of a node.
+    /// @param transform The world matrix of the node the light is attached to.
+    void SetTransform(const glm::mat4& transform) override
+    {
+        SetPosition(glm::vec3(transform[3]));
+    }
+    /// @brief Render the shadows in all the directions around the light (into a cube map).
+    /// @param resolution The size of each face of the shadow map (in pixels).
+    /// @param farPlane The far distance of the shadows.
+    /// @note The shadow map framebuffer is replaced by the layered one of the cube, so it must
+    /// be enabled before defining the shadow render pass.
+    void EnableShadowCube(unsigned int resolution = 1024, float farPlane = 25.0f)
+    {
+        m_ShadowCube = std::make_shared<ShadowCube>(resolution, 0.1f, farPlane);
+        m_ShadowCube->Update(GetPosition());
+        m_Framebuffer = m_ShadowCube->GetFramebuffer();
+        FrameScheduler::RequestRedraw();
+    }
     
     // Getter(s)
     // ----------------------------------------
     /// @brief Get the light position (x, y, z).
     /// @return The light position coordinates.
     glm::vec3 GetPosition() const { return m_Vector; }
+    /// @brief Get the omnidirectional shadow map of the light.
+    /// @return The shadow cube (`nullptr` if the shadows are rendered from the shadow camera).
+    const std::shared_ptr<ShadowCube>& GetShadowCube() const { return m_ShadowCube; }
+    
+    // Update(s)
+    // ----------------------------------------
+    /// @brief Place the faces of the omnidirectional shadow map at the position of the light.
+    /// @return `true` if the shadow cube has been modified.
+    bool UpdateShadowCube()
+    {
+        return m_ShadowCube && m_ShadowCube->Update(GetPosition());
+    }
+    
+    // Properties
+    // ----------------------------------------
+    /// @brief Define light properties into the uniforms of the shader program.
+    /// @param shader The shader program.
+    /// @param flags The flags indicating which light properties should be defined.
+    void DefineLightProperties(const std::shared_ptr<Shader>& shader,
+                               const LightFlags& flags,
+                               unsigned int& slot) override
+    {
+        if (!m_ShadowCube)
+        {
+            Light::DefineLightProperties(shader, flags, slot);
+            return;
+        }
+        
+        // The shadow cube replaces the shadow map of the light
+        LightFlags lightFlags = flags;
+        lightFlags.ShadowProperties = false;
+        Light::DefineLightProperties(shader, lightFlags, slot);
+        
+        if (flags.ShadowProperties)
+        {
+            DefineTranformProperties(shader);
+            DefineFilterProperties(shader);
+            m_ShadowCube->DefineProperties(shader, m_ID, slot);
+        }
+    }
+    
+    // Light variables
+    // ----------------------------------------
+private:
+    ///< Omnidirectional shadow map (if enabled).
+    std::shared_ptr<ShadowCube> m_ShadowCube;
     
     // Disable the copying or moving of this resource
     // ----------------------------------------
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+/**
+ * Projects an environment map onto the spherical harmonics basis on the CPU.
+ *
+ * The `SHProjection` class integrates an equirectangular (latitude-longitude) image onto the first
+ * nine spherical harmonics (bands 0 to 2), which are the coefficients used by `SHCoefficients`. Each
+ * texel is weighted by its exact solid angle, so the integral does not depend on a sampling pattern.
+ * The basis is evaluated for several texels at once with SIMD instructions (AVX or SSE, when they
+ * are available). The rows of the image are distributed over the threads of the `JobSystem`, and
+ * their partial sums are reduced in a fixed order, so the result does not depend on the number of
+ * threads. No GL context is needed.
+ */
+class SHProjection
+{
+public:
+    ///< Number of coefficients of each color channel (bands 0 to 2).
+    static constexpr unsigned int CoefficientCount = 9;
+    
+    // Projection
+    // ----------------------------------------
+    static std::vector<float> ProjectEquirectangular(const float* data, unsigned int width,
+                                                     unsigned int height, unsigned int channels,
+                                                     const glm::mat3& rotation = glm::mat3(1.0f));
+    static std::vector<float> ProjectEquirectangular(const std::filesystem::path& filePath,
+                                                     bool flip = true,
+                                                     const glm::mat3& rotation = glm::mat3(1.0f));
+};
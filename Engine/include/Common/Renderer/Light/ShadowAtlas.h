@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Common/Renderer/Shader/Shader.h"
+#include "Common/Renderer/Buffer/FrameBuffer.h"
+#include "Common/Renderer/Camera/Camera.h"
+
+#include <glm/glm.hpp>
+
+class Light;
+
+/**
+ * Packs the shadow maps of several lights into the tiles of a single depth texture.
+ *
+ * The `ShadowAtlas` class assigns a square tile of a shared depth texture to each of its lights.
+ * The size of a tile (a power of two) depends on the importance of the light and on its coverage of
+ * the view (the directional lights cover all of it, the positional lights less as they get farther
+ * from the camera). The tiles are sorted by size and placed along a Z-order curve, so they never
+ * overlap and the atlas is filled without gaps. When the tiles do not fit, the largest ones (or the
+ * least important ones, for the same size) are halved.
+ *
+ * The shadow casters of all the lights are rendered in a single pass: the geometry shader of
+ * `DepthMapAtlas.glsl` replicates each primitive for every light, maps it into the tile of the light
+ * and clips it to the tile borders. The shading materials bind the atlas once (`u_ShadowAtlas`),
+ * and each light only defines the rectangle of its tile (`u_Light[i].ShadowTile`).
+ *
+ * Copying or moving `ShadowAtlas` objects is disabled to ensure single ownership and prevent
+ * unintended duplication of the shadow map resources.
+ */
+class ShadowAtlas
+{
+public:
+    ///< Maximum number of lights in the atlas (matches the lights supported by the shaders).
+    static constexpr unsigned int MaxTiles = 4;
+    
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    ShadowAtlas(unsigned int size = 4096, unsigned int minTileSize = 256);
+    /// @brief Delete the shadow atlas.
+    ~ShadowAtlas() = default;
+    
+    // Lights
+    // ----------------------------------------
+    void Add(const std::shared_ptr<Light>& light, float importance = 1.0f);
+    void Remove(const std::shared_ptr<Light>& light);
+    void SetImportance(const std::shared_ptr<Light>& light, float importance);
+    
+    // Update
+    // ----------------------------------------
+    bool Update(const Camera& camera);
+    
+    // Properties
+    // ----------------------------------------
+    void DefineProperties(const std::shared_ptr<Shader>& shader, unsigned int& slot) const;
+    void DefineDepthProperties(const std::shared_ptr<Shader>& shader) const;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the size of the atlas.
+    /// @return The size of the depth texture (in pixels).
+    unsigned int GetSize() const { return m_Size; }
+    /// @brief Get the number of lights in the atlas.
+    /// @return The number of tiles.
+    unsigned int GetTileCount() const { return (unsigned int)m_Tiles.size(); }
+    /// @brief Get the size of the tile of a light.
+    /// @param index The tile index (in the order the lights were added).
+    /// @return The size of the tile (in pixels).
+    unsigned int GetTileSize(unsigned int index) const { return m_Tiles[index].Size; }
+    int GetTileIndex(const std::shared_ptr<Light>& light) const;
+    
+    /// @brief Get the framebuffer with the atlas.
+    /// @return The atlas framebuffer.
+    const std::shared_ptr<FrameBuffer>& GetFramebuffer() const { return m_Framebuffer; }
+    /// @brief Get the depth texture with the shadow maps of all the lights.
+    /// @return The atlas texture.
+    const std::shared_ptr<Texture>& GetShadowMap() const { return m_Framebuffer->GetDepthAttachment(); }
+
+private:
+    // Packing
+    // ----------------------------------------
+    void Pack();
+    
+    // Shadow atlas structures
+    // ----------------------------------------
+private:
+    /**
+     * Represents the tile assigned to a light.
+     */
+    struct Tile
+    {
+        ///< Light rendering its shadow map into the tile.
+        std::shared_ptr<Light> Source;
+        ///< Importance of the light (relative to the other lights).
+        float Importance = 1.0f;
+        
+        ///< Size of the tile (in pixels).
+        unsigned int Size = 0;
+        ///< Position of the lower-left corner of the tile (in pixels).
+        glm::uvec2 Offset = glm::uvec2(0);
+        ///< View-projection matrix of the light in the last update.
+        glm::mat4 Transform = glm::mat4(0.0f);
+    };
+    
+    // Shadow atlas variables
+    // ----------------------------------------
+private:
+    ///< Size of the atlas (in pixels).
+    unsigned int m_Size;
+    ///< Size of the smallest tile (in pixels).
+    unsigned int m_MinTileSize;
+    
+    ///< Tiles of the lights.
+    std::vector<Tile> m_Tiles;
+    
+    ///< Framebuffer with the atlas.
+    std::shared_ptr<FrameBuffer> m_Framebuffer;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    ShadowAtlas(const ShadowAtlas&) = delete;
+    ShadowAtlas(ShadowAtlas&&) = delete;
+    
+    ShadowAtlas& operator=(const ShadowAtlas&) = delete;
+    ShadowAtlas& operator=(ShadowAtlas&&) = delete;
+};
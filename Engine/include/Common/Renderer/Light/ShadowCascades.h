@@ -0,0 +1,137 @@
+#pragma once
+
+#include "Common/Renderer/Shader/Shader.h"
+#include "Common/Renderer/Buffer/FrameBuffer.h"
+#include "Common/Renderer/Camera/Camera.h"
+#include "Common/Renderer/Model/Model.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * Splits the shadow map of a directional light into cascades covering the view of a camera.
+ *
+ * The `ShadowCascades` class divides the view frustum of a camera (up to a shadow distance) into
+ * consecutive depth ranges, using a blend between a logarithmic and a uniform split scheme. Each
+ * cascade is rendered into a layer of a depth texture array with an orthographic projection fitted
+ * to its sub-frustum: the width is defined by the bounding sphere of the sub-frustum (so it does not
+ * change when the camera rotates) and the center is snapped to the texel grid of the shadow map
+ * (so the shadows do not shimmer when the camera moves). The depth range covers the sub-frustum and
+ * the shadow casters in front of it. All the layers are rendered in a single pass (the geometry
+ * shader of `DepthMapCascades.glsl` replicates each primitive in every cascade).
+ *
+ * Copying or moving `ShadowCascades` objects is disabled to ensure single ownership and prevent
+ * unintended duplication of the shadow map resources.
+ */
+class ShadowCascades
+{
+public:
+    ///< Maximum number of cascades (layers of the shadow map).
+    static constexpr unsigned int MaxCascades = 4;
+    
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    ShadowCascades(unsigned int resolution, unsigned int count = MaxCascades);
+    /// @brief Delete the shadow cascades.
+    ~ShadowCascades() = default;
+    
+    // Update
+    // ----------------------------------------
+    bool Update(const Camera& camera, const glm::vec3& direction, const BBox& casters);
+    
+    // Properties
+    // ----------------------------------------
+    void DefineProperties(const std::shared_ptr<Shader>& shader, unsigned int light,
+                          unsigned int& slot) const;
+    void DefineDepthProperties(const std::shared_ptr<Shader>& shader) const;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the number of cascades in use.
+    /// @return The number of cascades.
+    unsigned int GetCount() const { return m_Count; }
+    /// @brief Get the size of each layer of the shadow map.
+    /// @return The resolution (in pixels).
+    unsigned int GetResolution() const { return m_Resolution; }
+    /// @brief Get the weight of the logarithmic split scheme.
+    /// @return The split weight (0 for uniform splits, 1 for logarithmic splits).
+    float GetSplitLambda() const { return m_SplitLambda; }
+    /// @brief Get the maximum distance to the camera with shadows.
+    /// @return The shadow distance.
+    float GetShadowDistance() const { return m_ShadowDistance; }
+    /// @brief Get the fraction of each cascade that is blended with the next one.
+    /// @return The blend range (between 0 and 1).
+    float GetBlendRange() const { return m_BlendRange; }
+    
+    /// @brief Get the far distance (view depth) of a cascade.
+    /// @param index The cascade index.
+    /// @return The split distance.
+    float GetSplit(unsigned int index) const { return m_Splits[index]; }
+    /// @brief Get the light matrix (projection and view) of a cascade.
+    /// @param index The cascade index.
+    /// @return The transformation from world space to the cascade clip space.
+    const glm::mat4& GetTransform(unsigned int index) const { return m_Transforms[index]; }
+    
+    /// @brief Get the center of the sphere enclosing all the cascades.
+    /// @return The center (in world space).
+    const glm::vec3& GetCenter() const { return m_Center; }
+    /// @brief Get the radius of the sphere enclosing all the cascades.
+    /// @return The radius.
+    float GetRadius() const { return m_Radius; }
+    /// @brief Get the distance from the center to the farthest shadow caster (towards the light).
+    /// @return The caster distance.
+    float GetCasterDistance() const { return m_CasterDistance; }
+    
+    /// @brief Get the framebuffer with the layered shadow map.
+    /// @return The shadow map framebuffer.
+    const std::shared_ptr<FrameBuffer>& GetFramebuffer() const { return m_Framebuffer; }
+    /// @brief Get the depth texture array with the cascades.
+    /// @return The shadow map.
+    const std::shared_ptr<Texture>& GetShadowMap() const { return m_Framebuffer->GetDepthAttachment(); }
+    
+    // Setter(s)
+    // ----------------------------------------
+    void SetCount(unsigned int count);
+    void SetSplitLambda(float lambda);
+    void SetShadowDistance(float distance);
+    void SetBlendRange(float range);
+    
+    // Shadow cascades variables
+    // ----------------------------------------
+private:
+    ///< Number of cascades in use.
+    unsigned int m_Count;
+    ///< Size of each layer of the shadow map.
+    unsigned int m_Resolution;
+    
+    ///< Weight of the logarithmic split scheme.
+    float m_SplitLambda = 0.75f;
+    ///< Maximum distance to the camera with shadows.
+    float m_ShadowDistance = 50.0f;
+    ///< Fraction of each cascade blended with the next one.
+    float m_BlendRange = 0.1f;
+    
+    ///< Far distance (view depth) of each cascade.
+    std::array<float, MaxCascades> m_Splits = {};
+    ///< Light matrix (projection and view) of each cascade.
+    std::array<glm::mat4, MaxCascades> m_Transforms = {};
+    ///< View matrix of the camera the cascades have been fitted to.
+    glm::mat4 m_View = glm::mat4(1.0f);
+    
+    ///< Sphere enclosing all the cascades.
+    glm::vec3 m_Center = glm::vec3(0.0f);
+    float m_Radius = 0.0f;
+    ///< Distance from the center to the farthest shadow caster (towards the light).
+    float m_CasterDistance = 0.0f;
+    
+    ///< Framebuffer with the layered shadow map.
+    std::shared_ptr<FrameBuffer> m_Framebuffer;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    ShadowCascades(const ShadowCascades&) = delete;
+    ShadowCascades(ShadowCascades&&) = delete;
+    
+    ShadowCascades& operator=(const ShadowCascades&) = delete;
+    ShadowCascades& operator=(ShadowCascades&&) = delete;
+};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Common/Renderer/Shader/Shader.h"
+#include "Common/Renderer/Buffer/FrameBuffer.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * Renders the omnidirectional shadow map of a positional light.
+ *
+ * The `ShadowCube` class covers all the directions around a positional light with the six faces of
+ * a depth cube map. Each face stores the linear distance to the light (normalized by the far
+ * distance of the shadows) instead of the non-linear depth of a perspective projection, so the
+ * precision does not drop far away from the light. All the faces are rendered in a single pass: the
+ * geometry shader of `DepthMapCube.glsl` replicates each primitive in every face whose frustum it
+ * intersects (the primitives outside of a face are culled before being rasterized).
+ *
+ * Copying or moving `ShadowCube` objects is disabled to ensure single ownership and prevent
+ * unintended duplication of the shadow map resources.
+ */
+class ShadowCube
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    ShadowCube(unsigned int resolution, float nearPlane = 0.1f, float farPlane = 25.0f);
+    /// @brief Delete the shadow cube.
+    ~ShadowCube() = default;
+    
+    // Update
+    // ----------------------------------------
+    bool Update(const glm::vec3& position);
+    
+    // Properties
+    // ----------------------------------------
+    void DefineProperties(const std::shared_ptr<Shader>& shader, unsigned int light,
+                          unsigned int& slot) const;
+    void DefineDepthProperties(const std::shared_ptr<Shader>& shader) const;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the size of each face of the shadow map.
+    /// @return The resolution (in pixels).
+    unsigned int GetResolution() const { return m_Resolution; }
+    /// @brief Get the near distance of the shadows.
+    /// @return The near plane of the faces.
+    float GetNearPlane() const { return m_NearPlane; }
+    /// @brief Get the far distance of the shadows.
+    /// @return The far plane of the faces (the stored distances are normalized by it).
+    float GetFarPlane() const { return m_FarPlane; }
+    
+    /// @brief Get the light matrix (projection and view) of a face.
+    /// @param face The face index (+X, -X, +Y, -Y, +Z, -Z).
+    /// @return The transformation from world space to the face clip space.
+    const glm::mat4& GetTransform(unsigned int face) const { return m_Transforms[face]; }
+    
+    /// @brief Get the framebuffer with the layered shadow map.
+    /// @return The shadow map framebuffer.
+    const std::shared_ptr<FrameBuffer>& GetFramebuffer() const { return m_Framebuffer; }
+    /// @brief Get the depth cube map with the distances to the light.
+    /// @return The shadow map.
+    const std::shared_ptr<Texture>& GetShadowMap() const { return m_Framebuffer->GetDepthAttachment(); }
+    
+    // Setter(s)
+    // ----------------------------------------
+    void SetRange(float nearPlane, float farPlane);
+    
+    // Shadow cube variables
+    // ----------------------------------------
+private:
+    ///< Size of each face of the shadow map.
+    unsigned int m_Resolution;
+    
+    ///< Near and far distances of the shadows.
+    float m_NearPlane;
+    float m_FarPlane;
+    
+    ///< Position of the light.
+    glm::vec3 m_Position = glm::vec3(0.0f);
+    ///< Light matrix (projection and view) of each face.
+    std::array<glm::mat4, 6> m_Transforms = {};
+    
+    ///< Framebuffer with the layered shadow map.
+    std::shared_ptr<FrameBuffer> m_Framebuffer;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    ShadowCube(const ShadowCube&) = delete;
+    ShadowCube(ShadowCube&&) = delete;
+    
+    ShadowCube& operator=(const ShadowCube&) = delete;
+    ShadowCube& operator=(ShadowCube&&) = delete;
+};
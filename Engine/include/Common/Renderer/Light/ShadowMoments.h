@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Common/Renderer/Shader/Shader.h"
+#include "Common/Renderer/Buffer/FrameBuffer.h"
+#include "Common/Renderer/Model/Model.h"
+#include "Common/Renderer/Material/BlurMaterial.h"
+
+#include <glm/glm.hpp>
+
+/**
+ * Renders a prefilterable shadow map with the moments of the depth (exponential variance shadow
+ * map, EVSM).
+ *
+ * The `ShadowMoments` class stores, for each texel of the shadow map of a light, the first two
+ * moments of the depth warped with a positive and a negative exponential. Unlike the depth, the
+ * moments can be filtered before shading: the map is blurred with a separable Gaussian kernel (two
+ * passes of `BlurFilter.glsl`) and mipmapped, so the shadow of a fragment is estimated from a single
+ * (trilinear) sample with Chebyshev's inequality, and the cost per pixel does not depend on the size
+ * of the penumbra.
+ *
+ * The moments are stored in 32-bit floats by default. Half floats use half of the memory and
+ * bandwidth, but their range limits the exponents (and, therefore, the light bleeding reduction
+ * of the warp). The light bleeding that remains (where several occluders overlap) is reduced by
+ * removing the tail of the estimated probability.
+ *
+ * Copying or moving `ShadowMoments` objects is disabled to ensure single ownership and prevent
+ * unintended duplication of the shadow map resources.
+ */
+class ShadowMoments
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    ShadowMoments(unsigned int width, unsigned int height,
+                  TextureFormat format = TextureFormat::RGBA32F);
+    /// @brief Delete the shadow moments.
+    ~ShadowMoments() = default;
+    
+    // Update
+    // ----------------------------------------
+    bool Update();
+    void Filter();
+    
+    // Properties
+    // ----------------------------------------
+    void DefineProperties(const std::shared_ptr<Shader>& shader, unsigned int light,
+                          unsigned int& slot) const;
+    void DefineDepthProperties(const std::shared_ptr<Shader>& shader) const;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the positive and negative exponents of the depth warp.
+    /// @return The exponents (positive, negative).
+    glm::vec2 GetExponents() const { return m_Exponents; }
+    /// @brief Get the amount of light bleeding reduction.
+    /// @return The fraction of the probability removed (between 0 and 1).
+    float GetBleedingReduction() const { return m_BleedingReduction; }
+    /// @brief Get the radius of the blur applied to the moments.
+    /// @return The radius (in texels).
+    unsigned int GetBlurRadius() const { return m_BlurRadius; }
+    /// @brief Get the moments of a fragment at the far plane (the clear value of the map).
+    /// @return The moments of the maximum depth.
+    glm::vec4 GetClearValue() const;
+    
+    /// @brief Get the framebuffer the moments are rendered into.
+    /// @return The (unfiltered) moments framebuffer.
+    const std::shared_ptr<FrameBuffer>& GetFramebuffer() const { return m_Framebuffer; }
+    /// @brief Get the prefiltered (blurred and mipmapped) moments.
+    /// @return The moments shadow map.
+    const std::shared_ptr<Texture>& GetMomentsMap() const
+    {
+        return m_FilteredFramebuffer->GetColorAttachment(0);
+    }
+    
+    // Setter(s)
+    // ----------------------------------------
+    void SetExponents(const glm::vec2& exponents);
+    void SetBleedingReduction(float amount);
+    void SetBlurRadius(unsigned int radius);
+    
+    // Shadow moments variables
+    // ----------------------------------------
+private:
+    ///< Format of the moments.
+    TextureFormat m_Format;
+    
+    ///< Positive and negative exponents of the depth warp.
+    glm::vec2 m_Exponents;
+    ///< Fraction of the probability removed to reduce the light bleeding.
+    float m_BleedingReduction = 0.2f;
+    ///< Radius of the blur (in texels).
+    unsigned int m_BlurRadius = 2;
+    ///< The moments must be rendered again (e.g., after modifying the exponents).
+    bool m_Modified = true;
+    
+    ///< Framebuffer with the rendered moments (and the depth of the occluders).
+    std::shared_ptr<FrameBuffer> m_Framebuffer;
+    ///< Framebuffer with the moments blurred horizontally.
+    std::shared_ptr<FrameBuffer> m_BlurFramebuffer;
+    ///< Framebuffer with the blurred and mipmapped moments.
+    std::shared_ptr<FrameBuffer> m_FilteredFramebuffer;
+    
+    ///< Material and geometry of the blur passes.
+    std::shared_ptr<BlurMaterial> m_BlurMaterial;
+    std::shared_ptr<BaseModel> m_Geometry;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    ShadowMoments(const ShadowMoments&) = delete;
+    ShadowMoments(ShadowMoments&&) = delete;
+    
+    ShadowMoments& operator=(const ShadowMoments&) = delete;
+    ShadowMoments& operator=(ShadowMoments&&) = delete;
+};
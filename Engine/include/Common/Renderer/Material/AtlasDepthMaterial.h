@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Common/Renderer/Material/Material.h"
+
+#include "Common/Renderer/Light/ShadowAtlas.h"
+
+/**
+ * A material class to render the depth of a scene into all the tiles of a shadow atlas.
+ *
+ * The `AtlasDepthMaterial` class is a subclass of `Material` that defines the light matrices and
+ * the tiles of a `ShadowAtlas`, so that the shadow maps of all its lights are rendered in a single
+ * pass. The shader clips each primitive to the tile of its light, so the first four clip distances
+ * must be enabled while rendering (see `Renderer::SetClipDistances`). Each model is only replicated
+ * into the tiles of the lights it casts shadows for (see `SetTileMask`).
+ *
+ * Copying or moving `AtlasDepthMaterial` objects is disabled to ensure single ownership and
+ * prevent unintended duplication of material resources.
+ */
+class AtlasDepthMaterial : public Material
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate an atlas depth material with the specified shader file path.
+    /// @param atlas The shadow atlas to be rendered.
+    /// @param filePath The file path to the shader used by the material.
+    AtlasDepthMaterial(const std::shared_ptr<ShadowAtlas>& atlas,
+                       const std::filesystem::path& filePath =
+                       std::filesystem::path("Resources/shaders/depth/DepthMapAtlas.glsl"))
+        : Material(filePath), m_Atlas(atlas)
+    {}
+    /// @brief Destructor for the atlas depth material.
+    ~AtlasDepthMaterial() override = default;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the shadow atlas rendered by the material.
+    /// @return The shadow atlas.
+    const std::shared_ptr<ShadowAtlas>& GetAtlas() const { return m_Atlas; }
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Select the tiles the next models are rendered into.
+    /// @param mask The tiles of the lights (one bit per tile index).
+    void SetTileMask(uint32_t mask) { m_TileMask = mask; }
+    
+    // Properties
+    // ----------------------------------------
+    /// @brief Set the material properties into the uniforms of the shader program.
+    void SetMaterialProperties() override
+    {
+        m_Atlas->DefineDepthProperties(m_Shader);
+        m_Shader->SetInt("u_TileMask", (int)m_TileMask);
+    }
+    
+    // Atlas depth material variables
+    // ----------------------------------------
+protected:
+    ///< Shadow atlas to be rendered.
+    std::shared_ptr<ShadowAtlas> m_Atlas;
+    ///< Tiles the models are rendered into (one bit per tile index).
+    uint32_t m_TileMask = ~0u;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    AtlasDepthMaterial(const AtlasDepthMaterial&) = delete;
+    AtlasDepthMaterial(AtlasDepthMaterial&&) = delete;
+    
+    AtlasDepthMaterial& operator=(const AtlasDepthMaterial&) = delete;
+    AtlasDepthMaterial& operator=(AtlasDepthMaterial&&) = delete;
+};
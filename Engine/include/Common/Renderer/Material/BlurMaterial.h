@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Common/Renderer/Material/SimpleMaterial.h"
+
+/**
+ * A material class to blur a texture along one direction.
+ *
+ * The `BlurMaterial` class is a subclass of `SimpleTextureMaterial` that applies one of the two
+ * passes of a separable Gaussian blur (`BlurFilter.glsl`). The texture is blurred horizontally
+ * first and the result vertically, so the cost grows with the radius instead of its square. All
+ * the channels of the texture are blurred (e.g., the moments of a shadow map).
+ *
+ * Copying or moving `BlurMaterial` objects is disabled to ensure single ownership and
+ * prevent unintended duplication of material resources.
+ */
+class BlurMaterial : public SimpleTextureMaterial
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate a blur material with the specified shader file path.
+    /// @param filePath The file path to the shader used by the material.
+    BlurMaterial(const std::filesystem::path& filePath =
+                 std::filesystem::path("Resources/shaders/filters/BlurFilter.glsl"))
+        : SimpleTextureMaterial(filePath)
+    {}
+    /// @brief Destructor for the blur material.
+    ~BlurMaterial() override = default;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the direction of the blur.
+    /// @return The direction (one texel along x or y).
+    glm::vec2 GetDirection() const { return m_Direction; }
+    /// @brief Get the radius of the blur.
+    /// @return The radius (in texels).
+    unsigned int GetRadius() const { return m_Radius; }
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Set the direction of the blur.
+    /// @param direction The direction (one texel along x or y).
+    void SetDirection(const glm::vec2& direction) { m_Direction = direction; }
+    /// @brief Set the radius of the blur.
+    /// @param radius The radius (in texels).
+    void SetRadius(unsigned int radius) { m_Radius = radius; }
+
+protected:
+    // Properties
+    // ----------------------------------------
+    /// @brief Set the material properties into the uniforms of the shader program.
+    void SetMaterialProperties() override
+    {
+        SimpleTextureMaterial::SetMaterialProperties();
+        m_Shader->SetVec2("u_Direction", m_Direction);
+        m_Shader->SetInt("u_Radius", (int)m_Radius);
+    }
+    
+    // Blur material variables
+    // ----------------------------------------
+protected:
+    ///< Direction of the blur.
+    glm::vec2 m_Direction = glm::vec2(1.0f, 0.0f);
+    ///< Radius of the blur (in texels).
+    unsigned int m_Radius = 2;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    BlurMaterial(const BlurMaterial&) = delete;
+    BlurMaterial(BlurMaterial&&) = delete;
+    
+    BlurMaterial& operator=(const BlurMaterial&) = delete;
+    BlurMaterial& operator=(BlurMaterial&&) = delete;
+};
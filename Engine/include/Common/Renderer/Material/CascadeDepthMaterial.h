@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Common/Renderer/Material/Material.h"
+
+#include "Common/Renderer/Light/ShadowCascades.h"
+
+/**
+ * A material class to render the depth of a scene into all the shadow cascades of a light.
+ *
+ * The `CascadeDepthMaterial` class is a subclass of `Material` that defines the light matrices
+ * of a set of `ShadowCascades`, so that each primitive is rendered into every layer of the
+ * shadow map in a single pass.
+ *
+ * Copying or moving `CascadeDepthMaterial` objects is disabled to ensure single ownership and
+ * prevent unintended duplication of material resources.
+ */
+class CascadeDepthMaterial : public Material
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate a cascade depth material with the specified shader file path.
+    /// @param cascades The shadow cascades to be rendered.
+    /// @param filePath The file path to the shader used by the material.
+    CascadeDepthMaterial(const std::shared_ptr<ShadowCascades>& cascades,
+                         const std::filesystem::path& filePath =
+                         std::filesystem::path("Resources/shaders/depth/DepthMapCascades.glsl"))
+        : Material(filePath), m_Cascades(cascades)
+    {}
+    /// @brief Destructor for the cascade depth material.
+    ~CascadeDepthMaterial() override = default;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the shadow cascades rendered by the material.
+    /// @return The shadow cascades.
+    const std::shared_ptr<ShadowCascades>& GetCascades() const { return m_Cascades; }
+    
+    // Properties
+    // ----------------------------------------
+    /// @brief Set the material properties into the uniforms of the shader program.
+    void SetMaterialProperties() override
+    {
+        m_Cascades->DefineDepthProperties(m_Shader);
+    }
+    
+    // Cascade depth material variables
+    // ----------------------------------------
+protected:
+    ///< Shadow cascades to be rendered.
+    std::shared_ptr<ShadowCascades> m_Cascades;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    CascadeDepthMaterial(const CascadeDepthMaterial&) = delete;
+    CascadeDepthMaterial(CascadeDepthMaterial&&) = delete;
+    
+    CascadeDepthMaterial& operator=(const CascadeDepthMaterial&) = delete;
+    CascadeDepthMaterial& operator=(CascadeDepthMaterial&&) = delete;
+};
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Common/Renderer/Material/Material.h"
+
+#include "Common/Renderer/Light/ShadowCube.h"
+
+/**
+ * A material class to render the distances of a scene to a light into all the faces of its
+ * omnidirectional shadow map.
+ *
+ * The `CubeDepthMaterial` class is a subclass of `Material` that defines the position and the
+ * face matrices of a `ShadowCube`, so that each primitive is rendered into every face of the
+ * shadow map in a single pass.
+ *
+ * Copying or moving `CubeDepthMaterial` objects is disabled to ensure single ownership and
+ * prevent unintended duplication of material resources.
+ */
+class CubeDepthMaterial : public Material
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate a cube depth material with the specified shader file path.
+    /// @param cube The omnidirectional shadow map to be rendered.
+    /// @param filePath The file path to the shader used by the material.
+    CubeDepthMaterial(const std::shared_ptr<ShadowCube>& cube,
+                      const std::filesystem::path& filePath =
+                      std::filesystem::path("Resources/shaders/depth/DepthMapCube.glsl"))
+        : Material(filePath), m_Cube(cube)
+    {}
+    /// @brief Destructor for the cube depth material.
+    ~CubeDepthMaterial() override = default;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the omnidirectional shadow map rendered by the material.
+    /// @return The shadow cube.
+    const std::shared_ptr<ShadowCube>& GetCube() const { return m_Cube; }
+    
+    // Properties
+    // ----------------------------------------
+    /// @brief Set the material properties into the uniforms of the shader program.
+    void SetMaterialProperties() override
+    {
+        m_Cube->DefineDepthProperties(m_Shader);
+    }
+    
+    // Cube depth material variables
+    // ----------------------------------------
+protected:
+    ///< Omnidirectional shadow map to be rendered.
+    std::shared_ptr<ShadowCube> m_Cube;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    CubeDepthMaterial(const CubeDepthMaterial&) = delete;
+    CubeDepthMaterial(CubeDepthMaterial&&) = delete;
+    
+    CubeDepthMaterial& operator=(const CubeDepthMaterial&) = delete;
+    CubeDepthMaterial& operator=(CubeDepthMaterial&&) = delete;
+};
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Common/Renderer/Material/SimpleMaterial.h"
+
+/**
+ * A material class to render a texture into all the faces of a cube map.
+ *
+ * The `CubeMapMaterial` class is a subclass of `SimpleTextureMaterial` that defines the
+ * view-projection matrix of each face of a cube map. The geometry shader of the material replicates
+ * each primitive in every face (`gl_Layer`), so the cube map is rendered in a single draw into a
+ * layered framebuffer attachment.
+ *
+ * Copying or moving `CubeMapMaterial` objects is disabled to ensure single ownership and
+ * prevent unintended duplication of material resources.
+ */
+class CubeMapMaterial : public SimpleTextureMaterial
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate a cube map material with the specified shader file path.
+    /// @param filePath The file path to the shader used by the material.
+    CubeMapMaterial(const std::filesystem::path& filePath =
+                    std::filesystem::path("Resources/shaders/environment/EquirectangularMap.glsl"))
+        : SimpleTextureMaterial(filePath)
+    {}
+    /// @brief Destructor for the cube map material.
+    ~CubeMapMaterial() override = default;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the view-projection matrix of a face.
+    /// @param face The face index (+X, -X, +Y, -Y, +Z, -Z).
+    /// @return The transformation from world space to the face clip space.
+    const glm::mat4& GetTransform(unsigned int face) const { return m_Transforms[face]; }
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Set the view-projection matrices of the faces.
+    /// @param transforms The matrices of the faces (+X, -X, +Y, -Y, +Z, -Z).
+    void SetTransforms(const std::array<glm::mat4, 6>& transforms) { m_Transforms = transforms; }
+
+protected:
+    // Properties
+    // ----------------------------------------
+    /// @brief Set the material properties into the uniforms of the shader program.
+    void SetMaterialProperties() override
+    {
+        SimpleTextureMaterial::SetMaterialProperties();
+        for (unsigned int face = 0; face < 6; face++)
+            m_Shader->SetMat4("u_CubeTransform.ViewProjection[" + std::to_string(face) + "]",
+                              m_Transforms[face]);
+    }
+    
+    // Cube map material variables
+    // ----------------------------------------
+protected:
+    ///< View-projection matrix of each face.
+    std::array<glm::mat4, 6> m_Transforms = {};
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    CubeMapMaterial(const CubeMapMaterial&) = delete;
+    CubeMapMaterial(CubeMapMaterial&&) = delete;
+    
+    CubeMapMaterial& operator=(const CubeMapMaterial&) = delete;
+    CubeMapMaterial& operator=(CubeMapMaterial&&) = delete;
+};
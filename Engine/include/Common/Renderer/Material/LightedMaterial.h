@@ -58,6 +58,36 @@ public:
         m_Shader->Bind();
         m_Shader->SetInt("u_Environment.LightsNumber", lights.GetLightCastersNumber());
         
+        // Disable the shadow cascades unless a light defines them (their sampler keeps its
+        // own slot, so it never shares a texture unit with the samplers of other types)
+        if (m_LightFlags.ShadowProperties)
+        {
+            m_Shader->SetInt("u_Cascades.Count", 0);
+            m_Shader->SetInt("u_Cascades.ShadowMap", m_Slot++);
+            
+            // The same applies to the omnidirectional shadow maps and to the (compared) shadow maps
+            // and atlas, shared by the lights without them
+            unsigned int cubeSlot = m_Slot++;
+            unsigned int mapSlot = m_Slot++;
+            m_Shader->SetInt("u_ShadowAtlas", mapSlot);
+            for (auto& pair : lights)
+            {
+                auto light = std::dynamic_pointer_cast<Light>(pair.second);
+                if (!light)
+                    continue;
+                
+                m_Shader->SetFloat("u_Light[" + std::to_string(light->GetID()) + "].ShadowFar", 0.0f);
+                m_Shader->SetInt("u_Light[" + std::to_string(light->GetID()) + "].ShadowCube", cubeSlot);
+                m_Shader->SetInt("u_Light[" + std::to_string(light->GetID()) + "].ShadowMap", mapSlot);
+                m_Shader->SetVec4("u_Light[" + std::to_string(light->GetID()) + "].ShadowMoments",
+                                  glm::vec4(0.0f));
+            }
+        }
+        
+        // The shadow atlas is shared by all the lights (so it is bound only once)
+        if (m_LightFlags.ShadowProperties && lights.GetShadowAtlas())
+            lights.GetShadowAtlas()->DefineProperties(m_Shader, m_Slot);
+        
         // Iterate through each light in the scene
         for (auto& pair : lights)
             DefineLightProperties(pair.second);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Common/Core/Library.h"
+#include "Common/Core/FrameScheduler.h"
 #include "Common/Renderer/Shader/Shader.h"
 #include "Common/Renderer/Texture/Texture.h"
 
@@ -160,8 +161,8 @@ public:
     {
         auto material = std::make_shared<Type>(std::forward<Args>(args)...);
         
-        std::string message = GetName() + " " + name + " is not of the specified type!";
-        CORE_ASSERT(std::dynamic_pointer_cast<Material>(material), message);
+        CORE_ASSERT(std::dynamic_pointer_cast<Material>(material),
+                    GetName() + " " + name + " is not of the specified type!");
         
         Add(name, material);
         return material;
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Common/Renderer/Material/Material.h"
+
+#include "Common/Renderer/Light/ShadowMoments.h"
+
+/**
+ * A material class to render the moments of the warped depth of a scene into a moments shadow
+ * map.
+ *
+ * The `MomentsDepthMaterial` class is a subclass of `Material` that defines the exponents of a
+ * `ShadowMoments`, so that each fragment stores the moments of its exponentially warped depth
+ * instead of the depth itself.
+ *
+ * Copying or moving `MomentsDepthMaterial` objects is disabled to ensure single ownership and
+ * prevent unintended duplication of material resources.
+ */
+class MomentsDepthMaterial : public Material
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate a moments depth material with the specified shader file path.
+    /// @param moments The moments shadow map to be rendered.
+    /// @param filePath The file path to the shader used by the material.
+    MomentsDepthMaterial(const std::shared_ptr<ShadowMoments>& moments,
+                         const std::filesystem::path& filePath =
+                         std::filesystem::path("Resources/shaders/depth/MomentsMap.glsl"))
+        : Material(filePath), m_Moments(moments)
+    {}
+    /// @brief Destructor for the moments depth material.
+    ~MomentsDepthMaterial() override = default;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the moments shadow map rendered by the material.
+    /// @return The shadow moments.
+    const std::shared_ptr<ShadowMoments>& GetMoments() const { return m_Moments; }
+    
+    // Properties
+    // ----------------------------------------
+    /// @brief Set the material properties into the uniforms of the shader program.
+    void SetMaterialProperties() override
+    {
+        m_Moments->DefineDepthProperties(m_Shader);
+    }
+    
+    // Moments depth material variables
+    // ----------------------------------------
+protected:
+    ///< Moments shadow map to be rendered.
+    std::shared_ptr<ShadowMoments> m_Moments;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    MomentsDepthMaterial(const MomentsDepthMaterial&) = delete;
+    MomentsDepthMaterial(MomentsDepthMaterial&&) = delete;
+    
+    MomentsDepthMaterial& operator=(const MomentsDepthMaterial&) = delete;
+    MomentsDepthMaterial& operator=(MomentsDepthMaterial&&) = delete;
+};
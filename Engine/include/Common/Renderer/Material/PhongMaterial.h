@@ -20,7 +20,11 @@ public:
     // ----------------------------------------
     /// @brief Set the shininess (exponent value).
     /// @param shininess The shininess value.
-    void SetShininess(float shininess) { m_Shininess = shininess; }
+    void SetShininess(float shininess)
+    {
+        m_Shininess = shininess;
+        FrameScheduler::RequestRedraw();
+    }
     
     // Getter(s)
     // ----------------------------------------
@@ -80,17 +84,30 @@ public:
         
         // Set the alpha value
         m_Alpha = color.a;
+        FrameScheduler::RequestRedraw();
     }
 
     /// @brief Set the ambient coefficient for the material.
     /// @param k The ambient coefficient representing the RGB color components.
-    void SetAmbientColor(const glm::vec3 &k) { m_Ka = k; }
+    void SetAmbientColor(const glm::vec3 &k)
+    {
+        m_Ka = k;
+        FrameScheduler::RequestRedraw();
+    }
     /// @brief Set the diffuse coefficient for the material.
     /// @param k The diffuse coefficient representing the RGB color components.
-    void SetDiffuseColor(const glm::vec3 &k) { m_Kd = k; }
+    void SetDiffuseColor(const glm::vec3 &k)
+    {
+        m_Kd = k;
+        FrameScheduler::RequestRedraw();
+    }
     /// @brief Set the specular coefficient for the material.
     /// @param k The specular coefficient representing the RGB color components.
-    void SetSpecularColor(const glm::vec3 &k) { m_Ks = k; }
+    void SetSpecularColor(const glm::vec3 &k)
+    {
+        m_Ks = k;
+        FrameScheduler::RequestRedraw();
+    }
     
     // Getter(s)
     // ----------------------------------------
@@ -167,12 +184,14 @@ public:
     virtual void SetDiffuseMap(const std::shared_ptr<Texture>& texture)
     {
         m_DiffuseTexture = texture;
+        FrameScheduler::RequestRedraw();
     }
     /// @brief Set the specular texture map for the geometry.
     /// @param texture Texture map.
     virtual void SetSpecularMap(const std::shared_ptr<Texture>& texture)
     {
         m_SpecularTexture = texture;
+        FrameScheduler::RequestRedraw();
     }
     
     // Getter(s)
@@ -22,7 +22,11 @@ public:
     // ----------------------------------------
     /// @brief Set the albedo color.
     /// @param color Albedo color in RGBA.
-    virtual void SetColor(const glm::vec4& color) { m_Color = color; }
+    virtual void SetColor(const glm::vec4& color)
+    {
+        m_Color = color;
+        FrameScheduler::RequestRedraw();
+    }
     
     // Getter(s)
     // ----------------------------------------
@@ -78,6 +82,7 @@ public:
     virtual void SetTextureMap(const std::shared_ptr<Texture>& texture)
     {
         m_Texture = texture;
+        FrameScheduler::RequestRedraw();
     }
     
     // Getter(s)
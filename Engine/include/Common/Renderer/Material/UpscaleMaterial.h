@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Common/Renderer/Material/SimpleMaterial.h"
+
+/**
+ * A material class to upscale (and sharpen) a texture rendered at a lower resolution.
+ *
+ * The `UpscaleMaterial` class is a subclass of `SimpleTextureMaterial` that only samples the
+ * area of its texture map that has been rendered (the lower-left fraction defined by the render
+ * scale). The upscaled image is sharpened to compensate the blur of the bilinear filtering.
+ *
+ * Copying or moving `UpscaleMaterial` objects is disabled to ensure single ownership and
+ * prevent unintended duplication of material resources.
+ */
+class UpscaleMaterial : public SimpleTextureMaterial
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate an upscale material with the specified shader file path.
+    /// @param filePath The file path to the shader used by the material.
+    UpscaleMaterial(const std::filesystem::path& filePath =
+                    std::filesystem::path("Resources/shaders/filters/SharpenUpscale.glsl"))
+        : SimpleTextureMaterial(filePath)
+    {}
+    /// @brief Destructor for the upscale material.
+    ~UpscaleMaterial() override = default;
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the fraction of the texture map with the rendered image.
+    /// @return The render scale (width and height).
+    glm::vec2 GetRenderScale() const { return m_RenderScale; }
+    /// @brief Get the sharpening amount.
+    /// @return The sharpness (between 0 and 1).
+    float GetSharpness() const { return m_Sharpness; }
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Set the fraction of the texture map with the rendered image.
+    /// @param scale The render scale (width and height).
+    void SetRenderScale(const glm::vec2& scale) { m_RenderScale = scale; }
+    /// @brief Set the sharpening amount.
+    /// @param sharpness The sharpness (between 0 and 1).
+    void SetSharpness(float sharpness)
+    {
+        m_Sharpness = sharpness;
+        FrameScheduler::RequestPresent();
+    }
+
+protected:
+    // Properties
+    // ----------------------------------------
+    /// @brief Set the material properties into the uniforms of the shader program.
+    void SetMaterialProperties() override
+    {
+        SimpleTextureMaterial::SetMaterialProperties();
+        m_Shader->SetVec2("u_RenderScale", m_RenderScale);
+        m_Shader->SetFloat("u_Sharpness", m_Sharpness);
+    }
+    
+    // Upscale material variables
+    // ----------------------------------------
+protected:
+    ///< Fraction of the texture map with the rendered image.
+    glm::vec2 m_RenderScale = glm::vec2(1.0f);
+    ///< Sharpening amount.
+    float m_Sharpness = 0.5f;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    UpscaleMaterial(const UpscaleMaterial&) = delete;
+    UpscaleMaterial(UpscaleMaterial&&) = delete;
+    
+    UpscaleMaterial& operator=(const UpscaleMaterial&) = delete;
+    UpscaleMaterial& operator=(UpscaleMaterial&&) = delete;
+};
@@ -50,6 +50,18 @@ public:
         DefineIndices(indices);
     }
     
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Check if the vertex and index information of the mesh has been defined.
+    /// @return `true` if the mesh can be drawn.
+    bool IsDefined() const { return !m_Vertices.empty() && !m_Indices.empty(); }
+    /// @brief Get the vertex data of the mesh (last defined set of vertices).
+    /// @return The vertex data.
+    const std::vector<VertexData>& GetVertices() const { return m_Vertices.back(); }
+    /// @brief Get the index data of the mesh.
+    /// @return The index data.
+    const std::vector<unsigned int>& GetIndices() const { return m_Indices; }
+    
     // Setter(s)
     // ----------------------------------------
     /// @brief Sets the material for the mesh.
@@ -62,7 +74,8 @@ public:
     // Render
     // ----------------------------------------
     void DrawMesh(const glm::mat4& transform = glm::mat4(1.0f),
-                  const PrimitiveType &primitive = PrimitiveType::Triangles);
+                  const PrimitiveType &primitive = PrimitiveType::Triangles,
+                  const std::shared_ptr<Material>& material = nullptr);
     
     // Mesh variables
     // ----------------------------------------
@@ -152,19 +165,23 @@ void Mesh<VertexData>::DefineIndices(const std::vector<unsigned int> &indices)
  *
  * @param transform Transformation matrix of the geometry.
  * @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
+ * @param material The material used instead of the mesh material (if defined).
  */
 template<typename VertexData>
 void Mesh<VertexData>::DrawMesh(const glm::mat4 &transform,
-                                const PrimitiveType &primitive)
+                                const PrimitiveType &primitive,
+                                const std::shared_ptr<Material>& material)
 {
     // Verify that the vertex information has been set for the mesh
     if (!m_VertexBuffer  && !m_IndexBuffer)
     {
-        CORE_WARN("Mesh vertex or index information has not been defined!");
+        CORE_WARN_ONCE("Mesh vertex or index information has not been defined!");
         return;
     }
     
-    if (m_Material)
+    if (material)
+        Renderer::Draw(m_VertexArray, material, transform, primitive);
+    else if (m_Material)
         Renderer::Draw(m_VertexArray, m_Material, transform, primitive);
     else
         Renderer::Draw(m_VertexArray, primitive);
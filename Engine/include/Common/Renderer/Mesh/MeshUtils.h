@@ -141,6 +141,7 @@ inline std::vector<unsigned int> IndicesOfCube()
 inline std::vector<unsigned int> IndicesOfSphere(int resolution)
 {
     std::vector<unsigned int> indices;
+    indices.reserve(6 * resolution * resolution);
 
     for (int i = 0; i < resolution; i++)
     {
@@ -395,14 +396,13 @@ inline void DefineCubeGeometry(std::vector<GeoVertexData<glm::vec4, glm::vec2, g
  *
  * @param vertices Vector to store the vertex data for the sphere (position-only vertices).
  * @param indices Vector to store the indices of the vertices to form triangles.
- * @param radius The radius of the sphere.
  * @param resolution The number of horizontal and vertical segments of the sphere.
  */
 inline void DefineSphereGeometry(std::vector<GeoVertexData<glm::vec4>>& vertices,
-                                std::vector<unsigned int>& indices)
+                                std::vector<unsigned int>& indices, int resolution)
 {
     float radius = 1.0f;
-    int resolution = 32;
+    vertices.reserve(vertices.size() + (resolution + 1) * (resolution + 1));
 
     // Calculate the vertices of the sphere
     for (int i = 0; i <= resolution; i++)
@@ -428,14 +428,13 @@ inline void DefineSphereGeometry(std::vector<GeoVertexData<glm::vec4>>& vertices
  *
  * @param vertices Vector to store the vertex data for the sphere (position-only vertices).
  * @param indices Vector to store the indices of the vertices to form triangles.
- * @param radius The radius of the sphere.
  * @param resolution The number of horizontal and vertical segments of the sphere.
  */
 inline void DefineSphereGeometry(std::vector<GeoVertexData<glm::vec4, glm::vec2>>& vertices,
-                                std::vector<unsigned int>& indices)
+                                std::vector<unsigned int>& indices, int resolution)
 {
     float radius = 1.0f;
-    int resolution = 32;
+    vertices.reserve(vertices.size() + (resolution + 1) * (resolution + 1));
 
     // Calculate the vertices of the sphere
     for (int i = 0; i <= resolution; i++)
@@ -461,14 +460,13 @@ inline void DefineSphereGeometry(std::vector<GeoVertexData<glm::vec4, glm::vec2>
  *
  * @param vertices Vector to store the vertex data for the sphere (position-only vertices).
  * @param indices Vector to store the indices of the vertices to form triangles.
- * @param radius The radius of the sphere.
  * @param resolution The number of horizontal and vertical segments of the sphere.
  */
 inline void DefineSphereGeometry(std::vector<GeoVertexData<glm::vec4, glm::vec3>>& vertices,
-                                std::vector<unsigned int>& indices)
+                                std::vector<unsigned int>& indices, int resolution)
 {
     float radius = 1.0f;
-    int resolution = 32;
+    vertices.reserve(vertices.size() + (resolution + 1) * (resolution + 1));
 
     // Calculate the vertices of the sphere
     for (int i = 0; i <= resolution; i++)
@@ -494,14 +492,13 @@ inline void DefineSphereGeometry(std::vector<GeoVertexData<glm::vec4, glm::vec3>
  *
  * @param vertices Vector to store the vertex data for the sphere (position-only vertices).
  * @param indices Vector to store the indices of the vertices to form triangles.
- * @param radius The radius of the sphere.
  * @param resolution The number of horizontal and vertical segments of the sphere.
  */
 inline void DefineSphereGeometry(std::vector<GeoVertexData<glm::vec4, glm::vec2, glm::vec3>>& vertices,
-                                std::vector<unsigned int>& indices)
+                                std::vector<unsigned int>& indices, int resolution)
 {
     float radius = 1.0f;
-    int resolution = 32;
+    vertices.reserve(vertices.size() + (resolution + 1) * (resolution + 1));
 
     // Calculate the vertices of the sphere
     for (int i = 0; i <= resolution; i++)
@@ -522,5 +519,19 @@ inline void DefineSphereGeometry(std::vector<GeoVertexData<glm::vec4, glm::vec2,
     indices = IndicesOfSphere(resolution);
 }
 
+/**
+ * Define the geometry of a sphere using the default resolution.
+ *
+ * @tparam VertexData The type of vertex data used to define the geometry.
+ *
+ * @param vertices Vector to store the vertex data for the sphere.
+ * @param indices Vector to store the indices of the vertices to form triangles.
+ */
+template<typename VertexData>
+inline void DefineSphereGeometry(std::vector<VertexData>& vertices, std::vector<unsigned int>& indices)
+{
+    DefineSphereGeometry(vertices, indices, 32);
+}
+
 } // namespace Geometry
 } // namespace utils
@@ -48,10 +48,15 @@ public:
     // ----------------------------------------
     virtual void LoadModel(const std::filesystem::path& filePath) override;
     
+    // Mesh data
+    // ----------------------------------------
+    static void ReadMeshData(const aiMesh *mesh, std::vector<AssimpVertexData>& vertices,
+                             std::vector<unsigned int>& indices);
+    
 private:
     // Mesh processing
     // ----------------------------------------
-    void ProcessNode(aiNode *node, const aiScene *scene);
+    void ProcessNode(aiNode *node, const aiScene *scene, const glm::mat4 &parentTransform);
     Mesh<AssimpVertexData> ProcessMesh(aiMesh *mesh);
     
     // Disable the copying or moving of this resource
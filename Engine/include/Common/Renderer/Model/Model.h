@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Common/Core/Library.h"
+#include "Common/Core/FrameScheduler.h"
 #include "Common/Renderer/Mesh/Mesh.h"
 
 #include <glm/glm.hpp>
@@ -19,13 +20,28 @@ struct BBox
     glm::vec3 max = { 0.0f, 0.0f, 0.0f };   ///< The maximum coordinates of the bounding box.
 };
 
+/**
+ * Represents the range of a mesh inside a set of merged geometry buffers.
+ *
+ * The `MeshRange` structure describes where the indices of one mesh are located once the
+ * geometry of several meshes has been packed into shared vertex and index buffers (e.g.,
+ * for indirect drawing).
+ */
+struct MeshRange
+{
+    unsigned int IndexCount = 0;    ///< The number of indices of the mesh.
+    unsigned int FirstIndex = 0;    ///< The offset of the first index in the shared index buffer.
+    int BaseVertex = 0;             ///< The offset added to each index to fetch the vertices.
+};
+
 /**
  * Represents a basic model used for rendering geometry.
  *
  * The `BaseModel` class provides functionality for drawing the model with a specified transformation
- * matrix and primitive type. It encapsulates information about the model's position, rotation, scale,
- * model matrix, and up axis direction. Derived classes must implement protected virtual methods
- * for updating the model matrix.
+ * matrix and primitive type. It encapsulates information about the model's position, rotation
+ * (quaternion), scale, model matrix, and up axis direction. When the model is attached to a node of
+ * a transform hierarchy, these define its transformation relative to the node. Derived classes must
+ * implement protected virtual methods for updating the model matrix.
  */
 class BaseModel
 {
@@ -39,14 +55,15 @@ public:
     // ----------------------------------------
     /// @brief Draw the model using the specified transformation matrix.
     /// @param transform The transformation matrix for the model.
-    /// @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
-    virtual void DrawModelWithTransform(const glm::mat4 &transform = glm::mat4(1.0f)) = 0;
+    /// @param material The material used instead of the mesh materials (if defined).
+    virtual void DrawModelWithTransform(const glm::mat4 &transform = glm::mat4(1.0f),
+                                        const std::shared_ptr<Material>& material = nullptr) = 0;
     /// @brief Draw the model using the model matrix transformation.
-    /// @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
-    void DrawModel()
+    /// @param material The material used instead of the mesh materials (if defined).
+    void DrawModel(const std::shared_ptr<Material>& material = nullptr)
     {
         UpdateModelMatrix();
-        DrawModelWithTransform(m_ModelMatrix);
+        DrawModelWithTransform(m_ModelMatrix, material);
     }
     
     // Getter(s)
@@ -54,13 +71,32 @@ public:
     /// @brief Get the model position (x, y, z).
     /// @return The model position coordinates.
     const glm::vec3& GetPosition() const { return m_Position; }
-    /// @brief Get the model orientation (yaw, pitch, roll).
-    /// @return The model rotation angles.
-    const glm::vec3& GetRotation() const { return m_Rotation; }
+    /// @brief Get the model orientation.
+    /// @return The model rotation.
+    const glm::quat& GetRotation() const { return m_Rotation; }
+    /// @brief Get the model orientation as Euler angles (pitch, yaw, roll).
+    /// @return The model rotation angles (in degrees).
+    glm::vec3 GetEulerAngles() const { return glm::degrees(glm::eulerAngles(m_Rotation)); }
     
     /// @brief Get the model matrix (transformation from model space to world space).
     /// @return The view matrix.
     const glm::mat4& GetModelMatrix() const { return m_ModelMatrix; }
+    /// @brief Get the primitive type used to draw the model.
+    /// @return The primitive type.
+    PrimitiveType GetPrimitive() const { return m_Primitive; }
+    /// @brief Get the number of modifications of the meshes or materials of the model.
+    /// @return The revision of the model content.
+    unsigned int GetRevision() const { return m_Revision; }
+    
+    /// @brief Get the bounding box of the model (in model space).
+    /// @return The bounding box.
+    virtual const BBox& GetBoundingBox() const = 0;
+    /// @brief Append the positions and indices of all the meshes in the model.
+    /// @param positions The merged vertex positions.
+    /// @param indices The merged indices.
+    /// @param ranges The range of each appended mesh inside the merged buffers.
+    virtual void GetGeometry(std::vector<glm::vec4>& positions, std::vector<unsigned int>& indices,
+                             std::vector<MeshRange>& ranges) const = 0;
     
     // Setter(s)
     // ----------------------------------------
@@ -74,13 +110,21 @@ public:
     {
         m_Position = position;
         UpdateModelMatrix();
+        FrameScheduler::RequestRedraw();
     }
-    /// @brief Change the model orientation (yaw, pitch, roll).
-    /// @param orientation The model rotation angles.
-    void SetRotation(const glm::vec3 &rotation)
+    /// @brief Change the model orientation.
+    /// @param rotation The model rotation.
+    void SetRotation(const glm::quat &rotation)
     {
-        m_Rotation = rotation;
+        m_Rotation = glm::normalize(rotation);
         UpdateModelMatrix();
+        FrameScheduler::RequestRedraw();
+    }
+    /// @brief Change the model orientation using Euler angles (pitch, yaw, roll).
+    /// @param angles The model rotation angles (in degrees).
+    void SetRotation(const glm::vec3 &angles)
+    {
+        SetRotation(glm::quat(glm::radians(angles)));
     }
     /// @brief Set the scaling factor for the model in the x, y, and z axis.
     /// @param position The model scaling factor.
@@ -88,6 +132,7 @@ public:
     {
         m_Scale = scale;
         UpdateModelMatrix();
+        FrameScheduler::RequestRedraw();
     }
     /// @brief Set the up axis for the model.
     /// @param upAxis A vector representing the up axis.
@@ -95,6 +140,15 @@ public:
     {
         m_UpAxis = glm::normalize(upAxis);
         UpdateModelMatrix();
+        FrameScheduler::RequestRedraw();
+    }
+    /// @brief Set the transformation of the parent node (e.g., from a transform hierarchy).
+    /// @param matrix The world matrix of the parent node.
+    void SetParentMatrix(const glm::mat4 &matrix)
+    {
+        m_ParentMatrix = matrix;
+        UpdateModelMatrix();
+        FrameScheduler::RequestRedraw();
     }
     
 protected:
@@ -115,18 +169,23 @@ protected:
 protected:
     ///< Model position (x, y, z).
     glm::vec3 m_Position = glm::vec3(0.0f);
-    /// Model orientation (yaw, pitch and roll angles).
-    glm::vec3 m_Rotation = glm::vec3(0.0f);
+    ///< Model orientation.
+    glm::quat m_Rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
     ///< Model scale factor.
     glm::vec3 m_Scale = glm::vec3(1.0f);
     
     ///< Model matrix.
     glm::mat4 m_ModelMatrix = glm::mat4(1.0f);
+    ///< Transformation of the parent node.
+    glm::mat4 m_ParentMatrix = glm::mat4(1.0f);
     ///< Model up axis direction.
     glm::vec3 m_UpAxis = glm::vec3(0.0f, 1.0f, 0.0f);
     
     ///< Primitive type defined for the model.
     PrimitiveType m_Primitive;
+    ///< Number of modifications of the meshes or materials (the cached images using the model are
+    ///< rendered again when it changes).
+    unsigned int m_Revision = 0;
     
     // Disable the copying or moving of this resource
     // ----------------------------------------
@@ -166,8 +225,8 @@ public:
     {
         auto model = std::make_shared<Type>(std::forward<Args>(args)...);
         
-        std::string message = GetName() + " " + name + " is not of the specified type!";
-        CORE_ASSERT(std::dynamic_pointer_cast<BaseModel>(model), message);
+        CORE_ASSERT(std::dynamic_pointer_cast<BaseModel>(model),
+                    GetName() + " " + name + " is not of the specified type!");
         
         Add(name, model);
         return model;
@@ -199,7 +258,7 @@ public:
           const PrimitiveType &primitive = PrimitiveType::Triangles)
     : BaseModel(primitive)
     {
-        m_Meshes.push_back(mesh);
+        AddMesh(mesh);
     }
     /// @brief Delete the model.
     virtual ~Model() = default;
@@ -208,11 +267,12 @@ public:
     // ----------------------------------------
     /// @brief Draw the model using the specified transformation matrix.
     /// @param transform The transformation matrix for the model.
-    /// @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
-    void DrawModelWithTransform(const glm::mat4 &transform = glm::mat4(1.0f)) override
+    /// @param material The material used instead of the mesh materials (if defined).
+    void DrawModelWithTransform(const glm::mat4 &transform = glm::mat4(1.0f),
+                                const std::shared_ptr<Material>& material = nullptr) override
     {
         for(unsigned int i = 0; i < m_Meshes.size(); i++)
-            m_Meshes[i].DrawMesh(transform, m_Primitive);
+            m_Meshes[i].DrawMesh(transform * m_MeshTransforms[i], m_Primitive, material);
     }
     
     // Getter(s)
@@ -220,6 +280,12 @@ public:
     /// @brief Get the number of meshes representing the model.
     /// @return The number of meshes.
     int GetMeshNumber() const { return (int)m_Meshes.size(); }
+    /// @brief Get the bounding box of the model (in model space).
+    /// @return The bounding box.
+    const BBox& GetBoundingBox() const override { return m_BBox; }
+    
+    void GetGeometry(std::vector<glm::vec4>& positions, std::vector<unsigned int>& indices,
+                     std::vector<MeshRange>& ranges) const override;
     
     // Setter(s)
     // ----------------------------------------
@@ -229,6 +295,8 @@ public:
     {
         for(unsigned int i = 0; i < m_Meshes.size(); i++)
             m_Meshes[i].SetMaterial(material);
+        m_Revision++;
+        FrameScheduler::RequestRedraw();
     }
     /// @brief Sets the material for a specific mesh in the model.
     /// @param index The index of the mesh to set the material for.
@@ -237,9 +305,15 @@ public:
     {
         if (index >= 0 && index < m_Meshes.size())
             m_Meshes[index].SetMaterial(material);
+        m_Revision++;
+        FrameScheduler::RequestRedraw();
     }
     
 protected:
+    // Meshes definition
+    // ----------------------------------------
+    void AddMesh(const Mesh<VertexData>& mesh, const glm::mat4& transform = glm::mat4(1.0f));
+    
     // Bounding box definition
     // ----------------------------------------
     void UpdateBBoxWithVertex(const glm::vec3 &v);
@@ -255,6 +329,8 @@ protected:
     BBox m_BBox;
     ///< Set of meshes defining the model.
     std::vector<Mesh<VertexData>> m_Meshes;
+    ///< Transformation of each mesh relative to the model (e.g., from the file node hierarchy).
+    std::vector<glm::mat4> m_MeshTransforms;
     
     // Disable the copying or moving of this resource
     // ----------------------------------------
@@ -327,6 +403,27 @@ public:
     LoadedModel& operator=(LoadedModel&&) = delete;
 };
 
+/**
+ * Add a mesh to the model.
+ *
+ * @param mesh The mesh to be added.
+ * @param transform The transformation of the mesh relative to the model.
+ */
+template<typename VertexData>
+void Model<VertexData>::AddMesh(const Mesh<VertexData>& mesh, const glm::mat4& transform)
+{
+    m_Meshes.push_back(mesh);
+    m_MeshTransforms.push_back(transform);
+    m_Revision++;
+    
+    // Update the bounding box using the (transformed) mesh vertices
+    if (mesh.IsDefined())
+    {
+        for (auto& vertex : mesh.GetVertices())
+            UpdateBBoxWithVertex(glm::vec3(transform * vertex.position));
+    }
+}
+
 /**
  * Update the boundaries of the bounding box using a vertex coordinate.
  *
@@ -357,6 +454,40 @@ void Model<VertexData>::UpdateBBoxWithVertex(const glm::vec3& v)
         m_BBox.max.z = v.z;
 }
 
+/**
+ * Append the positions and indices of all the meshes in the model into shared buffers.
+ *
+ * @param positions The merged vertex positions.
+ * @param indices The merged indices.
+ * @param ranges The range of each appended mesh inside the merged buffers.
+ */
+template<typename VertexData>
+void Model<VertexData>::GetGeometry(std::vector<glm::vec4>& positions,
+                                    std::vector<unsigned int>& indices,
+                                    std::vector<MeshRange>& ranges) const
+{
+    for (unsigned int i = 0; i < m_Meshes.size(); i++)
+    {
+        auto& mesh = m_Meshes[i];
+        
+        // Skip the meshes without any geometry defined
+        if (!mesh.IsDefined())
+            continue;
+        
+        // Define the location of the mesh inside the shared buffers
+        MeshRange range;
+        range.IndexCount = (unsigned int)mesh.GetIndices().size();
+        range.FirstIndex = (unsigned int)indices.size();
+        range.BaseVertex = (int)positions.size();
+        ranges.push_back(range);
+        
+        // Copy the vertex positions (relative to the model) and the indices
+        for (auto& vertex : mesh.GetVertices())
+            positions.push_back(m_MeshTransforms[i] * vertex.position);
+        indices.insert(indices.end(), mesh.GetIndices().begin(), mesh.GetIndices().end());
+    }
+}
+
 /**
  * Update the model matrix with translation, scaling, and rotation transformations.
  */
@@ -367,8 +498,8 @@ void Model<VertexData>::UpdateModelMatrix()
     glm::vec3 size = m_BBox.max - m_BBox.min;
     glm::vec3 center = (m_BBox.max + m_BBox.min) / 2.0f;
 
-    // Reset the model matrix to the identity
-    m_ModelMatrix = glm::mat4(1.0f);
+    // Start from the transformation of the parent node (identity if not attached)
+    m_ModelMatrix = m_ParentMatrix;
 
     // 1. Translate (and center) to the selected position
     m_ModelMatrix = glm::translate(m_ModelMatrix, -center);
@@ -381,7 +512,7 @@ void Model<VertexData>::UpdateModelMatrix()
     m_ModelMatrix = glm::scale(m_ModelMatrix, m_Scale);
 
     // 3. Rotate with the selected user angle around the center
-    m_ModelMatrix *= glm::toMat4(glm::quat(glm::radians(m_Rotation)));
+    m_ModelMatrix *= glm::toMat4(m_Rotation);
     
     // 4. Rotate the model if the up-axis is defined as other than the Y-axis
     glm::vec3 referenceAxis = glm::vec3(0.0f, 1.0f, 0.0f);
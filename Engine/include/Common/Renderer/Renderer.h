@@ -6,6 +6,7 @@
 #include "Common/Renderer/Buffer/VertexArray.h"
 #include "Common/Renderer/Buffer/IndexBuffer.h"
 #include "Common/Renderer/Buffer/FrameBuffer.h"
+#include "Common/Renderer/Buffer/StorageBuffer.h"
 
 #include "Common/Renderer/Material/Material.h"
 
@@ -45,6 +46,19 @@ public:
               const std::shared_ptr<Material>& material,
               const glm::mat4 &transform = glm::mat4(1.0f),
               const PrimitiveType &primitive = PrimitiveType::Triangles);
+    static void DrawIndirect(const std::shared_ptr<VertexArray>& vao,
+                             const std::shared_ptr<Material>& material,
+                             const std::shared_ptr<StorageBuffer>& commands,
+                             const std::shared_ptr<StorageBuffer>& drawCount,
+                             unsigned int maxDrawCount,
+                             const PrimitiveType &primitive = PrimitiveType::Triangles);
+    
+    // Compute
+    // ----------------------------------------
+    static void Dispatch(const std::shared_ptr<Shader>& shader, unsigned int groupsX,
+                         unsigned int groupsY = 1, unsigned int groupsZ = 1);
+    static void SetMemoryBarrier(const MemoryBarrierFlags& barrier);
+    static bool IsComputeSupported();
     
     // Getters(s)
     // ----------------------------------------
@@ -60,6 +74,7 @@ public:
     static void SetDepthFunction(const DepthFunction depth);
     static void SetFaceCulling(const FaceCulling culling);
     static void SetCubeMapSeamless(const bool enabled);
+    static void SetClipDistances(const unsigned int count);
     
     // Statistics
     // ----------------------------------------
@@ -72,6 +87,10 @@ public:
         unsigned int renderPasses = 0;
         ///< Number of times the draw function is called.
         unsigned int drawCalls = 0;
+        ///< Number of triangles drawn (indirect draws are not counted).
+        unsigned int triangles = 0;
+        ///< Number of compute work dispatches.
+        unsigned int dispatches = 0;
     };
     
     static void ResetStats();
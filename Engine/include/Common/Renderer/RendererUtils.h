@@ -32,6 +32,23 @@ enum class DepthFunction
     Always, Never, Less, Equal, LEqual, Greater, NotEqual, GEqual,
 };
 
+/**
+ * Structure to represent the memory accesses that must wait for previous shader writes.
+ *
+ * Writes performed by compute shaders (into storage buffers or images) are not visible to the
+ * following commands until a memory barrier is placed for the way the data is going to be read.
+ */
+struct MemoryBarrierFlags
+{
+    bool StorageBuffer = false;     ///< Shader storage buffer reads/writes.
+    bool ShaderImage = false;       ///< Image load/store operations.
+    bool TextureFetch = false;      ///< Texture sampling.
+    bool VertexAttribute = false;   ///< Vertex (or instance) attributes sourced from buffers.
+    bool IndirectCommand = false;   ///< Indirect draw or dispatch commands.
+    bool BufferUpdate = false;      ///< Buffer updates and read backs.
+    bool Framebuffer = false;       ///< Framebuffer attachments reads/writes.
+};
+
 namespace utils { namespace OpenGL
 {
 /**
@@ -104,5 +121,33 @@ inline GLenum DepthToOpenGLType(DepthFunction depth)
     return 0;
 }
 
+/**
+ * Convert the memory barrier flags to its corresponding OpenGL mask.
+ *
+ * @param barrier The memory accesses to be synchronized.
+ *
+ * @return Bitwise OR of the OpenGL barrier bits.
+ */
+inline GLbitfield MemoryBarrierFlagsToOpenGLMask(const MemoryBarrierFlags& barrier)
+{
+    GLbitfield mask = 0;
+    if (barrier.StorageBuffer)
+        mask |= GL_SHADER_STORAGE_BARRIER_BIT;
+    if (barrier.ShaderImage)
+        mask |= GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
+    if (barrier.TextureFetch)
+        mask |= GL_TEXTURE_FETCH_BARRIER_BIT;
+    if (barrier.VertexAttribute)
+        mask |= GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT;
+    if (barrier.IndirectCommand)
+        mask |= GL_COMMAND_BARRIER_BIT;
+    if (barrier.BufferUpdate)
+        mask |= GL_BUFFER_UPDATE_BARRIER_BIT;
+    if (barrier.Framebuffer)
+        mask |= GL_FRAMEBUFFER_BARRIER_BIT;
+    
+    return mask;
+}
+
 } // namespace OpenGL
 } // namespace utils
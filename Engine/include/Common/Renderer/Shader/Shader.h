@@ -53,7 +53,7 @@ public:
     
     // Parsing
     // ----------------------------------------
-    std::string ReadFile(const std::filesystem::path& filePath);
+    static std::string ReadFile(const std::filesystem::path& filePath);
     
 protected:
     // Base constructor
@@ -18,6 +18,7 @@ enum class TextureType
     TEXTURE2D,
     TEXTURE3D,
     TEXTURECUBE,
+    TEXTURE2DARRAY,
 };
 
 /**
@@ -85,6 +86,9 @@ struct TextureSpecification
     TextureWrap Wrap = TextureWrap::None;
     ///< The texture filtering mode, specifying how the texture is sampled during rendering.
     TextureFilter Filter = TextureFilter::None;
+    ///< A flag indicating whether the samples of a depth texture are compared with a reference
+    ///< value (shadow samplers). The results of the comparisons are then filtered by the hardware.
+    bool Compare = false;
     
     ///< A flag indicating whether mipmaps should be created for the texture. Mipmaps are
     ///< precalculated versions of the texture at different levels of detail, providing smoother
@@ -116,8 +120,16 @@ public:
     // ----------------------------------------
     void Bind() const;
     void BindToTextureUnit(const unsigned int slot) const;
+    void BindToImageUnit(const unsigned int unit, const TextureAccess& access,
+                         const unsigned int level = 0) const;
     void Unbind() const;
     
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the texture specifications.
+    /// @return The texture properties.
+    const TextureSpecification& GetSpecification() const { return m_Spec; }
+    
     // Friend class definition(s)
     // ----------------------------------------
     friend class FrameBuffer;
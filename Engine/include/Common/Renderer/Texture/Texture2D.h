@@ -93,6 +93,9 @@ public:
     /// @brief Get the directory where the texture file is located.
     /// @return The directory of the texture.
     std::string GetDirectory() { return m_FilePath.parent_path().string(); }
+    /// @brief Check if the texture was flipped vertically when loaded.
+    /// @return `true` if the first row of the texture is the last row of the file.
+    bool IsFlipped() const { return m_Flip; }
     
     // Friend class definition(s)
     // ----------------------------------------
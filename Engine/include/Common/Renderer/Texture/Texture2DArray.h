@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Common/Renderer/Texture/TextureUtils.h"
+#include "Common/Renderer/Texture/Texture.h"
+
+/**
+ * Represents an array of 2D textures that can be bound to geometry during rendering.
+ *
+ * The `Texture2DArray` class provides functionality to create, bind, unbind, and configure arrays
+ * of 2D textures. All the layers share the same size and format (the number of layers is defined
+ * by the depth of the texture). The layers can be rendered at once (layered rendering) and
+ * sampled with a single sampler in a `Shader`.
+ *
+ * Copying or moving `Texture2DArray` objects is disabled to ensure single ownership and prevent
+ * unintended texture duplication.
+ */
+class Texture2DArray : public Texture
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    Texture2DArray();
+    Texture2DArray(const void *data);
+    Texture2DArray(const TextureSpecification& spec);
+    Texture2DArray(const void *data, const TextureSpecification& spec);
+    
+protected:
+    // Target type
+    // ----------------------------------------
+    GLenum TextureTarget() const override;
+    
+    // Texture creation
+    // ----------------------------------------
+    void CreateTexture(const void *data) override;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    Texture2DArray(const Texture2DArray&) = delete;
+    Texture2DArray(Texture2DArray&&) = delete;
+
+    Texture2DArray& operator=(const Texture2DArray&) = delete;
+    Texture2DArray& operator=(Texture2DArray&&) = delete;
+};
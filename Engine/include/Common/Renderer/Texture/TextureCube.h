@@ -27,6 +27,14 @@ public:
     TextureCube(const void *data, const TextureSpecification& spec);
     TextureCube(const std::vector<const void *>& data, const TextureSpecification& spec);
     
+    // Data
+    // ----------------------------------------
+    unsigned int GetLevelCount() const;
+    unsigned int GetLevelSize(const unsigned int level) const;
+    size_t GetFaceDataSize(const unsigned int level) const;
+    std::vector<char> GetFaceData(const unsigned int face, const unsigned int level) const;
+    void SetFaceData(const unsigned int face, const unsigned int level, const void *data);
+    
 protected:
     // Target type
     // ----------------------------------------
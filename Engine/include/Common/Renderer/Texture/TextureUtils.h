@@ -76,6 +76,19 @@ enum class TextureFilter
     Linear,             ///< Linear filtering (interpolate between neighboring pixels).
 };
 
+/**
+ * Enumeration of texture image access modes.
+ *
+ * The `TextureAccess` enum provides a list of supported access modes when a texture is bound
+ * as an image (image load/store), so that shaders can read or write individual texels.
+ */
+enum class TextureAccess
+{
+    ReadOnly,           ///< The shaders only read from the image.
+    WriteOnly,          ///< The shaders only write into the image.
+    ReadWrite,          ///< The shaders read from and write into the image.
+};
+
 /**
  * Utility functions related to texture operations.
  */
@@ -411,6 +424,28 @@ inline GLenum TextureFilterToOpenGLType(TextureFilter filter, bool useMipmaps)
     CORE_ASSERT(false, "Unknown texture filter mode!");
     return 0;
 }
+
+/**
+ * Convert the texture access mode to its corresponding OpenGL type.
+ *
+ * @param access The texture image access mode.
+ *
+ * @return OpenGL image access mode.
+ *
+ * @note If the input access mode is not recognized, the function will assert with an error.
+ */
+inline GLenum TextureAccessToOpenGLType(TextureAccess access)
+{
+    switch (access)
+    {
+        case TextureAccess::ReadOnly: return GL_READ_ONLY;
+        case TextureAccess::WriteOnly: return GL_WRITE_ONLY;
+        case TextureAccess::ReadWrite: return GL_READ_WRITE;
+    }
+    
+    CORE_ASSERT(false, "Unknown texture access mode!");
+    return 0;
+}
 } // namespace OpenGL
 
 /**
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Common/Renderer/Model/Model.h"
+#include "Common/Renderer/Light/Light.h"
+
+#include "Common/Scene/TransformHierarchy.h"
+
+/**
+ * Name of an entity (only used when loading or inspecting the scene).
+ */
+struct NameComponent
+{
+    std::string Name;                               ///< Name of the entity.
+};
+
+/**
+ * Placement of an entity inside the transform hierarchy of the scene.
+ */
+struct TransformComponent
+{
+    TransformNode Node = InvalidTransformNode;      ///< Node defining the entity transformation.
+};
+
+/**
+ * Geometry of an entity that can be rendered.
+ */
+struct RenderableComponent
+{
+    std::shared_ptr<BaseModel> Model;               ///< Model to be rendered.
+    bool Visible = true;                            ///< Visibility flag.
+    bool Static = false;                            ///< Static flag (the model does not move, so it
+                                                    ///< is kept in the cached layer of the passes).
+};
+
+/**
+ * Light source represented by an entity.
+ */
+struct LightComponent
+{
+    std::shared_ptr<BaseLight> Light;               ///< Light source.
+};
+
+/**
+ * Bounds of an entity in world space.
+ */
+struct BoundsComponent
+{
+    BBox Bounds;                                    ///< World space bounding box.
+    BBox Previous;                                  ///< World space bounding box before the last move.
+    
+    glm::mat4 Transform = glm::mat4(0.0f);          ///< Model matrix of the last update.
+    bool Visible = false;                           ///< Visibility of the last update.
+    unsigned int Revision = ~0u;                    ///< Revision of the model of the last update.
+    bool Changed = false;                           ///< The entity moved (or changed visibility,
+                                                    ///< meshes or materials) in the last update.
+};
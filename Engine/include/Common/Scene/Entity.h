@@ -0,0 +1,34 @@
+#pragma once
+
+/**
+ * Represents a handle to an entity of a scene.
+ *
+ * The `Entity` structure identifies an entity by the index of its slot inside the registry and the
+ * generation of that slot. When an entity is destroyed, its slot is reused by the next entity
+ * created but with a different generation, so old handles can be detected as invalid instead of
+ * silently referring to a different entity.
+ */
+struct Entity
+{
+    unsigned int Index = ~0u;           ///< Index of the slot used by the entity.
+    unsigned int Generation = 0;        ///< Generation of the slot when the entity was created.
+    
+    /// @brief Check if the handle refers to an entity (it may have been destroyed since).
+    /// @return `true` if the handle has been defined.
+    bool IsValid() const { return Index != ~0u; }
+    
+    /// @brief Compare two entity handles.
+    /// @param other The other handle.
+    /// @return `true` if both handles refer to the same entity.
+    bool operator==(const Entity& other) const
+    {
+        return Index == other.Index && Generation == other.Generation;
+    }
+    /// @brief Compare two entity handles.
+    /// @param other The other handle.
+    /// @return `true` if the handles refer to different entities.
+    bool operator!=(const Entity& other) const { return !(*this == other); }
+};
+
+/// Handle that does not refer to any entity.
+constexpr Entity NullEntity = Entity();
@@ -0,0 +1,348 @@
+#pragma once
+
+#include "Common/Scene/Entity.h"
+
+/**
+ * Base class for the storage of a type of component.
+ *
+ * Copying or moving `BaseComponentArray` objects is disabled to ensure single ownership and
+ * prevent unintended duplication of the components.
+ */
+class BaseComponentArray
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Define an empty component storage.
+    BaseComponentArray() = default;
+    /// @brief Delete the component storage.
+    virtual ~BaseComponentArray() = default;
+    
+    // Remove
+    // ----------------------------------------
+    /// @brief Remove the component of an entity (if it has one).
+    /// @param entity The entity handle.
+    virtual void Remove(const Entity& entity) = 0;
+    /// @brief Remove all the components.
+    virtual void Clear() = 0;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    BaseComponentArray(const BaseComponentArray&) = delete;
+    BaseComponentArray(BaseComponentArray&&) = delete;
+    
+    BaseComponentArray& operator=(const BaseComponentArray&) = delete;
+    BaseComponentArray& operator=(BaseComponentArray&&) = delete;
+};
+
+/**
+ * Dense storage of a type of component (sparse set).
+ *
+ * The `ComponentArray` class keeps the components packed in a contiguous array, together with the
+ * entity owning each of them, so iterating over all the components of a type never skips holes.
+ * A sparse array indexed by the entity slot gives constant time access to the component of an
+ * entity. Removing a component moves the last one into its place, so the order is not preserved.
+ *
+ * @tparam Component The type of component stored.
+ */
+template<typename Component>
+class ComponentArray : public BaseComponentArray
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Define an empty component storage.
+    ComponentArray() = default;
+    /// @brief Delete the component storage.
+    ~ComponentArray() override = default;
+    
+    // Add/Remove
+    // ----------------------------------------
+    /// @brief Add a component to an entity (replacing the previous one, if any).
+    /// @param entity The entity handle.
+    /// @param component The component.
+    /// @return The stored component.
+    Component& Add(const Entity& entity, const Component& component)
+    {
+        if (Has(entity))
+            return m_Data[m_Sparse[entity.Index]] = component;
+        
+        if (entity.Index >= m_Sparse.size())
+            m_Sparse.resize(entity.Index + 1, ~0u);
+        
+        m_Sparse[entity.Index] = (unsigned int)m_Data.size();
+        m_Entities.push_back(entity);
+        m_Data.push_back(component);
+        return m_Data.back();
+    }
+    /// @brief Remove the component of an entity (if it has one).
+    /// @param entity The entity handle.
+    void Remove(const Entity& entity) override
+    {
+        if (!Has(entity))
+            return;
+        
+        // Move the last component into the freed position
+        unsigned int index = m_Sparse[entity.Index];
+        unsigned int last = (unsigned int)m_Data.size() - 1;
+        if (index != last)
+        {
+            m_Data[index] = std::move(m_Data[last]);
+            m_Entities[index] = m_Entities[last];
+            m_Sparse[m_Entities[index].Index] = index;
+        }
+        
+        m_Data.pop_back();
+        m_Entities.pop_back();
+        m_Sparse[entity.Index] = ~0u;
+    }
+    /// @brief Remove all the components.
+    void Clear() override
+    {
+        m_Data.clear();
+        m_Entities.clear();
+        m_Sparse.clear();
+    }
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Check if an entity has a component of this type.
+    /// @param entity The entity handle.
+    /// @return `true` if the entity has a component.
+    bool Has(const Entity& entity) const
+    {
+        return entity.Index < m_Sparse.size() && m_Sparse[entity.Index] != ~0u &&
+               m_Entities[m_Sparse[entity.Index]] == entity;
+    }
+    /// @brief Get the component of an entity.
+    /// @param entity The entity handle.
+    /// @return The component.
+    Component& Get(const Entity& entity)
+    {
+        CORE_ASSERT(Has(entity), "Entity does not have the requested component!");
+        return m_Data[m_Sparse[entity.Index]];
+    }
+    /// @brief Get the component of an entity, if it has one.
+    /// @param entity The entity handle.
+    /// @return The component, or `nullptr` if the entity does not have it.
+    Component* TryGet(const Entity& entity)
+    {
+        return Has(entity) ? &m_Data[m_Sparse[entity.Index]] : nullptr;
+    }
+    
+    /// @brief Get the position of the component of an entity in the packed array.
+    /// @param entity The entity handle.
+    /// @return The position of the component (only valid until a component is removed).
+    unsigned int IndexOf(const Entity& entity) const
+    {
+        CORE_ASSERT(Has(entity), "Entity does not have the requested component!");
+        return m_Sparse[entity.Index];
+    }
+    
+    /// @brief Get the number of components stored.
+    /// @return The number of components.
+    unsigned int Size() const { return (unsigned int)m_Data.size(); }
+    /// @brief Get the packed components.
+    /// @return The components.
+    std::vector<Component>& GetData() { return m_Data; }
+    /// @brief Get the entity owning each packed component.
+    /// @return The entities (in the same order as the components).
+    const std::vector<Entity>& GetEntities() const { return m_Entities; }
+    
+    // Iteration support
+    // ----------------------------------------
+    /// @brief Get the begin iterator for the components.
+    /// @return Iterator pointing to the first component.
+    typename std::vector<Component>::iterator begin() { return m_Data.begin(); }
+    /// @brief Get the end iterator for the components.
+    /// @return Iterator pointing to the end of the components.
+    typename std::vector<Component>::iterator end() { return m_Data.end(); }
+    
+    // Component array variables
+    // ----------------------------------------
+private:
+    ///< Packed components.
+    std::vector<Component> m_Data;
+    ///< Entity owning each packed component.
+    std::vector<Entity> m_Entities;
+    ///< Position of the component of each entity slot in the packed array.
+    std::vector<unsigned int> m_Sparse;
+};
+
+/**
+ * Container of the entities of a scene and their components.
+ *
+ * The `Registry` class creates and destroys entities (identified by generational handles) and
+ * stores each type of component in its own dense `ComponentArray`. Systems iterate over the
+ * array of the component they need instead of looking up objects by name.
+ *
+ * Copying or moving `Registry` objects is disabled to ensure single ownership and prevent
+ * unintended duplication of the entities.
+ */
+class Registry
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Define an empty registry.
+    Registry() = default;
+    /// @brief Delete the registry.
+    ~Registry() = default;
+    
+    // Entities
+    // ----------------------------------------
+    /// @brief Create a new entity (without components).
+    /// @return The entity handle.
+    Entity CreateEntity()
+    {
+        Entity entity;
+        if (!m_FreeSlots.empty())
+        {
+            entity.Index = m_FreeSlots.back();
+            m_FreeSlots.pop_back();
+        }
+        else
+        {
+            entity.Index = (unsigned int)m_Generations.size();
+            m_Generations.push_back(0);
+        }
+        entity.Generation = m_Generations[entity.Index];
+        m_Count++;
+        return entity;
+    }
+    /// @brief Destroy an entity and all its components.
+    /// @param entity The entity handle.
+    void DestroyEntity(const Entity& entity)
+    {
+        if (!IsAlive(entity))
+            return;
+        
+        for (auto& components : m_Components)
+        {
+            if (components)
+                components->Remove(entity);
+        }
+        
+        // Invalidate the handles to this slot before reusing it
+        m_Generations[entity.Index]++;
+        m_FreeSlots.push_back(entity.Index);
+        m_Count--;
+    }
+    /// @brief Destroy all the entities.
+    void Clear()
+    {
+        for (auto& components : m_Components)
+        {
+            if (components)
+                components->Clear();
+        }
+        
+        m_FreeSlots.clear();
+        for (unsigned int i = 0; i < m_Generations.size(); i++)
+        {
+            m_Generations[i]++;
+            m_FreeSlots.push_back(i);
+        }
+        m_Count = 0;
+    }
+    /// @brief Check if an entity handle refers to an existing entity.
+    /// @param entity The entity handle.
+    /// @return `true` if the entity has not been destroyed.
+    bool IsAlive(const Entity& entity) const
+    {
+        return entity.Index < m_Generations.size() &&
+               m_Generations[entity.Index] == entity.Generation;
+    }
+    /// @brief Get the number of existing entities.
+    /// @return The number of entities.
+    unsigned int GetEntityCount() const { return m_Count; }
+    
+    // Components
+    // ----------------------------------------
+    /// @brief Add a component to an entity (replacing the previous one, if any).
+    /// @tparam Component The type of component.
+    /// @param entity The entity handle.
+    /// @param component The component.
+    /// @return The stored component.
+    template<typename Component>
+    Component& Add(const Entity& entity, const Component& component = Component())
+    {
+        CORE_ASSERT(IsAlive(entity), "Trying to add a component to an invalid entity!");
+        return GetComponents<Component>().Add(entity, component);
+    }
+    /// @brief Remove a component from an entity.
+    /// @tparam Component The type of component.
+    /// @param entity The entity handle.
+    template<typename Component>
+    void Remove(const Entity& entity) { GetComponents<Component>().Remove(entity); }
+    /// @brief Check if an entity has a component.
+    /// @tparam Component The type of component.
+    /// @param entity The entity handle.
+    /// @return `true` if the entity has the component.
+    template<typename Component>
+    bool Has(const Entity& entity) { return GetComponents<Component>().Has(entity); }
+    /// @brief Get the component of an entity.
+    /// @tparam Component The type of component.
+    /// @param entity The entity handle.
+    /// @return The component.
+    template<typename Component>
+    Component& Get(const Entity& entity) { return GetComponents<Component>().Get(entity); }
+    /// @brief Get the component of an entity, if it has one.
+    /// @tparam Component The type of component.
+    /// @param entity The entity handle.
+    /// @return The component, or `nullptr` if the entity does not have it.
+    template<typename Component>
+    Component* TryGet(const Entity& entity) { return GetComponents<Component>().TryGet(entity); }
+    
+    /// @brief Get the dense storage of a type of component.
+    /// @tparam Component The type of component.
+    /// @return The components of all the entities.
+    template<typename Component>
+    ComponentArray<Component>& GetComponents()
+    {
+        unsigned int type = GetComponentType<Component>();
+        if (type >= m_Components.size())
+            m_Components.resize(type + 1);
+        if (!m_Components[type])
+            m_Components[type] = std::make_unique<ComponentArray<Component>>();
+        return static_cast<ComponentArray<Component>&>(*m_Components[type]);
+    }
+
+private:
+    // Component types
+    // ----------------------------------------
+    /// @brief Get the identifier of a type of component.
+    /// @tparam Component The type of component.
+    /// @return The (sequential) type identifier.
+    template<typename Component>
+    static unsigned int GetComponentType()
+    {
+        static const unsigned int type = s_ComponentTypes++;
+        return type;
+    }
+    
+    // Registry variables
+    // ----------------------------------------
+private:
+    ///< Storage of each type of component.
+    std::vector<std::unique_ptr<BaseComponentArray>> m_Components;
+    ///< Current generation of each entity slot.
+    std::vector<unsigned int> m_Generations;
+    ///< Slots of destroyed entities available for reuse.
+    std::vector<unsigned int> m_FreeSlots;
+    ///< Number of existing entities.
+    unsigned int m_Count = 0;
+    
+    ///< Number of component types used.
+    static inline unsigned int s_ComponentTypes = 0;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    Registry(const Registry&) = delete;
+    Registry(Registry&&) = delete;
+    
+    Registry& operator=(const Registry&) = delete;
+    Registry& operator=(Registry&&) = delete;
+};
@@ -3,7 +3,13 @@
 #include "Common/Renderer/Light/Light.h"
 #include "Common/Renderer/Light/EnvironmentLight.h"
 
+#include "Common/Renderer/Culling/GPUCulling.h"
+#include "Common/Renderer/Material/AtlasDepthMaterial.h"
+
 #include "Common/Scene/Viewport.h"
+#include "Common/Scene/TransformHierarchy.h"
+#include "Common/Scene/Registry.h"
+#include "Common/Scene/Components.h"
 
 /**
  * Represents the specification for a render pass in a rendering pipeline.
@@ -24,14 +30,27 @@ struct RenderPassSpecification
     std::unordered_multimap<std::string, std::string> Models;
     ///< The framebuffer to render to in this pass.
     std::shared_ptr<FrameBuffer> Framebuffer;
+    ///< The GPU culling stage used to draw the models, if specified (and supported). The models
+    ///< are then drawn with the material of the culling stage, so it is only used if all of them
+    ///< are triangle models drawn with the same material (and not into a shadow atlas).
+    std::shared_ptr<GPUCulling> Culling;
     
-    ///< The clear color for the framebuffer, if specified.
+    ///< The clear color for the framebuffer, if specified (the moments shadow maps are always
+    ///< cleared with the clear value of their light).
     std::optional<glm::vec4> Color;
     ///< The viewport size to render into, if specified.
     std::optional<glm::vec2> Size;
     ///< Disable the clearing of the framebuffer (or screenbuffer), if specified.
     std::optional<bool> SkipClear;
     
+    ///< Keep the image rendered into the framebuffer, if specified (e.g., shadow maps). The pass is
+    ///< only rendered again when its camera changes, when one of its models moves inside the view
+    ///< of the camera, or when its framebuffer is invalidated (see `Scene::InvalidateFramebuffer`).
+    std::optional<bool> Cached;
+    ///< Update the (cached) pass in turns with the other deferred passes, if specified (e.g., the
+    ///< shadow maps of distant lights). Only a few deferred passes are rendered in each frame.
+    std::optional<bool> Deferred;
+    
     ///< Optional piece of code to be executed after rendering the pass.
     std::function<void()> PreRenderCode;
     ///< Optional piece of code to be executed after rendering the pass.
@@ -63,20 +82,24 @@ public:
     /// @brief Adds an object to the library.
     /// @param name The name to associate with the object.
     /// @param object The object to add.
+    /// @return The handle of the render pass.
     /// @note If an object with the same name already exists in the library, an assertion failure
-    /// will occur.
-    void Add(const std::string& name,
-             const RenderPassSpecification& object) override
+    /// will occur (the existing pass is replaced, keeping its rendering order, when assertions are
+    /// disabled; see `Scene::InvalidateRenderPasses` to compile it again).
+    LibraryHandle Add(const std::string& name,
+                      const RenderPassSpecification& object) override
     {
-        Library::Add(name, object);
-        m_Order.push_back(name);
+        LibraryHandle handle = Library::Add(name, object);
+        if (std::find(m_Order.begin(), m_Order.end(), handle) == m_Order.end())
+            m_Order.push_back(handle);
+        return handle;
     }
     
     // Library variables
     // ----------------------------------------
 private:
     ///< Rendering order.
-    std::vector<std::string> m_Order;
+    std::vector<LibraryHandle> m_Order;
     
     // Friend classes
     // ----------------------------------------
@@ -84,6 +107,77 @@ public:
     friend class Scene;
 };
 
+/**
+ * Selects the models drawn by a render pass.
+ *
+ * The cached passes keep the static models in a separate layer, only rendered again when one of
+ * them moves. The other models are drawn over a copy of this layer.
+ */
+enum class DrawLayer
+{
+    All = 0, Static = 1, Dynamic = 2,
+};
+
+/**
+ * Represents a single draw of a compiled render pass.
+ */
+struct DrawItem
+{
+    ///< Model to be drawn.
+    std::shared_ptr<BaseModel> Model;
+    ///< Material overriding the materials of the model (empty to use the model materials).
+    std::shared_ptr<Material> Material;
+    ///< Position of the renderable component of the model.
+    unsigned int Renderable = 0;
+    ///< Material of the draw if it renders a shadow atlas (its tiles are selected for each draw).
+    std::shared_ptr<AtlasDepthMaterial> Atlas;
+};
+
+/**
+ * Represents a render pass resolved against the entities of a scene.
+ *
+ * The `CompiledRenderPass` structure is the flat draw list generated from the model and material
+ * names of a `RenderPassSpecification`. All the names are resolved when the pass is compiled, so
+ * drawing the pass does not perform any lookup. The list is not modified while drawing; it is
+ * only compiled again when the structure of the scene changes.
+ */
+struct CompiledRenderPass
+{
+    ///< Draws of the pass (in the order of the specification).
+    std::vector<DrawItem> Draws;
+    ///< Lighted materials used by the pass (their light properties are defined once per pass).
+    std::vector<std::shared_ptr<Material>> LightedMaterials;
+    ///< Draw the light sources in the pass.
+    bool DrawLights = false;
+    ///< Display the viewport image in the pass (copied or upscaled to the screen).
+    bool PresentViewport = false;
+    ///< Draw the models with the GPU culling stage of the pass.
+    bool Culled = false;
+    ///< Structure version of the scene when the pass was compiled.
+    unsigned int Version = ~0u;
+    ///< Name of the pass in the profiler captures and the frame statistics.
+    const char* Name = "RenderPass";
+    ///< View-projection matrix of the camera when the pass was last checked (on-demand rendering).
+    glm::mat4 ViewProjection = glm::mat4(0.0f);
+    
+    ///< The image of the (cached) pass is up to date.
+    bool Valid = false;
+    ///< The layer with the static models of the (cached) pass is up to date.
+    bool StaticValid = false;
+    ///< The update of the (deferred) pass is postponed to a later frame.
+    bool Postponed = false;
+    ///< Framebuffer with the static models of the (cached) pass, if it also draws dynamic models.
+    std::shared_ptr<FrameBuffer> StaticLayer;
+    
+    ///< Lights rendering their shadow maps in the pass (and their names in the frame statistics).
+    std::vector<std::pair<std::shared_ptr<Light>, const char*>> ShadowLights;
+    ///< Lights each draw casts shadows for in the current frame (one mask per draw, with one bit per
+    ///< tile of a shadow atlas, or per shadow light of the pass otherwise).
+    std::vector<uint32_t> Casters;
+    ///< Moments rendered in the pass (cleared with the moments of the far plane of their light).
+    std::shared_ptr<ShadowMoments> Moments;
+};
+
 class Scene
 {
 public:
@@ -114,9 +208,9 @@ public:
     /// @brief Get the light sources defined in the scene.
     /// @return The scene's lights.
     LightLibrary& GetLightSouces() { return m_Lights; }
-    /// @brief Get the models defined in the scene.
-    /// @return The scene's models.
-    ModelLibrary& GetModels() { return m_Models; }
+    /// @brief Get the entities of the scene and their components.
+    /// @return The scene's registry.
+    Registry& GetRegistry() { return m_Registry; }
     
     /// @brief Get the framebuffers library.
     /// @return The defined framebuffers.
@@ -126,13 +220,49 @@ public:
     /// @return The defined render passes with its specifications.
     RenderPassLibrary& GetRenderPasses() { return m_RenderPasses; }
     
+    /// @brief Get the transform hierarchy of the scene.
+    /// @return The scene's transform hierarchy.
+    TransformHierarchy& GetTransforms() { return m_Transforms; }
+    
+    // Entities
+    // ----------------------------------------
+    Entity AddModel(const std::string& name, const std::shared_ptr<BaseModel>& model);
+    Entity AddLight(const std::string& name, const std::shared_ptr<BaseLight>& light);
+    Entity FindEntity(const std::string& name) const;
+    void DestroyEntity(const Entity& entity);
+    
+    /// @brief Mark the compiled render passes as out of date (e.g., after modifying the models
+    /// or materials of a render pass specification).
+    void InvalidateRenderPasses() { m_Version++; }
+    void InvalidateFramebuffer(const std::shared_ptr<FrameBuffer>& framebuffer);
+    
+    /// @brief Set the number of deferred render passes updated in each frame.
+    /// @param count The number of passes (at least one).
+    void SetDeferredBudget(unsigned int count) { m_DeferredBudget = std::max(count, 1u); }
+    
+    // Transform hierarchy
+    // ----------------------------------------
+    void AttachToNode(const Entity& entity, const TransformNode node);
+    void AttachToNode(const std::shared_ptr<Camera>& camera, const TransformNode node);
+    void UpdateTransforms();
+    void UpdateBounds();
+    void UpdateShadows();
+    
     // Render
     // ----------------------------------------
     void Draw();
     
 private:
-    void Draw(const RenderPassSpecification& pass);
+    void Compile(const RenderPassSpecification& pass, CompiledRenderPass& compiled);
+    void UpdateCache(const RenderPassSpecification& pass, CompiledRenderPass& compiled);
+    void CullShadowCasters(CompiledRenderPass& compiled);
+    void ScheduleDeferred();
+    void Draw(const RenderPassSpecification& pass, const CompiledRenderPass& compiled,
+              const DrawLayer layer = DrawLayer::All);
+    void DrawCached(const RenderPassSpecification& pass, CompiledRenderPass& compiled);
+    void DrawCulled(const RenderPassSpecification& pass, const CompiledRenderPass& compiled);
     void DrawLight();
+    void FilterShadowMoments(const std::shared_ptr<FrameBuffer>& framebuffer);
     
     // Setters
     // ----------------------------------------
@@ -148,12 +278,31 @@ private:
     std::shared_ptr<Camera> m_Camera;
     ///< Light sources in the scene.
     LightLibrary m_Lights;
-    ///< Set of objects in the scene.
-    ModelLibrary m_Models;
+    
+    ///< Entities of the scene and their components.
+    Registry m_Registry;
+    ///< Entity associated with each name (only used when loading the scene).
+    std::unordered_map<std::string, Entity> m_Entities;
+    ///< Version of the scene structure (modified each time an entity is created or destroyed).
+    unsigned int m_Version = 0;
     
     ///< Framebuffer(s) library with all the rendered images.
     FrameBufferLibrary m_FramebufferLibrary;
     
     ///< Render passes for the rendering of the scene.
     RenderPassLibrary m_RenderPasses;
+    ///< Compiled render passes (in rendering order).
+    std::vector<CompiledRenderPass> m_CompiledPasses;
+    ///< Number of deferred render passes updated in each frame.
+    unsigned int m_DeferredBudget = 1;
+    ///< Position of the next deferred render pass to be updated (round-robin).
+    unsigned int m_DeferredCursor = 0;
+    
+    ///< Hierarchy of transformations of the scene.
+    TransformHierarchy m_Transforms;
+    ///< Cameras attached to a node of the hierarchy.
+    std::vector<std::pair<TransformNode, std::shared_ptr<Camera>>> m_AttachedCameras;
+    
+    ///< Bounds of the shadow receivers (the models inside the view of the scene camera).
+    std::vector<BBox> m_Receivers;
 };
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+/// Identifier of a node inside a transform hierarchy (stable during the lifetime of the node).
+using TransformNode = unsigned int;
+
+/// Identifier used for nodes without a parent.
+constexpr TransformNode InvalidTransformNode = ~0u;
+
+/**
+ * Represents a hierarchy of transformations (scene graph) stored as a structure of arrays.
+ *
+ * The `TransformHierarchy` class stores the local transformation (translation, rotation as a
+ * quaternion, and scale) of every node together with the index of its parent. The nodes are kept
+ * sorted by their depth in the hierarchy, so that parents are always stored before their children
+ * and the world matrices can be updated in a single linear pass over the depth levels. Only the
+ * nodes whose local transformation changed (or whose parent moved) are recomputed, and the world
+ * matrices of each level are multiplied four at a time with SIMD instructions when they are
+ * available.
+ *
+ * Copying or moving `TransformHierarchy` objects is disabled to ensure single ownership and
+ * prevent unintended duplication of the hierarchy.
+ */
+class TransformHierarchy
+{
+public:
+    // Constructor(s)/Destructor
+    // ----------------------------------------
+    /// @brief Generate an empty hierarchy.
+    TransformHierarchy() = default;
+    /// @brief Delete the hierarchy.
+    ~TransformHierarchy() = default;
+    
+    // Nodes definition
+    // ----------------------------------------
+    TransformNode CreateNode(const TransformNode parent = InvalidTransformNode);
+    void SetParent(const TransformNode node, const TransformNode parent);
+    void Reserve(const unsigned int count);
+    void Clear();
+    
+    // Update
+    // ----------------------------------------
+    void Update();
+    
+    // Getter(s)
+    // ----------------------------------------
+    /// @brief Get the number of nodes in the hierarchy.
+    /// @return The number of nodes.
+    unsigned int GetNodeCount() const { return (unsigned int)m_NodeToIndex.size(); }
+    /// @brief Get the parent of a node.
+    /// @param node The node identifier.
+    /// @return The parent node (`InvalidTransformNode` for root nodes).
+    TransformNode GetParent(const TransformNode node) const { return m_ParentNode[node]; }
+    
+    /// @brief Get the local position of a node.
+    /// @param node The node identifier.
+    /// @return The position relative to its parent.
+    const glm::vec3& GetPosition(const TransformNode node) const { return m_Position[m_NodeToIndex[node]]; }
+    /// @brief Get the local rotation of a node.
+    /// @param node The node identifier.
+    /// @return The rotation relative to its parent.
+    const glm::quat& GetRotation(const TransformNode node) const { return m_Rotation[m_NodeToIndex[node]]; }
+    /// @brief Get the local scale of a node.
+    /// @param node The node identifier.
+    /// @return The scale relative to its parent.
+    const glm::vec3& GetScale(const TransformNode node) const { return m_Scale[m_NodeToIndex[node]]; }
+    
+    /// @brief Get the local matrix of a node (updated by `Update()`).
+    /// @param node The node identifier.
+    /// @return The transformation relative to its parent.
+    const glm::mat4& GetLocalMatrix(const TransformNode node) const { return m_Local[m_NodeToIndex[node]]; }
+    /// @brief Get the world matrix of a node (updated by `Update()`).
+    /// @param node The node identifier.
+    /// @return The transformation from the node space to world space.
+    const glm::mat4& GetWorldMatrix(const TransformNode node) const { return m_World[m_NodeToIndex[node]]; }
+    glm::quat GetWorldRotation(const TransformNode node) const;
+    /// @brief Check if the world matrix of a node changed during the last update.
+    /// @param node The node identifier.
+    /// @return `true` if the node moved.
+    bool HasChanged(const TransformNode node) const { return m_Changed[m_NodeToIndex[node]]; }
+    
+    // Setter(s)
+    // ----------------------------------------
+    /// @brief Change the local position of a node.
+    /// @param node The node identifier.
+    /// @param position The position relative to its parent.
+    void SetPosition(const TransformNode node, const glm::vec3& position)
+    {
+        unsigned int index = m_NodeToIndex[node];
+        m_Position[index] = position;
+        m_Dirty[index] = true;
+    }
+    /// @brief Change the local rotation of a node.
+    /// @param node The node identifier.
+    /// @param rotation The rotation relative to its parent.
+    void SetRotation(const TransformNode node, const glm::quat& rotation)
+    {
+        unsigned int index = m_NodeToIndex[node];
+        m_Rotation[index] = rotation;
+        m_Dirty[index] = true;
+    }
+    /// @brief Change the local scale of a node.
+    /// @param node The node identifier.
+    /// @param scale The scale relative to its parent.
+    void SetScale(const TransformNode node, const glm::vec3& scale)
+    {
+        unsigned int index = m_NodeToIndex[node];
+        m_Scale[index] = scale;
+        m_Dirty[index] = true;
+    }
+    void SetLocalMatrix(const TransformNode node, const glm::mat4& matrix);
+
+private:
+    // Ordering
+    // ----------------------------------------
+    void Sort();
+    
+    // Transform hierarchy variables
+    // ----------------------------------------
+private:
+    ///< Index (sorted position) of the parent of each node, -1 for the roots.
+    std::vector<int> m_Parent;
+    ///< Depth of each node in the hierarchy (0 for the roots).
+    std::vector<unsigned int> m_Depth;
+    ///< Sorted position of the first node of each depth level.
+    std::vector<unsigned int> m_LevelStart;
+    
+    ///< Local position of each node.
+    std::vector<glm::vec3> m_Position;
+    ///< Local rotation of each node.
+    std::vector<glm::quat> m_Rotation;
+    ///< Local scale of each node.
+    std::vector<glm::vec3> m_Scale;
+    
+    ///< Local matrix of each node.
+    std::vector<glm::mat4> m_Local;
+    ///< World matrix of each node.
+    std::vector<glm::mat4> m_World;
+    
+    ///< Local transformation modified since the last update.
+    std::vector<unsigned char> m_Dirty;
+    ///< World matrix modified during the last update.
+    std::vector<unsigned char> m_Changed;
+    
+    ///< Parent of each node (by identifier).
+    std::vector<TransformNode> m_ParentNode;
+    ///< Sorted position of each node (by identifier).
+    std::vector<unsigned int> m_NodeToIndex;
+    ///< Node identifier at each sorted position.
+    std::vector<TransformNode> m_IndexToNode;
+    
+    ///< Nodes of a depth level updated in a batch (temporary storage).
+    std::vector<unsigned int> m_Batch;
+    
+    ///< The nodes need to be sorted again by depth.
+    bool m_NeedsSort = false;
+    
+    // Disable the copying or moving of this resource
+    // ----------------------------------------
+public:
+    TransformHierarchy(const TransformHierarchy&) = delete;
+    TransformHierarchy(TransformHierarchy&&) = delete;
+    
+    TransformHierarchy& operator=(const TransformHierarchy&) = delete;
+    TransformHierarchy& operator=(TransformHierarchy&&) = delete;
+};
@@ -4,6 +4,9 @@
 #include "Common/Renderer/Model/ModelUtils.h"
 
 #include "Common/Renderer/Material/SimpleMaterial.h"
+#include "Common/Renderer/Material/UpscaleMaterial.h"
+
+#include "Common/Renderer/DynamicResolution.h"
 
 /**
  * Represents the viewport settings and geometry for rendering.
@@ -11,6 +14,11 @@
  * The `Viewport` class encapsulates the properties of the rendering viewport,
  * including its width, height, 3D geometry model, framebuffer for rendering,
  * and the material used to display the rendered image.
+ *
+ * The framebuffer is allocated at the size of the viewport, but the scene can be rendered into a
+ * fraction of it (the render scale), either fixed or controlled from the measured GPU times. The
+ * framebuffer is not allocated again when the scale changes. Without a custom shader, the image
+ * is copied directly to the screen at full scale, or upscaled and sharpened otherwise.
  */
 class Viewport
 {
@@ -21,7 +29,7 @@ public:
     /// @param width The width of the viewport.
     /// @param height The height of the viewport.
     Viewport(int width, int height, const std::filesystem::path& shaderPath = "") :
-        m_Width(width), m_Height(height)
+        m_Width(width), m_Height(height), m_PassThrough(shaderPath.empty())
     {
         // Define the framebuffer to be render into and update its information
         FrameBufferSpecification viewportSpec;
@@ -34,6 +42,13 @@ public:
                                           std::make_shared<SimpleTextureMaterial>(shaderPath);
         m_Material->SetTextureMap(m_Framebuffer->GetColorAttachment(0));
         
+        // Define the material to upscale the image rendered at a lower resolution
+        if (m_PassThrough)
+        {
+            m_UpscaleMaterial = std::make_shared<UpscaleMaterial>();
+            m_UpscaleMaterial->SetTextureMap(m_Framebuffer->GetColorAttachment(0));
+        }
+        
         // Create the geometric model of the viewport
         using VertexData = GeoVertexData<glm::vec4, glm::vec2>;
         m_Geometry = utils::Geometry::ModelPlane<VertexData>();
@@ -55,6 +70,20 @@ public:
     /// @return Viewport framebuffer.
     const std::shared_ptr<FrameBuffer>& GetFramebuffer() const { return m_Framebuffer; }
     
+    /// @brief Get the fraction of the viewport size rendered into the framebuffer.
+    /// @return The render scale.
+    float GetRenderScale() const { return m_Scale; }
+    /// @brief Check if the viewport can be rendered at a lower resolution (only when displayed
+    /// without a custom shader).
+    /// @return `true` if the render scale can be modified.
+    bool IsScalable() const { return m_PassThrough; }
+    /// @brief Get the controller of the render scale.
+    /// @return The dynamic resolution controller.
+    DynamicResolution& GetDynamicResolution() { return m_Resolution; }
+    /// @brief Get the material used to upscale the rendered image.
+    /// @return The upscale material (empty if the viewport uses a custom shader).
+    const std::shared_ptr<UpscaleMaterial>& GetUpscaleMaterial() const { return m_UpscaleMaterial; }
+    
     // Setter(s)
     // ----------------------------------------
     /// @brief Set the width of the viewport.
@@ -72,21 +101,79 @@ public:
         m_Width = width;
         m_Height = height;
         m_Framebuffer->Resize(width, height);
+        UpdateRenderArea();
+    }
+    
+    /// @brief Set the fraction of the viewport size rendered into the framebuffer.
+    /// @param scale The render scale (between 0 and 1).
+    void SetRenderScale(float scale)
+    {
+        CORE_ASSERT(scale > 0.0f && scale <= 1.0f, "Invalid viewport render scale!");
+        if (!m_PassThrough && scale != 1.0f)
+        {
+            CORE_WARN_ONCE("The viewport cannot be scaled when displayed with a custom shader!");
+            return;
+        }
+        
+        m_Scale = scale;
+        UpdateRenderArea();
+    }
+    /// @brief Enable or disable the control of the render scale from the measured GPU times.
+    /// @param enabled The enabled flag.
+    void SetDynamicResolution(bool enabled)
+    {
+        m_Resolution.SetEnabled(enabled && m_PassThrough);
+        SetRenderScale(m_Resolution.GetScale());
+    }
+    
+    // Update
+    // ----------------------------------------
+    /// @brief Update the render scale from the measured GPU times (if the control is enabled).
+    void UpdateRenderScale()
+    {
+        if (!m_Resolution.IsEnabled())
+            return;
+        
+        m_Resolution.Update();
+        SetRenderScale(m_Resolution.GetScale());
     }
     
     // Render
     // ----------------------------------------
     /// @brief Display the rendered image into the viewport.
-    /// @param material Viewport material.
     void Render()
     {
         Renderer::BeginScene();
-        Renderer::SetViewport(0, 0, m_Width, m_Height);
         Renderer::Clear();
-        m_Geometry->SetMaterial(m_Material);
-        m_Geometry->DrawModel();
+        Present();
         Renderer::EndScene();
     }
+    /// @brief Display the rendered image into the screen (inside an active scene).
+    void Present()
+    {
+        Renderer::SetViewport(0, 0, m_Width, m_Height);
+        
+        // Custom shading of the rendered image
+        if (!m_PassThrough)
+        {
+            m_Geometry->DrawModel(m_Material);
+            return;
+        }
+        
+        // Copy the image directly if it has been rendered at full size
+        unsigned int width = m_Framebuffer->GetRenderWidth();
+        unsigned int height = m_Framebuffer->GetRenderHeight();
+        if (width == m_Framebuffer->GetSpec().Width && height == m_Framebuffer->GetSpec().Height)
+        {
+            FrameBuffer::BlitToScreen(m_Framebuffer, m_Width, m_Height, 0, TextureFilter::Nearest);
+            return;
+        }
+        
+        // Upscale the rendered area otherwise
+        m_UpscaleMaterial->SetRenderScale(glm::vec2((float)width / m_Framebuffer->GetSpec().Width,
+                                                    (float)height / m_Framebuffer->GetSpec().Height));
+        m_Geometry->DrawModel(m_UpscaleMaterial);
+    }
     /// @brief Render the viewport geometry into a framebuffer.
     /// @param framebuffer The output of the rendered image.
     /// @param material The shading material used for rendering.
@@ -103,6 +190,16 @@ public:
         
         framebuffer->Unbind();
     }
+
+private:
+    // Update
+    // ----------------------------------------
+    /// @brief Define the area of the framebuffer rendered into from the render scale.
+    void UpdateRenderArea()
+    {
+        m_Framebuffer->SetRenderArea(std::max(1, (int)std::round(m_Width * m_Scale)),
+                                     std::max(1, (int)std::round(m_Height * m_Scale)));
+    }
     
     // Viewport variables
     // ----------------------------------------
@@ -118,6 +215,15 @@ private:
     std::shared_ptr<FrameBuffer> m_Framebuffer;
     ///< Material to be used to display the framebuffer.
     std::shared_ptr<SimpleTextureMaterial> m_Material;
+    ///< Material to be used to display the framebuffer rendered at a lower resolution.
+    std::shared_ptr<UpscaleMaterial> m_UpscaleMaterial;
+    ///< The framebuffer is displayed without a custom shader.
+    bool m_PassThrough;
+    
+    ///< Fraction of the viewport size rendered into the framebuffer.
+    float m_Scale = 1.0f;
+    ///< Controller of the render scale.
+    DynamicResolution m_Resolution;
     
     // Friend classes
     // ----------------------------------------
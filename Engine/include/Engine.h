@@ -5,12 +5,15 @@
 // --------------------------------------------
 #include "Common/Core/Log.h"
 #include "Common/Core/Assert.h"
+#include "Common/Core/Profiler.h"
 
 // --------------------------------------------
 // Application
 // --------------------------------------------
 #include "Common/Core/Window.h"
 #include "Common/Core/Application.h"
+#include "Common/Core/JobSystem.h"
+#include "Common/Core/FrameScheduler.h"
 
 // --------------------------------------------
 // Inputs
@@ -26,6 +29,7 @@
 #include "Common/Event/KeyEvent.h"
 #include "Common/Event/MouseEvent.h"
 #include "Common/Event/WindowEvent.h"
+#include "Common/Event/EventQueue.h"
 
 // --------------------------------------------
 // Base Layer(s)
@@ -42,24 +46,39 @@
 #include "Common/Renderer/Buffer/IndexBuffer.h"
 #include "Common/Renderer/Buffer/VertexArray.h"
 #include "Common/Renderer/Buffer/FrameBuffer.h"
+#include "Common/Renderer/Buffer/StorageBuffer.h"
 
 #include "Common/Renderer/Shader/Shader.h"
 #include "Common/Renderer/Texture/Texture.h"
 #include "Common/Renderer/Texture/Texture1D.h"
 #include "Common/Renderer/Texture/Texture2D.h"
 #include "Common/Renderer/Texture/Texture3D.h"
+#include "Common/Renderer/Texture/Texture2DArray.h"
 #include "Common/Renderer/Texture/TextureCube.h"
 
 #include "Common/Renderer/Light/ShadowCamera.h"
 #include "Common/Renderer/Light/Light.h"
 #include "Common/Renderer/Light/PositionalLight.h"
 #include "Common/Renderer/Light/DirectionalLight.h"
+#include "Common/Renderer/Light/ShadowCascades.h"
+#include "Common/Renderer/Light/ShadowAtlas.h"
+#include "Common/Renderer/Light/ShadowCube.h"
+#include "Common/Renderer/Light/ShadowMoments.h"
 #include "Common/Renderer/Light/EnvironmentLight.h"
+#include "Common/Renderer/Light/SHProjection.h"
+#include "Common/Renderer/Light/EnvironmentCache.h"
 
 #include "Common/Renderer/Material/Material.h"
 #include "Common/Renderer/Material/LightedMaterial.h"
 #include "Common/Renderer/Material/SimpleMaterial.h"
 #include "Common/Renderer/Material/PhongMaterial.h"
+#include "Common/Renderer/Material/UpscaleMaterial.h"
+#include "Common/Renderer/Material/CascadeDepthMaterial.h"
+#include "Common/Renderer/Material/AtlasDepthMaterial.h"
+#include "Common/Renderer/Material/CubeDepthMaterial.h"
+#include "Common/Renderer/Material/MomentsDepthMaterial.h"
+#include "Common/Renderer/Material/BlurMaterial.h"
+#include "Common/Renderer/Material/CubeMapMaterial.h"
 
 #include "Common/Renderer/Mesh/Mesh.h"
 #include "Common/Renderer/Model/Model.h"
@@ -68,13 +87,21 @@
 #include "Common/Renderer/Mesh/MeshUtils.h"
 #include "Common/Renderer/Model/ModelUtils.h"
 
+#include "Common/Renderer/Culling/GPUCulling.h"
+
 #include "Common/Renderer/Camera/PerspectiveCamera.h"
 #include "Common/Renderer/Camera/OrthographicCamera.h"
 
 #include "Common/Renderer/Renderer.h"
+#include "Common/Renderer/FrameStatistics.h"
+#include "Common/Renderer/DynamicResolution.h"
 
 // --------------------------------------------
 // Rendering Context & Scene
 // --------------------------------------------
+#include "Common/Scene/TransformHierarchy.h"
+#include "Common/Scene/Entity.h"
+#include "Common/Scene/Registry.h"
+#include "Common/Scene/Components.h"
 #include "Common/Scene/Viewport.h"
 #include "Common/Scene/Scene.h"
@@ -43,7 +43,7 @@ public:
     void SetMat3(const std::string& name, const glm::mat3& value) override;
     void SetMat4(const std::string& name, const glm::mat4& value) override;
     
-private:
+public:
     /**
      * Represents the source code for an OpenGL shader program.
      */
@@ -57,20 +57,28 @@ private:
         std::string FragmentSource;
         ///< Geometry shader source code
         std::string GeometrySource;
+        ///< Compute shader source code
+        std::string ComputeSource;
         
         // Constructor(s)/Destructor
         // ----------------------------------------
         /// @brief Define the shader program source.
         /// @param vs Vertex shader source.
         /// @param fs Fragment shader source.
+        /// @param gs Geometry shader source.
+        /// @param cs Compute shader source.
         OpenGLShaderSource(const std::string& vs, const std::string& fs,
-            const std::string& gs = "")
-            : VertexSource(vs), FragmentSource(fs), GeometrySource(gs)
+            const std::string& gs = "", const std::string& cs = "")
+            : VertexSource(vs), FragmentSource(fs), GeometrySource(gs), ComputeSource(cs)
         {}
         /// @brief Delete the shader program source.
         ~OpenGLShaderSource() = default;
     };
     
+    // Parsing
+    // ----------------------------------------
+    static OpenGLShaderSource ParseShader(const std::filesystem::path& filepath);
+    
 private:
     // Compilation
     // ----------------------------------------
@@ -78,9 +86,7 @@ private:
     unsigned int CreateShader(const std::string& vertexShader,
                               const std::string& fragmentShader,
                               const std::string& gemetryShader = "");
-    // Parsing
-    // ----------------------------------------
-    OpenGLShaderSource ParseShader(const std::filesystem::path& filepath);
+    unsigned int CreateComputeShader(const std::string& computeShader);
     
     // Shader variables
     // ----------------------------------------
@@ -6,6 +6,8 @@
 #include <functional>
 #include <memory>
 #include <thread>
+#include <mutex>
+#include <shared_mutex>
 #include <utility>
 
 // Files
@@ -15,11 +17,16 @@
 
 // Data structures
 #include <string>
+#include <string_view>
 #include <array>
 #include <vector>
+#include <deque>
 #include <map>
 #include <unordered_map>
 
 // Logging
 #include "Common/Core/Log.h"
 #include "Common/Core/Assert.h"
+
+// Profiling
+#include "Common/Core/Profiler.h"
@@ -6,8 +6,13 @@
 
 #include "Common/Core/Timer.h"
 #include "Common/Core/Timestep.h"
+#include "Common/Core/JobSystem.h"
+#include "Common/Core/FrameScheduler.h"
+
+#include "Common/Input/Input.h"
 
 #include "Common/Renderer/Renderer.h"
+#include "Common/Renderer/FrameStatistics.h"
 
 // Define static variables
 Application* Application::s_Instance = nullptr;
@@ -18,21 +23,42 @@ Application* Application::s_Instance = nullptr;
  * @param name Application name.
  * @param width Size (width) of the application window.
  * @param height Size (height) of the application window.
+ * @param visible Show the application window (hidden for headless runs).
  */
 Application::Application(const std::string& name, const int width,
-                         const int height)
+                         const int height, const bool visible)
 {
     // Define the pointer to the application
     CORE_ASSERT(!s_Instance, "Application '{0}' already exists!", name);
     s_Instance = this;
     
     // Create the application window
-    m_Window = std::make_unique<Window>(name, width, height);
+    m_Window = std::make_unique<Window>(name, width, height, visible);
     // Define the event callback function for the application
     m_Window->SetEventCallback(BIND_EVENT_FN(Application::OnEvent));
+    // Let the other threads wake up the application while it waits for the events
+    FrameScheduler::SetWakeCallback(&Window::Wake);
     
     // Initialize the renderer
     Renderer::Init();
+    
+    // Start the worker threads
+    JobSystem::Init();
+#ifdef ENGINE_ENABLE_PROFILING
+    JobSystem::SetHooks(Profiler::GetJobHooks());
+#endif
+}
+
+/**
+ * Delete the rendering application.
+ */
+Application::~Application()
+{
+    FrameStatistics::Shutdown();
+    JobSystem::Shutdown();
+    
+    // The window can no longer be woken up once it is destroyed
+    FrameScheduler::SetWakeCallback(nullptr);
 }
 
 /**
@@ -86,16 +112,64 @@ void Application::Run()
     // Run until the user quits
     while (m_Running)
     {
-        // Per-frame time logic
-        Timestep deltaTime = (float)(timer.Elapsed());
-        timer.Reset();
+        // Wait for the events while there is nothing to render or present (on-demand rendering)
+        if (FrameScheduler::IsIdle())
+        {
+            FrameStatistics::BeginWait();
+            m_Window->WaitEvents(FrameScheduler::GetIdleTimeout());
+            FrameStatistics::EndWait();
+            if (JobSystem::ExecuteMainThreadJobs() > 0)
+                FrameScheduler::RequestRedraw();
+            
+            if (m_Window->GetEventQueue().GetSize() == 0 && FrameScheduler::IsIdle())
+                continue;
+            
+            // The waiting time is not part of the next frame
+            timer.Reset();
+        }
         
-        // Render layers (from bottom to top)
-        for (std::shared_ptr<Layer>& layer : m_LayerStack)
-            layer->OnUpdate(deltaTime);
+        {
+            PROFILE_SCOPE("Frame");
+            
+            // Per-frame time logic
+            Timestep deltaTime = (float)(timer.Elapsed());
+            timer.Reset();
+            FrameStatistics::BeginFrame();
+            FrameScheduler::BeginFrame();
+            
+            // Capture the input state and dispatch the events received since the last frame
+            {
+                PROFILE_SCOPE("Window::ProcessEvents");
+                Input::Update();
+                m_Window->ProcessEvents();
+            }
+            
+            // Execute the work submitted to the main thread (e.g., GL uploads of loaded assets)
+            {
+                PROFILE_SCOPE("JobSystem::ExecuteMainThreadJobs");
+                if (JobSystem::ExecuteMainThreadJobs() > 0)
+                    FrameScheduler::RequestRedraw();
+            }
+            
+            // Render layers (from bottom to top)
+            for (std::shared_ptr<Layer>& layer : m_LayerStack)
+            {
+                PROFILE_SCOPE("Layer::OnUpdate");
+                layer->OnUpdate(deltaTime);
+            }
+            
+            // Record the frame measurements (before the buffers are swapped)
+            FrameStatistics::EndFrame();
+            
+            // Update the window
+            {
+                PROFILE_SCOPE("Window::OnUpdate");
+                m_Window->OnUpdate();
+            }
+        }
         
-        // Update the window
-        m_Window->OnUpdate();
+        // Count the frame for the active profiler capture
+        PROFILE_FRAME();
     }
 }
 
@@ -109,6 +183,9 @@ void Application::OnEvent(Event& e)
     // Define the event dispatcher
     EventDispatcher dispatcher(e);
     
+    // Present a few frames to let the layers (e.g., the GUI) react to the event
+    FrameScheduler::RequestPresent();
+    
     // Dispatch the event to the application event callbacks
     dispatcher.Dispatch<WindowResizeEvent>(
         BIND_EVENT_FN(Application::OnWindowResize));
@@ -132,6 +209,8 @@ void Application::OnEvent(Event& e)
  */
 bool Application::OnWindowResize(WindowResizeEvent &e)
 {
+    // The size of the rendered images changes
+    FrameScheduler::RequestRedraw();
     return false;
 }
 
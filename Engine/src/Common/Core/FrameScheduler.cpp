@@ -0,0 +1,153 @@
+#include "enginepch.h"
+#include "Common/Core/FrameScheduler.h"
+
+#include "Common/Core/JobSystem.h"
+
+#include <atomic>
+
+namespace
+{
+/// Only render the frames when something changed.
+bool g_OnDemand = false;
+/// Longest time waiting for the events while idle (in seconds).
+double g_IdleTimeout = 0.5;
+
+/// Something changed since the last rendered frame (can be requested from any thread).
+std::atomic<bool> g_Dirty = true;
+/// The current frame is fully rendered.
+bool g_FrameRedraw = true;
+/// Number of frames to be presented (e.g., to update the GUI after an input event).
+std::atomic<unsigned int> g_PresentFrames = 0;
+/// Wakes up the main thread waiting for the events.
+std::function<void()> g_Wake;
+} // namespace
+
+/**
+ * Start a new frame.
+ *
+ * @note It must be called from the main thread at the beginning of each frame.
+ */
+void FrameScheduler::BeginFrame()
+{
+    g_FrameRedraw = !g_OnDemand;
+    
+    unsigned int frames = g_PresentFrames.load(std::memory_order_relaxed);
+    while (frames > 0 && !g_PresentFrames.compare_exchange_weak(frames, frames - 1,
+                                                                std::memory_order_relaxed))
+    {}
+}
+
+/**
+ * Check if the offscreen content has to be rendered again in the current frame.
+ *
+ * Once a redraw has been consumed, the rest of the frame is fully rendered as well, so that
+ * several scenes rendered in the same frame stay consistent.
+ *
+ * @return `true` if the frame has to be rendered, `false` if the last image can be presented.
+ */
+bool FrameScheduler::ShouldRedraw()
+{
+    if (!g_FrameRedraw && g_Dirty.exchange(false))
+        g_FrameRedraw = true;
+    return g_FrameRedraw;
+}
+
+/**
+ * Check if there is nothing to render or present.
+ *
+ * @return `true` if the application can wait for the events.
+ */
+bool FrameScheduler::IsIdle()
+{
+    return g_OnDemand && !g_Dirty.load() && g_PresentFrames.load(std::memory_order_relaxed) == 0;
+}
+
+/**
+ * Request the offscreen content to be rendered again (something visible changed).
+ *
+ * @note It can be called from any thread (the main thread is woken up if it is waiting for the
+ * events).
+ */
+void FrameScheduler::RequestRedraw()
+{
+    g_Dirty.store(true, std::memory_order_relaxed);
+    if (!JobSystem::IsMainThread())
+        Wake();
+}
+
+/**
+ * Request the last rendered image (and the GUI) to be presented.
+ *
+ * @param frames The number of frames to be presented.
+ */
+void FrameScheduler::RequestPresent(unsigned int frames)
+{
+    unsigned int current = g_PresentFrames.load(std::memory_order_relaxed);
+    while (current < frames && !g_PresentFrames.compare_exchange_weak(current, frames,
+                                                                      std::memory_order_relaxed))
+    {}
+}
+
+/**
+ * Wake up the main thread if it is waiting for the events (e.g., after submitting work to it).
+ *
+ * @note It can be called from any thread.
+ */
+void FrameScheduler::Wake()
+{
+    if (g_Wake)
+        g_Wake();
+}
+
+/**
+ * Check if the frames are only rendered when something changed.
+ *
+ * @return `true` if the on-demand rendering is enabled.
+ */
+bool FrameScheduler::IsOnDemand()
+{
+    return g_OnDemand;
+}
+
+/**
+ * Get the longest time waiting for the events while idle.
+ *
+ * @return The timeout in seconds.
+ */
+double FrameScheduler::GetIdleTimeout()
+{
+    return g_IdleTimeout;
+}
+
+/**
+ * Enable or disable the on-demand rendering.
+ *
+ * @param enabled Only render the frames when something changed.
+ */
+void FrameScheduler::SetOnDemand(bool enabled)
+{
+    g_OnDemand = enabled;
+    RequestRedraw();
+}
+
+/**
+ * Define the longest time waiting for the events while idle.
+ *
+ * @param seconds The timeout in seconds.
+ */
+void FrameScheduler::SetIdleTimeout(double seconds)
+{
+    g_IdleTimeout = std::max(seconds, 0.0);
+}
+
+/**
+ * Define the function waking up the main thread while it waits for the events.
+ *
+ * @param callback The function (called from any thread).
+ *
+ * @note It must be defined before other threads request any redraw.
+ */
+void FrameScheduler::SetWakeCallback(const std::function<void()>& callback)
+{
+    g_Wake = callback;
+}
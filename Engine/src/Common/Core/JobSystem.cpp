@@ -0,0 +1,473 @@
+#include "enginepch.h"
+#include "Common/Core/JobSystem.h"
+
+#include "Common/Core/FrameScheduler.h"
+
+#include <condition_variable>
+#include <deque>
+
+namespace
+{
+/**
+ * Queue of jobs owned by a thread (the owner uses the back, the thieves use the front).
+ */
+struct WorkQueue
+{
+    std::mutex Mutex;       ///< Protection of the queue.
+    std::deque<Job> Jobs;   ///< Pending jobs.
+};
+
+/// Index of the thread of the job system running the code (0 for the main thread).
+thread_local unsigned int t_ThreadIndex = ~0u;
+
+/// Queue of each thread (the main thread uses the first one).
+std::vector<std::unique_ptr<WorkQueue>> g_Queues;
+/// Queue of the jobs that can only be executed by the main thread.
+WorkQueue g_MainQueue;
+/// Worker threads.
+std::vector<std::thread> g_Workers;
+/// Identifier of the main thread.
+std::thread::id g_MainThread;
+
+/// Running state of the worker threads.
+std::atomic<bool> g_Running = false;
+/// Number of jobs waiting in the thread queues.
+std::atomic<int> g_Pending = 0;
+/// Protection of the sleeping state of the workers.
+std::mutex g_SleepMutex;
+/// Signal used to wake up the workers when jobs are submitted.
+std::condition_variable g_WakeUp;
+
+/// Number of jobs executed.
+std::atomic<unsigned int> g_Executed = 0;
+/// Number of jobs stolen.
+std::atomic<unsigned int> g_Stolen = 0;
+/// Instrumentation callbacks.
+JobHooks g_Hooks;
+} // namespace
+
+/**
+ * Start the worker threads of the job system.
+ *
+ * @param threadCount The number of worker threads (0 to use one per hardware thread, minus the
+ * main thread).
+ *
+ * @note It must be called from the main thread.
+ */
+void JobSystem::Init(unsigned int threadCount)
+{
+    if (IsInitialized())
+        return;
+    
+    if (threadCount == 0)
+        threadCount = std::max(2u, std::thread::hardware_concurrency()) - 1;
+    
+    // Define the main thread
+    g_MainThread = std::this_thread::get_id();
+    t_ThreadIndex = 0;
+    
+    // Define one queue per thread (including the main thread)
+    g_Queues.clear();
+    for (unsigned int i = 0; i <= threadCount; i++)
+        g_Queues.push_back(std::make_unique<WorkQueue>());
+    
+    // Start the workers
+    g_Running = true;
+    for (unsigned int i = 1; i <= threadCount; i++)
+        g_Workers.emplace_back(&JobSystem::WorkerLoop, i);
+    
+    CORE_INFO("Job system started with {0} worker threads", threadCount);
+}
+
+/**
+ * Stop the worker threads of the job system.
+ *
+ * @note The jobs that have not been started yet are discarded.
+ */
+void JobSystem::Shutdown()
+{
+    if (!IsInitialized())
+        return;
+    
+    {
+        std::lock_guard<std::mutex> lock(g_SleepMutex);
+        g_Running = false;
+    }
+    g_WakeUp.notify_all();
+    
+    for (auto& worker : g_Workers)
+        worker.join();
+    g_Workers.clear();
+    
+    if (g_Pending > 0 || !g_MainQueue.Jobs.empty())
+        CORE_WARN("Job system stopped with pending jobs!");
+    
+    g_Queues.clear();
+    g_MainQueue.Jobs.clear();
+    g_Pending = 0;
+}
+
+/**
+ * Submit a job.
+ *
+ * @param function The work to be executed.
+ * @param counter The counter incremented now and decremented when the job finishes (optional).
+ * @param dependency The counter that must reach zero before the job is started (optional).
+ * @param affinity The threads allowed to execute the job.
+ * @param name The name of the job (used for instrumentation).
+ */
+void JobSystem::Run(const std::function<void()>& function, JobCounter* counter,
+                    JobCounter* dependency, JobAffinity affinity, const char* name)
+{
+    Job job = { function, counter, affinity, name };
+    
+    // Execute the job immediately if there are no workers
+    if (!IsInitialized())
+    {
+        job.Counter = nullptr;
+        Execute(job);
+        return;
+    }
+    
+    if (counter)
+        counter->m_Count.fetch_add(1, std::memory_order_relaxed);
+    
+    // Wait for the dependency to be completed (the job is scheduled by the last job of the dependency)
+    if (dependency)
+    {
+        std::lock_guard<std::mutex> lock(dependency->m_Mutex);
+        if (!dependency->IsDone())
+        {
+            dependency->m_Waiting.push_back(std::move(job));
+            return;
+        }
+    }
+    
+    Schedule(job);
+}
+
+/**
+ * Execute a function over a range of indices by splitting it into jobs.
+ *
+ * @param count The number of indices (the range is [0, count)).
+ * @param grainSize The number of indices processed by each job.
+ * @param function The work to be executed for a sub-range [begin, end).
+ * @param counter The counter used to wait for the jobs. If not defined, the function returns
+ * once the whole range has been processed.
+ * @param name The name of the jobs (used for instrumentation).
+ */
+void JobSystem::ParallelFor(unsigned int count, unsigned int grainSize,
+                            const std::function<void(unsigned int, unsigned int)>& function,
+                            JobCounter* counter, const char* name)
+{
+    if (count == 0)
+        return;
+    
+    grainSize = std::max(1u, grainSize);
+    
+    // Process the range directly if it does not need to be split
+    if (!IsInitialized() || count <= grainSize)
+    {
+        if (g_Hooks.OnJobBegin)
+            g_Hooks.OnJobBegin(name, GetThreadIndex());
+        function(0, count);
+        if (g_Hooks.OnJobEnd)
+            g_Hooks.OnJobEnd(name, GetThreadIndex());
+        g_Executed++;
+        return;
+    }
+    
+    // Share a single copy of the function between all the jobs
+    auto shared = std::make_shared<std::function<void(unsigned int, unsigned int)>>(function);
+    
+    JobCounter local;
+    JobCounter* group = counter ? counter : &local;
+    for (unsigned int begin = 0; begin < count; begin += grainSize)
+    {
+        unsigned int end = std::min(count, begin + grainSize);
+        Run([shared, begin, end]() { (*shared)(begin, end); }, group, nullptr, JobAffinity::Any, name);
+    }
+    
+    if (!counter)
+        Wait(local);
+}
+
+/**
+ * Wait until all the jobs of a counter have finished. The calling thread executes other jobs
+ * while waiting.
+ *
+ * @param counter The counter to wait for.
+ */
+void JobSystem::Wait(JobCounter& counter)
+{
+    while (!counter.IsDone())
+    {
+        if (!ExecuteNext())
+            std::this_thread::yield();
+    }
+    
+    // Make sure the thread completing the counter has released it
+    std::lock_guard<std::mutex> lock(counter.m_Mutex);
+}
+
+/**
+ * Execute the jobs that can only run on the main thread.
+ *
+ * @return The number of jobs executed.
+ *
+ * @note It must be called from the main thread (once per frame).
+ */
+unsigned int JobSystem::ExecuteMainThreadJobs()
+{
+    CORE_ASSERT(IsMainThread(), "Main thread jobs executed from another thread!");
+    
+    unsigned int executed = 0;
+    while (true)
+    {
+        Job job;
+        {
+            std::lock_guard<std::mutex> lock(g_MainQueue.Mutex);
+            if (g_MainQueue.Jobs.empty())
+                return executed;
+            job = std::move(g_MainQueue.Jobs.front());
+            g_MainQueue.Jobs.pop_front();
+        }
+        Execute(job);
+        executed++;
+    }
+}
+
+/**
+ * Check if the worker threads have been started.
+ *
+ * @return `true` if the job system is running.
+ */
+bool JobSystem::IsInitialized()
+{
+    return g_Running;
+}
+
+/**
+ * Check if the calling thread is the main thread.
+ *
+ * @return `true` for the main thread (or any thread if the job system is not running).
+ */
+bool JobSystem::IsMainThread()
+{
+    return !IsInitialized() || std::this_thread::get_id() == g_MainThread;
+}
+
+/**
+ * Get the number of threads executing jobs (including the main thread).
+ *
+ * @return The number of threads.
+ */
+unsigned int JobSystem::GetThreadCount()
+{
+    return (unsigned int)g_Workers.size() + 1;
+}
+
+/**
+ * Get the index of the calling thread in the job system.
+ *
+ * @return The index (0 for the main thread and for threads not owned by the job system).
+ */
+unsigned int JobSystem::GetThreadIndex()
+{
+    return t_ThreadIndex == ~0u ? 0 : t_ThreadIndex;
+}
+
+/**
+ * Get the execution statistics.
+ *
+ * @return The statistics since the last reset.
+ */
+JobStatistics JobSystem::GetStats()
+{
+    return { g_Executed.load(), g_Stolen.load() };
+}
+
+/**
+ * Reset the execution statistics.
+ */
+void JobSystem::ResetStats()
+{
+    g_Executed = 0;
+    g_Stolen = 0;
+}
+
+/**
+ * Define the instrumentation callbacks.
+ *
+ * @param hooks The callbacks.
+ *
+ * @note It must be called while no jobs are being executed.
+ */
+void JobSystem::SetHooks(const JobHooks& hooks)
+{
+    g_Hooks = hooks;
+}
+
+/**
+ * Add a job to the queue of the calling thread (or the main thread queue) and wake up a worker.
+ *
+ * @param job The job to be scheduled.
+ */
+void JobSystem::Schedule(Job& job)
+{
+    if (job.Affinity == JobAffinity::MainThread)
+    {
+        {
+            std::lock_guard<std::mutex> lock(g_MainQueue.Mutex);
+            g_MainQueue.Jobs.push_back(std::move(job));
+        }
+        
+        // The main thread may be waiting for the events (on-demand rendering)
+        if (!IsMainThread())
+            FrameScheduler::Wake();
+        return;
+    }
+    
+    // Threads not owned by the job system use the main thread queue
+    WorkQueue& queue = *g_Queues[GetThreadIndex()];
+    {
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        queue.Jobs.push_back(std::move(job));
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(g_SleepMutex);
+        g_Pending++;
+    }
+    g_WakeUp.notify_one();
+}
+
+/**
+ * Mark a job as finished and schedule the jobs depending on its counter (if it was the last one).
+ *
+ * @param job The finished job.
+ */
+void JobSystem::Complete(Job& job)
+{
+    JobCounter* counter = job.Counter;
+    if (!counter)
+        return;
+    
+    std::vector<Job> waiting;
+    {
+        std::lock_guard<std::mutex> lock(counter->m_Mutex);
+        if (counter->m_Count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            waiting.swap(counter->m_Waiting);
+    }
+    
+    // The counter cannot be accessed anymore (it may have been deleted by a waiting thread)
+    for (auto& next : waiting)
+        Schedule(next);
+}
+
+/**
+ * Execute the next available job: main thread jobs (on the main thread), then the jobs of
+ * the own queue, then the jobs stolen from the other queues.
+ *
+ * @return `true` if a job has been executed.
+ */
+bool JobSystem::ExecuteNext()
+{
+    if (!IsInitialized())
+        return false;
+    
+    Job job;
+    bool found = false;
+    
+    // Main thread jobs
+    if (IsMainThread())
+    {
+        std::lock_guard<std::mutex> lock(g_MainQueue.Mutex);
+        if (!g_MainQueue.Jobs.empty())
+        {
+            job = std::move(g_MainQueue.Jobs.front());
+            g_MainQueue.Jobs.pop_front();
+            found = true;
+        }
+    }
+    if (found)
+    {
+        Execute(job);
+        return true;
+    }
+    
+    // Own queue (most recent job first)
+    unsigned int index = GetThreadIndex();
+    unsigned int count = (unsigned int)g_Queues.size();
+    {
+        WorkQueue& queue = *g_Queues[index];
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        if (!queue.Jobs.empty())
+        {
+            job = std::move(queue.Jobs.back());
+            queue.Jobs.pop_back();
+            found = true;
+        }
+    }
+    
+    // Steal from the other queues (oldest job first)
+    for (unsigned int i = 1; i < count && !found; i++)
+    {
+        WorkQueue& queue = *g_Queues[(index + i) % count];
+        std::lock_guard<std::mutex> lock(queue.Mutex);
+        if (!queue.Jobs.empty())
+        {
+            job = std::move(queue.Jobs.front());
+            queue.Jobs.pop_front();
+            found = true;
+            g_Stolen++;
+        }
+    }
+    
+    if (!found)
+        return false;
+    
+    g_Pending--;
+    Execute(job);
+    return true;
+}
+
+/**
+ * Execute a job and mark it as finished.
+ *
+ * @param job The job to be executed.
+ */
+void JobSystem::Execute(Job& job)
+{
+    if (g_Hooks.OnJobBegin)
+        g_Hooks.OnJobBegin(job.Name, GetThreadIndex());
+    
+    job.Function();
+    
+    if (g_Hooks.OnJobEnd)
+        g_Hooks.OnJobEnd(job.Name, GetThreadIndex());
+    
+    g_Executed++;
+    Complete(job);
+}
+
+/**
+ * Main loop of a worker thread.
+ *
+ * @param index The index of the worker thread.
+ */
+void JobSystem::WorkerLoop(unsigned int index)
+{
+    t_ThreadIndex = index;
+    
+    while (g_Running)
+    {
+        if (ExecuteNext())
+            continue;
+        
+        // Sleep until new jobs are submitted
+        std::unique_lock<std::mutex> lock(g_SleepMutex);
+        g_WakeUp.wait_for(lock, std::chrono::milliseconds(2),
+                          []() { return g_Pending > 0 || !g_Running; });
+    }
+}
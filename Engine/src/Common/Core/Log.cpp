@@ -1,6 +1,7 @@
 #include "enginepch.h"
 #include "Common/Core/Log.h"
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
 // --------------------------------------------
@@ -25,8 +26,33 @@ void Log::Init()
     spdlog::set_pattern("%^[%T] %n: [%l] %v%$");
 #endif
     
+    // Define the asynchronous logger (a single background thread keeps the order of the messages)
+    spdlog::init_thread_pool(s_QueueSize, 1);
+    s_CoreLogger = spdlog::stdout_color_mt<spdlog::async_factory_nonblock>("CORE");
+    s_CoreLogger->set_level((spdlog::level::level_enum)CORE_LOG_LEVEL);
+    
+    // Write the errors right away and flush the rest periodically
+    s_CoreLogger->flush_on(spdlog::level::err);
+    spdlog::flush_every(s_FlushInterval);
+}
+
+/**
+ * Shut down the logging manager.
+ *
+ * The queued messages are written before the background thread stops. The messages logged
+ * afterwards (e.g., by static destructors) are written synchronously.
+ */
+void Log::Shutdown()
+{
+    if (!s_CoreLogger)
+        return;
+    
+    s_CoreLogger->flush();
+    spdlog::shutdown();
+    
+    // Keep a synchronous logger (with the same pattern) for the remaining messages
     s_CoreLogger = spdlog::stdout_color_mt("CORE");
-    s_CoreLogger->set_level(spdlog::level::trace);
+    s_CoreLogger->set_level((spdlog::level::level_enum)CORE_LOG_LEVEL);
 }
 
 // --------------------------------------------
@@ -0,0 +1,281 @@
+#include "enginepch.h"
+#include "Common/Core/Profiler.h"
+
+#include <iomanip>
+#include <thread>
+#include <unordered_set>
+
+namespace
+{
+/// Number of events stored by each thread (the oldest ones are overwritten).
+constexpr uint64_t g_BufferSize = 1 << 15;
+
+/**
+ * Ring buffer with the events recorded by one thread (single producer).
+ *
+ * Only the owning thread modifies the events, the head and the epoch. The reader waits until
+ * `Writing` is cleared once the capture is stopped, so it never reads a slot being written.
+ */
+struct ThreadBuffer
+{
+    std::array<ProfileEvent, g_BufferSize> Events;  ///< Recorded events.
+    std::atomic<uint64_t> Head = 0;                 ///< Number of events written.
+    uint64_t Epoch = 0;                             ///< Capture of the recorded events.
+    std::atomic<bool> Writing = false;              ///< Event being recorded by the thread.
+    unsigned int ThreadID = 0;                      ///< Identifier of the thread in the trace.
+    std::string Name;                               ///< Name of the thread in the trace.
+};
+
+/// Buffers of all the threads that recorded events (kept alive until the application ends).
+std::vector<std::unique_ptr<ThreadBuffer>> g_Buffers;
+/// Protection of the list of buffers.
+std::mutex g_BuffersMutex;
+/// Buffer of the current thread.
+thread_local ThreadBuffer* t_Buffer = nullptr;
+
+/// Interned zone names.
+std::unordered_set<std::string> g_Names;
+/// Protection of the interned names.
+std::mutex g_NamesMutex;
+
+/// Start times of the jobs being executed by the current thread (jobs can be nested while waiting).
+thread_local std::vector<uint64_t> t_JobStarts;
+
+/// Identifier of the current capture (the buffers of a previous capture are reset by their thread).
+std::atomic<uint64_t> g_Epoch = 0;
+/// Number of frames left in the current capture.
+unsigned int g_FramesLeft = 0;
+/// Output file of the current capture.
+std::filesystem::path g_CapturePath;
+
+/**
+ * Get (or create) the buffer of the current thread.
+ *
+ * @return The thread buffer.
+ */
+ThreadBuffer& GetThreadBuffer()
+{
+    if (!t_Buffer)
+    {
+        std::lock_guard<std::mutex> lock(g_BuffersMutex);
+        g_Buffers.push_back(std::make_unique<ThreadBuffer>());
+        t_Buffer = g_Buffers.back().get();
+        t_Buffer->ThreadID = (unsigned int)g_Buffers.size() - 1;
+        t_Buffer->Name = "Thread " + std::to_string(t_Buffer->ThreadID);
+    }
+    return *t_Buffer;
+}
+
+/**
+ * Write a string as a JSON value.
+ *
+ * @param stream The output stream.
+ * @param value The string.
+ */
+void WriteJSONString(std::ostream& stream, const char* value)
+{
+    stream << '"';
+    for (const char* c = value; *c; c++)
+    {
+        if (*c == '"' || *c == '\\')
+            stream << '\\';
+        stream << *c;
+    }
+    stream << '"';
+}
+} // namespace
+
+/**
+ * Start recording the profiling zones.
+ *
+ * @param frames The number of frames to be captured.
+ * @param filePath The path of the output trace file (JSON).
+ */
+void Profiler::BeginCapture(unsigned int frames, const std::filesystem::path& filePath)
+{
+    if (IsCapturing())
+    {
+        CORE_WARN("A profiler capture is already running!");
+        return;
+    }
+    
+    // Start a new capture (each thread discards its previous events when it records the first one)
+    g_Epoch.fetch_add(1, std::memory_order_relaxed);
+    
+    g_FramesLeft = std::max(1u, frames);
+    g_CapturePath = filePath;
+    s_Capturing.store(true, std::memory_order_release);
+    
+    CORE_INFO("Profiler capture started ({0} frames)", g_FramesLeft);
+}
+
+/**
+ * Stop recording the profiling zones and write the captured events.
+ */
+void Profiler::EndCapture()
+{
+    if (!IsCapturing())
+        return;
+    
+    // Wait for the threads that are still recording an event
+    s_Capturing.store(false, std::memory_order_seq_cst);
+    {
+        std::lock_guard<std::mutex> lock(g_BuffersMutex);
+        for (auto& buffer : g_Buffers)
+        {
+            while (buffer->Writing.load(std::memory_order_seq_cst))
+                std::this_thread::yield();
+        }
+    }
+    
+    WriteChromeTrace(g_CapturePath);
+}
+
+/**
+ * Mark the end of a frame (the capture ends once the requested number of frames is reached).
+ */
+void Profiler::EndFrame()
+{
+    if (!IsCapturing())
+        return;
+    
+    if (--g_FramesLeft == 0)
+        EndCapture();
+}
+
+/**
+ * Record a zone in the buffer of the current thread.
+ *
+ * @param name The name of the zone.
+ * @param start The start time of the zone.
+ * @param end The end time of the zone.
+ */
+void Profiler::Record(const char* name, uint64_t start, uint64_t end)
+{
+    ThreadBuffer& buffer = GetThreadBuffer();
+    
+    // Announce the write before checking the capture state: either the capture is seen as stopped,
+    // or `EndCapture` sees the flag and waits until the event is written
+    buffer.Writing.store(true, std::memory_order_seq_cst);
+    if (!s_Capturing.load(std::memory_order_seq_cst))
+    {
+        buffer.Writing.store(false, std::memory_order_release);
+        return;
+    }
+    
+    // Discard the events of a previous capture (only this thread modifies its buffer)
+    uint64_t epoch = g_Epoch.load(std::memory_order_relaxed);
+    if (buffer.Epoch != epoch)
+    {
+        buffer.Epoch = epoch;
+        buffer.Head.store(0, std::memory_order_relaxed);
+    }
+    
+    uint64_t head = buffer.Head.load(std::memory_order_relaxed);
+    buffer.Events[head % g_BufferSize] = { name, start, end };
+    buffer.Head.store(head + 1, std::memory_order_relaxed);
+    buffer.Writing.store(false, std::memory_order_release);
+}
+
+/**
+ * Store a copy of a zone name that lives until the application ends (e.g., for names
+ * built at runtime).
+ *
+ * @param name The name of the zone.
+ *
+ * @return The stored name.
+ */
+const char* Profiler::Intern(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(g_NamesMutex);
+    return g_Names.insert(name).first->c_str();
+}
+
+/**
+ * Define the name of the current thread in the traces.
+ *
+ * @param name The thread name.
+ */
+void Profiler::SetThreadName(const std::string& name)
+{
+    ThreadBuffer& buffer = GetThreadBuffer();
+    
+    std::lock_guard<std::mutex> lock(g_BuffersMutex);
+    buffer.Name = name;
+}
+
+/**
+ * Get the callbacks that record the jobs executed by the job system as zones.
+ *
+ * @return The job system instrumentation callbacks.
+ */
+JobHooks Profiler::GetJobHooks()
+{
+    JobHooks hooks;
+    hooks.OnJobBegin = [](const char*, unsigned int)
+    {
+        t_JobStarts.push_back(IsCapturing() ? Now() : 0);
+    };
+    hooks.OnJobEnd = [](const char* name, unsigned int)
+    {
+        uint64_t start = t_JobStarts.back();
+        t_JobStarts.pop_back();
+        if (start && IsCapturing())
+            Record(name, start, Now());
+    };
+    return hooks;
+}
+
+/**
+ * Write the recorded events using the Chrome trace event format (also supported by Perfetto).
+ *
+ * @param filePath The path of the output file.
+ */
+void Profiler::WriteChromeTrace(const std::filesystem::path& filePath)
+{
+    if (filePath.has_parent_path())
+        std::filesystem::create_directories(filePath.parent_path());
+    
+    std::ofstream file(filePath);
+    if (!file.is_open())
+    {
+        CORE_WARN("Failed to write the profiler capture into {0}", filePath.string());
+        return;
+    }
+    
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    file << std::fixed << std::setprecision(3);
+    
+    std::lock_guard<std::mutex> lock(g_BuffersMutex);
+    
+    bool first = true;
+    size_t count = 0;
+    for (auto& buffer : g_Buffers)
+    {
+        // Name of the thread
+        file << (first ? "" : ",") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":"
+             << buffer->ThreadID << ",\"args\":{\"name\":";
+        WriteJSONString(file, buffer->Name.c_str());
+        file << "}}";
+        first = false;
+        
+        // Events of the thread (only the most recent ones if the buffer has wrapped around)
+        uint64_t epoch = g_Epoch.load(std::memory_order_relaxed);
+        uint64_t head = buffer->Epoch == epoch ? buffer->Head.load(std::memory_order_acquire) : 0;
+        uint64_t begin = head > g_BufferSize ? head - g_BufferSize : 0;
+        for (uint64_t i = begin; i < head; i++)
+        {
+            const ProfileEvent& event = buffer->Events[i % g_BufferSize];
+            file << ",{\"name\":";
+            WriteJSONString(file, event.Name);
+            file << ",\"cat\":\"engine\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->ThreadID
+                 << ",\"ts\":" << event.Start * 0.001 << ",\"dur\":" << (event.End - event.Start) * 0.001
+                 << "}";
+        }
+        count += head - begin;
+    }
+    
+    file << "]}";
+    
+    CORE_INFO("Profiler capture with {0} events written into {1}", count, filePath.string());
+}
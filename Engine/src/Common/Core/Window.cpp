@@ -8,6 +8,8 @@
 #include "Common/Event/KeyEvent.h"
 #include "Common/Event/MouseEvent.h"
 
+#include "Common/Core/FrameScheduler.h"
+
 // --------------------------------------------
 // Variable initialization
 // --------------------------------------------
@@ -46,12 +48,8 @@ static void WindowResizeCallback(GLFWwindow *window, int width, int height) noex
     data.Width = width;
     data.Height = height;
     
-    // Call the event callback function with a window resize event
-    if (data.EventCallback)
-    {
-        WindowResizeEvent event(data.Title, width, height);
-        data.EventCallback(event);
-    }
+    // Queue a window resize event
+    data.Events.Push<WindowResizeEvent>(data.Title, width, height);
 }
 
 /**
@@ -64,12 +62,19 @@ static void WindowCloseCallback(GLFWwindow *window)
     // Recover the window information
     WindowData &data = *(WindowData*)glfwGetWindowUserPointer(window);
     
-    // Call the event callback function with a window close event
-    if (data.EventCallback)
-    {
-        WindowCloseEvent event(data.Title);
-        data.EventCallback(event);
-    }
+    // Queue a window close event
+    data.Events.Push<WindowCloseEvent>(data.Title);
+}
+
+/**
+ * Function to be called when the content of the window has to be drawn again (e.g., after being
+ * uncovered).
+ *
+ * @param window Native window.
+ */
+static void WindowRefreshCallback(GLFWwindow *window)
+{
+    FrameScheduler::RequestPresent(1);
 }
 
 /**
@@ -89,32 +94,22 @@ static void KeyCallback(GLFWwindow *window, int key, int scancode,
     
     // Recover the window information
     WindowData &data = *(WindowData*)glfwGetWindowUserPointer(window);
-    if (!data.EventCallback)
-        return;
+    data.Input.SetKey(key, action != GLFW_RELEASE);
     
-    // Call the event callback function with the respective keyboard event
+    // Queue the respective keyboard event
     switch (action)
     {
         case GLFW_PRESS:
-        {
-            KeyPressedEvent event(key, keyCount);
-            data.EventCallback(event);
+            data.Events.Push<KeyPressedEvent>(key, keyCount);
             break;
-        }
         case GLFW_RELEASE:
-        {
             keyCount = 1;
-            KeyReleasedEvent event(key);
-            data.EventCallback(event);
+            data.Events.Push<KeyReleasedEvent>(key);
             break;
-        }
         case GLFW_REPEAT:
-        {
             keyCount++;
-            KeyPressedEvent event(key, keyCount);
-            data.EventCallback(event);
+            data.Events.Push<KeyPressedEvent>(key, keyCount);
             break;
-        }
     }
 }
 
@@ -131,24 +126,17 @@ static void MouseButtonCallback(GLFWwindow *window, int button, int action,
 {
     // Recover the window information
     WindowData &data = *(WindowData*)glfwGetWindowUserPointer(window);
-    if (!data.EventCallback)
-        return;
+    data.Input.SetMouseButton(button, action == GLFW_PRESS);
     
-    // Call the event callback function with the respective mouse event
+    // Queue the respective mouse event
     switch (action)
     {
         case GLFW_PRESS:
-        {
-            MouseButtonPressedEvent event(button);
-            data.EventCallback(event);
+            data.Events.Push<MouseButtonPressedEvent>(button);
             break;
-        }
         case GLFW_RELEASE:
-        {
-            MouseButtonReleasedEvent event(button);
-            data.EventCallback(event);
+            data.Events.Push<MouseButtonReleasedEvent>(button);
             break;
-        }
     }
 }
 
@@ -164,11 +152,9 @@ static void MouseScrolledCallback(GLFWwindow *window, double xOffset,
 {
     // Recover the window information
     WindowData &data = *(WindowData*)glfwGetWindowUserPointer(window);
-    if (!data.EventCallback)
-        return;
     
-    MouseScrolledEvent event((float)xOffset, (float)yOffset);
-    data.EventCallback(event);
+    // Queue the event (added to a previous scroll of the same frame)
+    data.Events.Push<MouseScrolledEvent>((float)xOffset, (float)yOffset);
 }
 
 /**
@@ -182,11 +168,10 @@ static void MouseMovedCallback(GLFWwindow *window, double x, double y) noexcept
 {
     // Recover the window information
     WindowData &data = *(WindowData*)glfwGetWindowUserPointer(window);
-    if (!data.EventCallback)
-        return;
+    data.Input.MousePosition = glm::vec2(x, y);
     
-    MouseMovedEvent event((float)x, (float)y);
-    data.EventCallback(event);
+    // Queue the event (replacing a previous move of the same frame)
+    data.Events.Push<MouseMovedEvent>((float)x, (float)y);
 }
 
 // --------------------------------------------
@@ -198,9 +183,11 @@ static void MouseMovedCallback(GLFWwindow *window, double x, double y) noexcept
  * @param title Window name.
  * @param width Size (width) of the window.
  * @param height Size (height) of the window.
+ * @param visible Show the window on the screen (hidden windows are used for headless rendering).
  */
-Window::Window(const std::string& title, const int width, const int height)
-    : m_Data(title, width, height)
+Window::Window(const std::string& title, const int width, const int height,
+               const bool visible)
+    : m_Data(title, width, height, true, visible)
 {
     Init();
 }
@@ -221,10 +208,38 @@ void Window::OnUpdate() const
     // Swap front and back buffers
     m_Context->SwapBuffers();
     
-    // Poll for and process events
+    // Poll for the events (they are queued until the next frame processes them)
     glfwPollEvents();
 }
 
+/**
+ * Wait until an event is received (without swapping the buffers).
+ *
+ * @param timeout The longest time to wait (in seconds).
+ */
+void Window::WaitEvents(double timeout) const
+{
+    glfwWaitEventsTimeout(timeout);
+}
+
+/**
+ * Wake up the main thread waiting for the events (posts an empty event).
+ *
+ * @note It can be called from any thread.
+ */
+void Window::Wake()
+{
+    glfwPostEmptyEvent();
+}
+
+/**
+ * Dispatch the events received since the last frame to the event callback function.
+ */
+void Window::ProcessEvents()
+{
+    m_Data.Events.Dispatch(m_Data.EventCallback);
+}
+
 /**
  * Define if the window's buffer swap will be synchronized with the vertical
  * refresh rate of the monitor.
@@ -253,6 +268,7 @@ void Window::Init()
     
     // Define the window hints for on the graphics context
     GraphicsContext::SetWindowHints();
+    glfwWindowHint(GLFW_VISIBLE, m_Data.Visible ? GLFW_TRUE : GLFW_FALSE);
     
     // Create a windowed mode window and its OpenGL context
     m_Window = glfwCreateWindow(m_Data.Width, m_Data.Height,
@@ -273,6 +289,7 @@ void Window::Init()
     // Define the event callbacks
     glfwSetFramebufferSizeCallback(m_Window, WindowResizeCallback);
     glfwSetWindowCloseCallback(m_Window, WindowCloseCallback);
+    glfwSetWindowRefreshCallback(m_Window, WindowRefreshCallback);
     
     glfwSetKeyCallback(m_Window, KeyCallback);
     
@@ -282,6 +299,11 @@ void Window::Init()
     
     glfwGetFramebufferSize(m_Window, &m_Data.Width, &m_Data.Height);
     
+    // Define the initial input state (the rest is updated by the callbacks)
+    double x, y;
+    glfwGetCursorPos(m_Window, &x, &y);
+    m_Data.Input.MousePosition = glm::vec2(x, y);
+    
     // Show window created message
     CORE_INFO("Creating '{0}' window ({1} x {2})", m_Data.Title,
               m_Data.Width, m_Data.Height);
@@ -1,11 +1,21 @@
 #include "enginepch.h"
 #include "Common/Input/Input.h"
 
-#include <GL/glew.h>
-#include <GLFW/glfw3.h>
-
 #include "Common/Core/Application.h"
 
+// Define static variables
+InputState Input::s_State;
+
+/**
+ * Capture the input state for the current frame.
+ *
+ * The window keeps the state up to date with the events it receives, so capturing it is a copy.
+ */
+void Input::Update()
+{
+    s_State = Application::Get().GetWindow().GetInputState();
+}
+
 /**
  * Check if a specific keyboard key is currently pressed.
  *
@@ -15,10 +25,7 @@
 */
 bool Input::IsKeyPressed(const KeyCode key)
 {
-    auto window = (GLFWwindow*)Application::Get().GetWindow().GetNativeWindow();
-    auto state = glfwGetKey(window, (int)key);
-    
-    return state == GLFW_PRESS || state == GLFW_REPEAT;
+    return key < s_State.Keys.size() && s_State.Keys.test(key);
 }
 
 /**
@@ -30,23 +37,5 @@ bool Input::IsKeyPressed(const KeyCode key)
  */
 bool Input::IsMouseButtonPressed(const MouseCode button)
 {
-    auto window = (GLFWwindow*)Application::Get().GetWindow().GetNativeWindow();
-    auto state = glfwGetMouseButton(window, (int)button);
-    
-    return state == GLFW_PRESS;
-}
-
-/**
- * Get the current mouse position.
- *
- * @return A 2D vector representing the current mouse position.
- */
-glm::vec2 Input::GetMousePosition()
-{
-    double x, y;
-    
-    auto window = (GLFWwindow*)Application::Get().GetWindow().GetNativeWindow();
-    glfwGetCursorPos(window, &x, &y);
-    
-    return glm::vec2(x, y);
+    return button < s_State.MouseButtons.size() && s_State.MouseButtons.test(button);
 }
@@ -2,7 +2,9 @@
 #include "Common/Layer/GuiLayer.h"
 
 #include "Common/Core/Application.h"
+#include "Common/Core/FrameScheduler.h"
 #include "Common/Renderer/Renderer.h"
+#include "Common/Renderer/FrameStatistics.h"
 
 #include <GLFW/glfw3.h>
 
@@ -126,6 +128,84 @@ void GuiLayer::GUIStats(Timestep ts)
     ImGui::Separator();
     ImGui::Text("Render Passes: %d", stats.renderPasses);
     ImGui::Text("Draw Calls: %d", stats.drawCalls);
+    ImGui::Text("Triangles: %d", stats.triangles);
+    
+    // Frame time distribution over the recorded history
+    unsigned int size = FrameStatistics::GetSize();
+    if (size > 0)
+    {
+        const FrameRecord& last = FrameStatistics::GetRecord(size - 1);
+        FrameTimeSummary summary = FrameStatistics::GetSummary();
+        
+        ImGui::Separator();
+        ImGui::Text("CPU (ms) %.2f", last.CPUTime);
+        // GPU times are only available a few frames later
+        for (unsigned int i = size; i-- > 0 && i + 8 > size; )
+        {
+            const FrameRecord& record = FrameStatistics::GetRecord(i);
+            if (record.GPUTime < 0.0f)
+                continue;
+            
+            ImGui::Text("GPU (ms) %.2f", record.GPUTime);
+            auto& passes = FrameStatistics::GetPassNames();
+            for (unsigned int p = 0; p < passes.size(); p++)
+            {
+                if (record.PassTimes[p] >= 0.0f)
+                    ImGui::BulletText("%s: %.2f", passes[p], record.PassTimes[p]);
+            }
+            break;
+        }
+        
+        // Shadow casters kept for each light in the last frame
+        auto& lights = FrameStatistics::GetLightNames();
+        if (!lights.empty())
+        {
+            ImGui::Text("Shadow casters");
+            for (unsigned int l = 0; l < lights.size(); l++)
+            {
+                if (last.ShadowCasters[l] >= 0)
+                    ImGui::BulletText("%s: %d", lights[l], last.ShadowCasters[l]);
+            }
+        }
+        
+        ImGui::Separator();
+        ImGui::Text("Frames: %d", summary.Frames);
+        ImGui::Text("p50 / p95 / p99 (ms) %.2f / %.2f / %.2f", summary.P50, summary.P95, summary.P99);
+        ImGui::Text("Max (ms) %.2f", summary.Max);
+        ImGui::Text("Hitches (> %.1fx p50): %d", FrameStatistics::GetHitchFactor(), summary.Hitches);
+        
+        // Graph of the last frames
+        static constexpr unsigned int s_GraphFrames = 300;
+        auto frameTime = [](void*, int i)
+        {
+            unsigned int size = FrameStatistics::GetSize();
+            unsigned int count = std::min(size, s_GraphFrames);
+            return FrameStatistics::GetRecord(size - count + i).FrameTime;
+        };
+        ImGui::PlotLines("##FrameTimes", frameTime, nullptr, (int)std::min(size, s_GraphFrames), 0,
+                         "Frame time (ms)", 0.0f, std::max(summary.P99 * 1.5f, 1.0f), ImVec2(0.0f, 60.0f));
+        
+        if (ImGui::Button("Export CSV"))
+            FrameStatistics::ExportCSV("statistics/frames.csv");
+        ImGui::SameLine();
+        if (ImGui::Button("Export JSON"))
+            FrameStatistics::ExportJSON("statistics/frames.json");
+    }
+    
+    // Render the frames only when something changed
+    ImGui::Separator();
+    bool onDemand = FrameScheduler::IsOnDemand();
+    if (ImGui::Checkbox("On-demand rendering", &onDemand))
+        FrameScheduler::SetOnDemand(onDemand);
+    
+#ifdef ENGINE_ENABLE_PROFILING
+    // Capture the next frames with the CPU profiler
+    ImGui::Separator();
+    ImGui::BeginDisabled(Profiler::IsCapturing());
+    if (ImGui::Button("Capture Profile (60 frames)"))
+        Profiler::BeginCapture(60, "profile/capture.json");
+    ImGui::EndDisabled();
+#endif
     
     ImGui::End();
 }
@@ -1,10 +1,13 @@
 #include "enginepch.h"
 #include "Common/Renderer/Buffer/FrameBuffer.h"
 
+#include "Common/Core/FrameScheduler.h"
+
 #include "Common/Renderer/Texture/Texture1D.h"
 #include "Common/Renderer/Texture/Texture2D.h"
 #include "Common/Renderer/Texture/Texture3D.h"
 #include "Common/Renderer/Texture/TextureCube.h"
+#include "Common/Renderer/Texture/Texture2DArray.h"
 
 #define STB_IMAGE_WRITE_IMPLEMENTATION
 #include <stb_image_write.h>
@@ -25,6 +28,7 @@ FrameBuffer::FrameBuffer(const FrameBufferSpecification& spec)
         // Update the information of each attachment
         spec.Width = m_Spec.Width;
         spec.Height = m_Spec.Height;
+        spec.Depth = m_Spec.Depth > 0 ? m_Spec.Depth : spec.Depth;
         spec.MipMaps = m_Spec.MipMaps;
         
         spec.Wrap = spec.Wrap != TextureWrap::None ? spec.Wrap :
@@ -34,7 +38,8 @@ FrameBuffer::FrameBuffer(const FrameBufferSpecification& spec)
         // Depth attachment
         if (utils::OpenGL::IsDepthFormat(spec.Format))
         {
-            spec.Filter = TextureFilter::Nearest;
+            // The comparisons of the shadow samplers are filtered bilinearly
+            spec.Filter = spec.Compare ? TextureFilter::Linear : TextureFilter::Nearest;
             
             // TODO: Add the stencil buffer activation too.
             m_DepthAttachmentSpec = spec;
@@ -50,6 +55,10 @@ FrameBuffer::FrameBuffer(const FrameBufferSpecification& spec)
         }
     }
     
+    // Render into the whole framebuffer by default
+    m_RenderWidth = m_Spec.Width;
+    m_RenderHeight = m_Spec.Height;
+    
     // Define the framebuffer along with all its attachments
     Invalidate();
 }
@@ -63,12 +72,32 @@ FrameBuffer::~FrameBuffer()
 }
 
 /**
- * Bind the framebuffer.
+ * Define the area of the framebuffer rendered into when it is bound. The area starts at the
+ * lower-left corner, so the attachments can be rendered at a lower resolution without being
+ * allocated again.
+ *
+ * @param width The render area width.
+ * @param height The render area height.
+ */
+void FrameBuffer::SetRenderArea(const unsigned int width, const unsigned int height)
+{
+    unsigned int renderWidth = std::clamp(width, 1u, std::max(m_Spec.Width, 1u));
+    unsigned int renderHeight = std::clamp(height, 1u, std::max(m_Spec.Height, 1u));
+    if (renderWidth == m_RenderWidth && renderHeight == m_RenderHeight)
+        return;
+    
+    m_RenderWidth = renderWidth;
+    m_RenderHeight = renderHeight;
+    FrameScheduler::RequestRedraw();
+}
+
+/**
+ * Bind the framebuffer (the viewport covers its render area).
  */
 void FrameBuffer::Bind() const
 {
     glBindFramebuffer(GL_FRAMEBUFFER, m_ID);
-    glViewport(0, 0, m_Spec.Width, m_Spec.Height > 0 ? m_Spec.Height : 1);
+    glViewport(0, 0, m_RenderWidth, m_RenderHeight > 0 ? m_RenderHeight : 1);
 }
 
 /**
@@ -79,7 +108,7 @@ void FrameBuffer::Bind() const
 void FrameBuffer::BindForDrawAttachment(const unsigned int index) const
 {
     glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_ID);
-    glViewport(0, 0, m_Spec.Width, m_Spec.Height > 0 ? m_Spec.Height : 1);
+    glViewport(0, 0, m_RenderWidth, m_RenderHeight > 0 ? m_RenderHeight : 1);
     glDrawBuffer(GL_COLOR_ATTACHMENT0 + index);
 }
 
@@ -95,25 +124,27 @@ void FrameBuffer::BindForReadAttachment(const unsigned int index) const
 }
 
 /**
- * Bind the framebuffer to draw in a specific (cube) color attachment.
+ * Bind the framebuffer to draw in all the layers (or faces) of a specific color attachment.
  *
  * @param index The color attachment index.
- * @param face The face to be selected from the cube attachment.
  * @param level The mipmap level of the texture image to be attached.
+ *
+ * @note Each primitive selects the layer it is rendered into (`gl_Layer`).
  */
-void FrameBuffer::BindForDrawAttachmentCube(const unsigned int index, const unsigned int face,
-                                            const unsigned int level) const
+void FrameBuffer::BindForDrawAttachmentLayers(const unsigned int index, const unsigned int level) const
 {
-    if (m_ColorAttachmentsSpec[index].Type != TextureType::TEXTURECUBE)
+    TextureType type = m_ColorAttachmentsSpec[index].Type;
+    if (type != TextureType::TEXTURECUBE && type != TextureType::TEXTURE2DARRAY)
     {
-        CORE_WARN("Trying to bind for drawing an incorrect attachment type!");
+        CORE_WARN_ONCE("Trying to bind for drawing an incorrect attachment type!");
         return;
     }
     
+    // The layers of the mipmap level are attached at once
     glBindFramebuffer(GL_DRAW_FRAMEBUFFER, m_ID);
-    glViewport(0, 0, m_Spec.Width, m_Spec.Height > 0 ? m_Spec.Height : 1);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face,
-                           m_ColorAttachments[index]->m_ID, level);
+    glViewport(0, 0, std::max(m_Spec.Width >> level, 1u), std::max(m_Spec.Height >> level, 1u));
+    glFramebufferTexture(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + index,
+                         m_ColorAttachments[index]->m_ID, level);
 }
 
 /**
@@ -175,8 +206,8 @@ void FrameBuffer::Blit(const std::shared_ptr<FrameBuffer>& src,
     glBindFramebuffer(GL_READ_FRAMEBUFFER, src->m_ID);
     glBindFramebuffer(GL_DRAW_FRAMEBUFFER, dst->m_ID);
     // Perform the blit operation
-    glBlitFramebuffer(0, 0, src->m_Spec.Width, src->m_Spec.Height,
-                      0, 0, dst->m_Spec.Width, dst->m_Spec.Height,
+    glBlitFramebuffer(0, 0, src->m_RenderWidth, src->m_RenderHeight,
+                      0, 0, dst->m_RenderWidth, dst->m_RenderHeight,
                       mask, utils::OpenGL::TextureFilterToOpenGLType(filter, false));
     
     // Unbind the framebuffers
@@ -206,8 +237,8 @@ void FrameBuffer::BlitColorAttachments(const std::shared_ptr<FrameBuffer>& src,
     glDrawBuffer(GL_COLOR_ATTACHMENT0 + dstIndex);
     
     // Copy the block of pixels from the source to the destination color attachment
-    glBlitFramebuffer(0, 0, src->m_Spec.Width, src->m_Spec.Height,
-                      0, 0, dst->m_Spec.Width, dst->m_Spec.Height,
+    glBlitFramebuffer(0, 0, src->m_RenderWidth, src->m_RenderHeight,
+                      0, 0, dst->m_RenderWidth, dst->m_RenderHeight,
                       GL_COLOR_BUFFER_BIT, utils::OpenGL::TextureFilterToOpenGLType(filter, false));
     
     // Unbind the framebuffers and restore the default draw buffer
@@ -215,6 +246,34 @@ void FrameBuffer::BlitColorAttachments(const std::shared_ptr<FrameBuffer>& src,
     glDrawBuffer(GL_BACK);
 }
 
+/**
+ * Blit the render area of a color attachment into the default framebuffer (screen), scaling it
+ * to the size of the screen.
+ *
+ * @param src The source framebuffer from which to copy the color attachment.
+ * @param width The width of the screen.
+ * @param height The height of the screen.
+ * @param srcIndex The index of the color attachment in the source framebuffer.
+ * @param filter The filtering method used if the render area is scaled.
+ */
+void FrameBuffer::BlitToScreen(const std::shared_ptr<FrameBuffer>& src,
+                               const unsigned int width, const unsigned int height,
+                               const unsigned int srcIndex, const TextureFilter& filter)
+{
+    CORE_ASSERT(src, "Trying to blit an undefined framebuffer");
+    
+    // Bind the source color attachment for reading and the screen for drawing
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, src->m_ID);
+    glReadBuffer(GL_COLOR_ATTACHMENT0 + srcIndex);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    
+    // Copy (and scale) the rendered area into the whole screen
+    glBlitFramebuffer(0, 0, src->m_RenderWidth, src->m_RenderHeight, 0, 0, width, height,
+                      GL_COLOR_BUFFER_BIT, utils::OpenGL::TextureFilterToOpenGLType(filter, false));
+    
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
 /**
  * Reset the size of the framebuffer.
  *
@@ -236,8 +295,13 @@ void FrameBuffer::Resize(const unsigned int width, const unsigned int height,
     
     m_DepthAttachmentSpec.SetTextureSize(width, height, depth);
     
-    // Reset the framebuffer
+    // The render area covers the whole framebuffer again
+    m_RenderWidth = width;
+    m_RenderHeight = height;
+    
+    // Reset the framebuffer (its content has to be rendered again)
     Invalidate();
+    FrameScheduler::RequestRedraw();
 }
 
 /**
@@ -295,6 +359,8 @@ void FrameBuffer::Invalidate()
                         return std::make_shared<Texture3D>(m_ColorAttachmentsSpec[i]);
                     case TextureType::TEXTURECUBE: 
                         return std::make_shared<TextureCube>(m_ColorAttachmentsSpec[i]);
+                    case TextureType::TEXTURE2DARRAY:
+                        return std::make_shared<Texture2DArray>(m_ColorAttachmentsSpec[i]);
                     case TextureType::None:
                     default: return nullptr;
                 }
@@ -326,8 +392,10 @@ void FrameBuffer::Invalidate()
                                            m_ColorAttachments[i]->TextureTarget(), m_ColorAttachments[i]->m_ID, 0, 0);
                     break;
                 case TextureType::TEXTURECUBE:
-                    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, 
-                                           m_ColorAttachments[i]->TextureTarget(), m_ColorAttachments[i]->m_ID, 0);
+                case TextureType::TEXTURE2DARRAY:
+                    // All the layers are attached (each primitive selects its layer when rendering)
+                    glFramebufferTexture(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i,
+                                         m_ColorAttachments[i]->m_ID, 0);
                     break;
                 case TextureType::None:
                 default:
@@ -340,10 +408,25 @@ void FrameBuffer::Invalidate()
     if(m_DepthAttachmentSpec.Format != TextureFormat::None &&
        utils::OpenGL::IsDepthFormat(m_DepthAttachmentSpec.Format))
     {
-        m_DepthAttachment = std::make_shared<Texture2D>(m_DepthAttachmentSpec, m_Spec.Samples);
-        m_DepthAttachment->CreateTexture(nullptr);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, utils::OpenGL::TextureFormatToOpenGLDepthType(m_DepthAttachment->m_Spec.Format),
-                               m_DepthAttachment->TextureTarget(), m_DepthAttachment->m_ID, 0);
+        // Layered depth attachment (all the layers, or faces, are attached)
+        if (m_DepthAttachmentSpec.Type == TextureType::TEXTURE2DARRAY ||
+            m_DepthAttachmentSpec.Type == TextureType::TEXTURECUBE)
+        {
+            if (m_DepthAttachmentSpec.Type == TextureType::TEXTURECUBE)
+                m_DepthAttachment = std::make_shared<TextureCube>(m_DepthAttachmentSpec);
+            else
+                m_DepthAttachment = std::make_shared<Texture2DArray>(m_DepthAttachmentSpec);
+            m_DepthAttachment->CreateTexture(nullptr);
+            glFramebufferTexture(GL_FRAMEBUFFER, utils::OpenGL::TextureFormatToOpenGLDepthType(m_DepthAttachment->m_Spec.Format),
+                                 m_DepthAttachment->m_ID, 0);
+        }
+        else
+        {
+            m_DepthAttachment = std::make_shared<Texture2D>(m_DepthAttachmentSpec, m_Spec.Samples);
+            m_DepthAttachment->CreateTexture(nullptr);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, utils::OpenGL::TextureFormatToOpenGLDepthType(m_DepthAttachment->m_Spec.Format),
+                                   m_DepthAttachment->TextureTarget(), m_DepthAttachment->m_ID, 0);
+        }
     }
     
     // Draw the color attachments
@@ -0,0 +1,97 @@
+#include "enginepch.h"
+#include "Common/Renderer/Buffer/StorageBuffer.h"
+
+#include <GL/glew.h>
+
+/**
+ * Generate a storage buffer and (optionally) initialize it with the input data.
+ *
+ * @param size Size of the buffer in bytes.
+ * @param data Initial data of the buffer.
+ */
+StorageBuffer::StorageBuffer(const unsigned int size, const void *data)
+    : m_Size(size)
+{
+    glGenBuffers(1, &m_ID);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ID);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, size, data, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+/**
+ * Delete the storage buffer.
+ */
+StorageBuffer::~StorageBuffer()
+{
+    glDeleteBuffers(1, &m_ID);
+}
+
+/**
+ * Bind the storage buffer.
+ */
+void StorageBuffer::Bind() const
+{
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_ID);
+}
+
+/**
+ * Bind the storage buffer to an indexed binding point (`layout (binding = N)` in the shaders).
+ *
+ * @param binding The binding point index.
+ */
+void StorageBuffer::BindToBindingPoint(const unsigned int binding) const
+{
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, m_ID);
+}
+
+/**
+ * Unbind the storage buffer.
+ */
+void StorageBuffer::Unbind() const
+{
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+/**
+ * Update (part of) the data of the buffer.
+ *
+ * @param data The input data.
+ * @param size Size of the data in bytes.
+ * @param offset Offset (in bytes) where the data is written.
+ */
+void StorageBuffer::SetData(const void *data, const unsigned int size, const unsigned int offset)
+{
+    CORE_ASSERT(offset + size <= m_Size, "Data exceeds the size of the storage buffer!");
+    
+    Bind();
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, size, data);
+    Unbind();
+}
+
+/**
+ * Read back (part of) the data of the buffer.
+ *
+ * @param data The output data.
+ * @param size Size of the data in bytes.
+ * @param offset Offset (in bytes) where the data is read.
+ *
+ * @note This call waits for all the commands writing into the buffer to finish.
+ */
+void StorageBuffer::GetData(void *data, const unsigned int size, const unsigned int offset) const
+{
+    CORE_ASSERT(offset + size <= m_Size, "Data exceeds the size of the storage buffer!");
+    
+    Bind();
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, offset, size, data);
+    Unbind();
+}
+
+/**
+ * Set all the data of the buffer to zero.
+ */
+void StorageBuffer::Clear()
+{
+    Bind();
+    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+    Unbind();
+}
@@ -52,6 +52,43 @@ void VertexArray::AddVertexBuffer(const std::shared_ptr<VertexBuffer>& vbo)
     
 }
 
+/**
+ * Link an input storage buffer to the vertex array as per-instance attributes.
+ *
+ * @param sbo Storage buffer (e.g., written by a compute shader).
+ * @param layout Layout of the attributes inside the buffer.
+ */
+void VertexArray::AddInstanceBuffer(const std::shared_ptr<StorageBuffer>& sbo,
+                                    const BufferLayout& layout)
+{
+    // Check if a layout has been defined for the buffer
+    CORE_ASSERT(layout.GetElements().size(), "Instance buffer has no layout!");
+    
+    // Bind the vertex array and the buffer
+    Bind();
+    glBindBuffer(GL_ARRAY_BUFFER, sbo->m_ID);
+    // Define the vertex attribute pointers (advancing once per instance)
+    for (const auto& element : layout)
+    {
+        if (element.Type == DataType::Int || element.Type == DataType::UInt)
+            glVertexAttribIPointer(m_Index, 1, utils::OpenGL::DataTypeToOpenGLType(element.Type),
+                layout.GetStride(), (const void*)(size_t)element.Offset);
+        else
+            glVertexAttribPointer(m_Index, utils::OpenGL::GetCompCountOfType(element.Type),
+                utils::OpenGL::DataTypeToOpenGLType(element.Type), element.Normalized,
+                layout.GetStride(), (const void*)(size_t)element.Offset);
+        glVertexAttribDivisor(m_Index, 1);
+        glEnableVertexAttribArray(m_Index);
+        m_Index++;
+    }
+    
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    Unbind();
+    
+    // Add to the list of instance buffers linked
+    m_InstanceBuffers.push_back(sbo);
+}
+
 /**
  * Bind the vertex array.
  */
@@ -68,6 +68,24 @@ void Camera::SetViewportSize(const int width, const int height)
     UpdateProjectionMatrix();
 }
 
+/**
+ * Change the camera position and orientation at once (e.g., to follow a node of the scene).
+ *
+ * The target is moved to keep the same distance in front of the camera.
+ *
+ * @param position The camera center position.
+ * @param orientation The camera orientation.
+ */
+void Camera::SetPose(const glm::vec3& position, const glm::quat& orientation)
+{
+    float distance = glm::length(m_Target - m_Position);
+    
+    m_Position = position;
+    m_Rotation = -glm::degrees(glm::eulerAngles(orientation));
+    m_Target = m_Position + GetFowardDirection() * (distance > 0.0f ? distance : 1.0f);
+    UpdateViewMatrix();
+}
+
 /**
  * @brief Calculate the pitch angle of the camera (x-axis).
  *
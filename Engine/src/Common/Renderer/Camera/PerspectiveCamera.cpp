@@ -1,6 +1,8 @@
 #include "enginepch.h"
 #include "Common/Renderer/Camera/PerspectiveCamera.h"
 
+#include "Common/Core/FrameScheduler.h"
+
 #include "Common/Input/Input.h"
 #include "Common/Input/KeyCodes.h"
 #include "Common/Input/MouseCodes.h"
@@ -63,6 +65,9 @@ void PerspectiveCamera::OnUpdate(Timestep ts)
         distance.z = -ts * m_TranslationFactor;
     
     Translate(distance);
+    bool translate = Input::IsKeyPressed(Key::Q) || Input::IsKeyPressed(Key::E) ||
+                     Input::IsKeyPressed(Key::D) || Input::IsKeyPressed(Key::A) ||
+                     Input::IsKeyPressed(Key::W) || Input::IsKeyPressed(Key::S);
     
     // Camera rotation and orbit
     const glm::vec2 &mouse = Input::GetMousePosition();
@@ -70,10 +75,17 @@ void PerspectiveCamera::OnUpdate(Timestep ts)
     deltaMouse *= ts;
     initialMousePosition = mouse;
     
-    if (Input::IsMouseButtonPressed(Mouse::ButtonLeft))
+    bool orbit = Input::IsMouseButtonPressed(Mouse::ButtonLeft);
+    bool rotate = Input::IsMouseButtonPressed(Mouse::ButtonRight);
+    if (orbit)
         Orbit(deltaMouse * m_OrbitFactor);
-    if (Input::IsMouseButtonPressed(Mouse::ButtonRight))
+    if (rotate)
         Rotate(deltaMouse * m_RotationFactor);
+    
+    // Keep rendering while the camera moves (the held keys do not generate events, so the
+    // on-demand rendering would otherwise wait for the next one)
+    if (translate || ((orbit || rotate) && deltaMouse != glm::vec2(0.0f)))
+        FrameScheduler::RequestRedraw();
 }
 
 /**
@@ -0,0 +1,261 @@
+#include "enginepch.h"
+#include "Common/Renderer/Culling/GPUCulling.h"
+
+#include "Common/Renderer/Renderer.h"
+
+#include <GL/glew.h>
+
+/// Number of objects tested by each work group of the culling shader.
+static const unsigned int g_WorkGroupSize = 64;
+
+/**
+ * Define a culling stage.
+ *
+ * @param filePath The shader file path used to draw the visible objects.
+ */
+GPUCulling::GPUCulling(const std::filesystem::path& filePath)
+{
+    // Define the material used to draw the objects
+    m_Material = std::make_shared<Material>(filePath);
+    
+    // Get the culling shader (shared with the other culling stages)
+    m_CullingShader = GetCullingShader();
+}
+
+/**
+ * Define a culling stage that draws the visible objects with an existing material.
+ *
+ * @param material The material used to draw the visible objects (its shader must read the model
+ * matrices from the objects buffer).
+ */
+GPUCulling::GPUCulling(const std::shared_ptr<Material>& material)
+    : m_Material(material)
+{
+    // Get the culling shader (shared with the other culling stages)
+    m_CullingShader = GetCullingShader();
+}
+
+/**
+ * Check if the GPU culling stage can be used with the current context.
+ *
+ * @return `true` if compute shaders and multi-draw indirect are supported.
+ */
+bool GPUCulling::IsSupported()
+{
+    return Renderer::IsComputeSupported() && GLEW_ARB_multi_draw_indirect;
+}
+
+/**
+ * Get the culling shader, loading it if no other culling stage is using it.
+ *
+ * @return The culling shader, or `nullptr` if the culling stage is not supported.
+ *
+ * @note Only the culling stages own the shader, so it is released with them (while the context is
+ * still valid) instead of at the static destruction.
+ */
+std::shared_ptr<Shader> GPUCulling::GetCullingShader()
+{
+    if (!IsSupported())
+        return nullptr;
+    
+    std::shared_ptr<Shader> shader = s_CullingShader.lock();
+    if (!shader)
+    {
+        shader = Shader::Create("Resources/shaders/culling/FrustumCulling.glsl");
+        s_CullingShader = shader;
+    }
+    return shader;
+}
+
+/**
+ * Check if the geometry and objects have been defined, and if the models have not modified their
+ * meshes since then.
+ *
+ * @return `true` if the culling stage is ready to be used.
+ */
+bool GPUCulling::IsBuilt() const
+{
+    if (!m_Built)
+        return false;
+    
+    for (unsigned int i = 0; i < m_Models.size(); i++)
+    {
+        if (m_Models[i] && m_Models[i]->GetRevision() != m_Revisions[i])
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Pack the geometry of the models and define the objects to be culled.
+ *
+ * @param models The models to be drawn by the culling stage (identified by their position in the
+ * list, see `SetModelEnabled`).
+ *
+ * @note Only the models drawn as triangles are considered.
+ */
+void GPUCulling::Build(const std::vector<std::shared_ptr<BaseModel>>& models)
+{
+    // Reset the previous definition
+    m_VertexArray.reset();
+    m_Models.clear();
+    m_Revisions.clear();
+    m_Enabled.clear();
+    m_Objects.clear();
+    m_ObjectModel.clear();
+    
+    // Pack the geometry of all the models
+    std::vector<glm::vec4> positions;
+    std::vector<unsigned int> indices;
+    for (auto& model : models)
+    {
+        // Keep every model, so they are identified by their position in the list
+        unsigned int index = (unsigned int)m_Models.size();
+        m_Models.push_back(model);
+        m_Revisions.push_back(model ? model->GetRevision() : 0);
+        m_Enabled.push_back(true);
+        
+        if (!model || model->GetPrimitive() != PrimitiveType::Triangles)
+            continue;
+        
+        std::vector<MeshRange> ranges;
+        model->GetGeometry(positions, indices, ranges);
+        
+        // Define an object for each mesh of the model (bounded by the vertices of the mesh)
+        for (unsigned int r = 0; r < ranges.size(); r++)
+        {
+            auto& range = ranges[r];
+            size_t end = r + 1 < ranges.size() ? ranges[r + 1].BaseVertex : positions.size();
+            
+            glm::vec3 min(std::numeric_limits<float>::max());
+            glm::vec3 max(std::numeric_limits<float>::lowest());
+            for (size_t v = range.BaseVertex; v < end; v++)
+            {
+                min = glm::min(min, glm::vec3(positions[v]));
+                max = glm::max(max, glm::vec3(positions[v]));
+            }
+            
+            ObjectData object;
+            object.BBoxMin = glm::vec4(min, 1.0f);
+            object.BBoxMax = glm::vec4(max, 1.0f);
+            object.Draw = glm::uvec4(range.IndexCount, range.FirstIndex, (unsigned int)range.BaseVertex, 1);
+            m_Objects.push_back(object);
+            m_ObjectModel.push_back(index);
+        }
+    }
+    
+    m_Built = true;
+    if (m_Objects.empty())
+        return;
+    
+    // Define the shared geometry buffers
+    m_VertexArray = std::make_shared<VertexArray>();
+    m_VertexBuffer = std::make_shared<VertexBuffer>(positions.data(),
+        (unsigned int)(positions.size() * sizeof(glm::vec4)), (unsigned int)positions.size());
+    m_VertexBuffer->SetLayout({ { "a_Position", DataType::Vec4 } });
+    m_VertexArray->AddVertexBuffer(m_VertexBuffer);
+    
+    m_IndexBuffer = std::make_shared<IndexBuffer>(indices.data(), (unsigned int)indices.size());
+    m_VertexArray->SetIndexBuffer(m_IndexBuffer);
+    
+    unsigned int objectCount = (unsigned int)m_Objects.size();
+    
+    // Define the buffers used by the culling shader
+    m_ObjectBuffer = std::make_shared<StorageBuffer>(objectCount * sizeof(ObjectData));
+    m_CommandBuffer = std::make_shared<StorageBuffer>(objectCount * sizeof(DrawElementsIndirectCommand));
+    m_ParameterBuffer = std::make_shared<StorageBuffer>(sizeof(unsigned int));
+    
+    // Define the instance buffer, read as a per-instance attribute (object index)
+    m_InstanceBuffer = std::make_shared<StorageBuffer>(objectCount * sizeof(unsigned int));
+    m_VertexArray->AddInstanceBuffer(m_InstanceBuffer, { { "a_ObjectIndex", DataType::UInt } });
+}
+
+/**
+ * Test the objects against the view frustum and generate the compacted list of draw commands.
+ *
+ * @param viewProjection The view-projection matrix defining the frustum.
+ */
+void GPUCulling::Cull(const glm::mat4& viewProjection)
+{
+    if (m_Objects.empty() || !m_CullingShader)
+        return;
+    
+    // Upload the current transformation of the objects
+    UpdateObjects();
+    
+    // Reset the draw count and the draw commands (unused commands are drawn with zero
+    // indices when the draw count cannot be read from the buffer)
+    m_ParameterBuffer->Clear();
+    m_CommandBuffer->Clear();
+    
+    // Define the culling parameters
+    m_CullingShader->Bind();
+    m_CullingShader->SetMat4("u_Culling.ViewProjection", viewProjection);
+    m_CullingShader->SetInt("u_Culling.ObjectCount", (int)m_Objects.size());
+    m_CullingShader->SetBool("u_Culling.Occlusion", m_OcclusionMap != nullptr);
+    if (m_OcclusionMap)
+    {
+        m_OcclusionMap->BindToTextureUnit(0);
+        m_CullingShader->SetInt("u_OcclusionMap", 0);
+    }
+    
+    // Bind the buffers and run the culling
+    m_ObjectBuffer->BindToBindingPoint(0);
+    m_CommandBuffer->BindToBindingPoint(1);
+    m_InstanceBuffer->BindToBindingPoint(2);
+    m_ParameterBuffer->BindToBindingPoint(3);
+    
+    unsigned int groups = ((unsigned int)m_Objects.size() + g_WorkGroupSize - 1) / g_WorkGroupSize;
+    Renderer::Dispatch(m_CullingShader, groups);
+    
+    // Make the results visible to the indirect draw
+    MemoryBarrierFlags barrier;
+    barrier.StorageBuffer = true;
+    barrier.VertexAttribute = true;
+    barrier.IndirectCommand = true;
+    Renderer::SetMemoryBarrier(barrier);
+    
+    m_CullingShader->Unbind();
+}
+
+/**
+ * Draw the visible objects (generated by the last culling).
+ */
+void GPUCulling::Draw()
+{
+    if (m_Objects.empty())
+        return;
+    
+    // The drawing shader reads the model matrices from the objects buffer
+    m_ObjectBuffer->BindToBindingPoint(0);
+    
+    Renderer::DrawIndirect(m_VertexArray, m_Material, m_CommandBuffer, m_ParameterBuffer,
+                           (unsigned int)m_Objects.size());
+}
+
+/**
+ * Enable or disable the drawing of a model (e.g., a hidden model, or a model that does not cast
+ * shadows in the current frame). The disabled models are skipped by the culling shader.
+ *
+ * @param model The position of the model in the list used to build the culling stage.
+ * @param enabled `true` to test and draw the objects of the model.
+ */
+void GPUCulling::SetModelEnabled(unsigned int model, bool enabled)
+{
+    if (model < m_Enabled.size())
+        m_Enabled[model] = enabled;
+}
+
+/**
+ * Upload the current model matrix (and state) of each object.
+ */
+void GPUCulling::UpdateObjects()
+{
+    for (unsigned int i = 0; i < m_Objects.size(); i++)
+    {
+        m_Objects[i].Model = m_Models[m_ObjectModel[i]]->GetModelMatrix();
+        m_Objects[i].Draw.w = m_Enabled[m_ObjectModel[i]] ? 1 : 0;
+    }
+    
+    m_ObjectBuffer->SetData(m_Objects.data(), (unsigned int)(m_Objects.size() * sizeof(ObjectData)));
+}
@@ -0,0 +1,124 @@
+#include "enginepch.h"
+#include "Common/Renderer/DynamicResolution.h"
+
+#include "Common/Renderer/FrameStatistics.h"
+
+#include <cmath>
+
+namespace
+{
+/// Number of GPU times measured at a scale before correcting it.
+constexpr unsigned int g_MinSamples = 8;
+/// Weight of a new GPU time in the smoothed time.
+constexpr float g_Smoothing = 0.2f;
+/// Fraction of the budget below which the scale is increased again.
+constexpr float g_Headroom = 0.85f;
+/// Largest modification of the scale in a single correction.
+constexpr float g_MaxStep = 0.1f;
+/// Granularity of the scale (the corrections are rounded down to it).
+constexpr float g_Granularity = 1.0f / 64.0f;
+} // namespace
+
+/**
+ * Update the render scale with the GPU times measured since the last update.
+ *
+ * @return `true` if the render scale has been modified.
+ */
+bool DynamicResolution::Update()
+{
+    if (!m_Enabled)
+        return false;
+    
+    // Only the frames whose GPU times have already been read back are considered
+    uint64_t frame = FrameStatistics::GetFrameIndex();
+    unsigned int size = FrameStatistics::GetSize();
+    uint64_t first = frame - size;
+    for (unsigned int i = (unsigned int)(std::max(m_NextFrame, first) - first); i < size; i++)
+    {
+        const FrameRecord& record = FrameStatistics::GetRecord(i);
+        if (record.Index + FrameStatistics::QueryLatency >= frame)
+            break;
+        
+        m_NextFrame = record.Index + 1;
+        if (record.GPUTime < 0.0f)
+            continue;
+        
+        m_GPUTime = m_Samples == 0 ? record.GPUTime :
+                    m_GPUTime + g_Smoothing * (record.GPUTime - m_GPUTime);
+        m_Samples++;
+    }
+    
+    // Keep the scale while the frames fit in the budget with some headroom
+    if (m_Samples < g_MinSamples || m_GPUTime <= 0.0f ||
+        (m_GPUTime <= m_Budget && m_GPUTime >= g_Headroom * m_Budget))
+        return false;
+    
+    // The cost of a frame is proportional to the number of pixels (the square of the scale)
+    float target = m_Scale * std::sqrt(m_Budget / m_GPUTime);
+    target = std::clamp(target, m_Scale - g_MaxStep, m_Scale + g_MaxStep);
+    target = std::floor(target / g_Granularity) * g_Granularity;
+    target = std::clamp(target, m_MinScale, m_MaxScale);
+    if (target == m_Scale)
+        return false;
+    
+    SetScale(target);
+    return true;
+}
+
+/**
+ * Restore the maximum render scale and discard the measured GPU times.
+ */
+void DynamicResolution::Reset()
+{
+    SetScale(m_MaxScale);
+}
+
+/**
+ * Enable or disable the control of the render scale (the maximum scale is used when disabled).
+ *
+ * @param enabled The enabled flag.
+ */
+void DynamicResolution::SetEnabled(bool enabled)
+{
+    m_Enabled = enabled;
+    Reset();
+}
+
+/**
+ * Define the GPU time budget of a frame.
+ *
+ * @param budget The budget (in milliseconds).
+ */
+void DynamicResolution::SetBudget(float budget)
+{
+    CORE_ASSERT(budget > 0.0f, "Invalid frame time budget!");
+    m_Budget = budget;
+}
+
+/**
+ * Define the range of the render scale.
+ *
+ * @param minScale The minimum scale.
+ * @param maxScale The maximum scale (1 renders at the full size of the target).
+ */
+void DynamicResolution::SetScaleRange(float minScale, float maxScale)
+{
+    CORE_ASSERT(minScale > 0.0f && minScale <= maxScale && maxScale <= 1.0f,
+                "Invalid render scale range!");
+    m_MinScale = minScale;
+    m_MaxScale = maxScale;
+    SetScale(std::clamp(m_Scale, m_MinScale, m_MaxScale));
+}
+
+/**
+ * Modify the render scale and start measuring the frames rendered with it (from the current one).
+ *
+ * @param scale The render scale.
+ */
+void DynamicResolution::SetScale(float scale)
+{
+    m_Scale = scale;
+    m_GPUTime = -1.0f;
+    m_Samples = 0;
+    m_NextFrame = FrameStatistics::GetFrameIndex();
+}
@@ -0,0 +1,540 @@
+#include "enginepch.h"
+#include "Common/Renderer/FrameStatistics.h"
+
+#include "Common/Renderer/Renderer.h"
+
+#include <GL/glew.h>
+
+namespace
+{
+/// Number of frames the GPU queries are kept before being read back.
+constexpr unsigned int g_QueryLatency = FrameStatistics::QueryLatency;
+/// Number of timestamp queries per frame (frame begin/end, then begin/end of each pass).
+constexpr unsigned int g_QueriesPerFrame = 2 + 2 * g_MaxTimedPasses;
+
+/**
+ * Represents the timestamp queries issued during a frame.
+ */
+struct QuerySet
+{
+    ///< Query objects.
+    std::array<unsigned int, g_QueriesPerFrame> IDs = {};
+    ///< Passes timed in the frame (slot of each timed pass, in order).
+    std::vector<unsigned int> Passes;
+    ///< Index of the frame that issued the queries.
+    uint64_t Frame = 0;
+    ///< The queries are waiting to be read.
+    bool Pending = false;
+};
+
+/// Recorded frames (ring buffer).
+std::vector<FrameRecord> g_Records;
+/// Number of frames recorded since the application started.
+uint64_t g_FrameCount = 0;
+
+/// Names of the timed passes (interned, compared by address).
+std::vector<const char*> g_PassNames;
+/// Names of the lights with counted shadow casters (interned, compared by address).
+std::vector<const char*> g_LightNames;
+/// Number of shadow casters of each light in the current frame (negative if not counted).
+std::array<int, g_MaxCountedLights> g_ShadowCasters;
+
+/// Timestamp queries of the last frames.
+std::array<QuerySet, g_QueryLatency> g_Queries;
+/// The query objects have been created.
+bool g_QueriesCreated = false;
+/// Pass being timed (or -1 if none).
+int g_CurrentPass = -1;
+
+/// Start of the current frame.
+std::chrono::steady_clock::time_point g_FrameStart;
+/// Start of the previous frame.
+std::chrono::steady_clock::time_point g_PreviousFrameStart;
+/// Start of the current wait for the events (on-demand rendering).
+std::chrono::steady_clock::time_point g_WaitStart;
+/// Time spent waiting for the events since the last frame (not part of the next frame time).
+std::chrono::steady_clock::duration g_WaitTime = std::chrono::steady_clock::duration::zero();
+/// A frame is being recorded.
+bool g_InFrame = false;
+
+/// Frames longer than this factor times the median are counted as hitches.
+float g_HitchFactor = 2.0f;
+/// File written when the application ends (empty if none).
+std::filesystem::path g_ExportPath;
+
+/**
+ * Get the elapsed time between two time points.
+ *
+ * @param start The first time point.
+ * @param end The second time point.
+ *
+ * @return The elapsed time (in milliseconds).
+ */
+float ElapsedMilliseconds(const std::chrono::steady_clock::time_point& start,
+                          const std::chrono::steady_clock::time_point& end)
+{
+    return std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+/**
+ * Get the value of a percentile from a list of values.
+ *
+ * @param values The values (reordered by the function).
+ * @param percentile The percentile (between 0 and 1).
+ *
+ * @return The value of the percentile.
+ */
+float Percentile(std::vector<float>& values, float percentile)
+{
+    size_t n = (size_t)(percentile * (float)(values.size() - 1) + 0.5f);
+    std::nth_element(values.begin(), values.begin() + n, values.end());
+    return values[n];
+}
+
+/**
+ * Prepare the output file of an export.
+ *
+ * @param filePath The path of the file.
+ * @param file The output file stream.
+ *
+ * @return `true` if the file can be written.
+ */
+bool OpenExportFile(const std::filesystem::path& filePath, std::ofstream& file)
+{
+    if (filePath.has_parent_path())
+        std::filesystem::create_directories(filePath.parent_path());
+    
+    file.open(filePath);
+    if (!file.is_open())
+    {
+        CORE_WARN("Failed to write the frame statistics into {0}", filePath.string());
+        return false;
+    }
+    return true;
+}
+} // namespace
+
+/**
+ * Start recording a frame.
+ */
+void FrameStatistics::BeginFrame()
+{
+    if (g_Records.empty())
+        g_Records.resize(Capacity);
+    
+    if (!g_QueriesCreated)
+    {
+        for (auto& set : g_Queries)
+            glGenQueries(g_QueriesPerFrame, set.IDs.data());
+        g_QueriesCreated = true;
+    }
+    
+    auto now = std::chrono::steady_clock::now();
+    g_PreviousFrameStart = g_FrameCount == 0 ? now : g_FrameStart + g_WaitTime;
+    g_FrameStart = now;
+    g_WaitTime = std::chrono::steady_clock::duration::zero();
+    g_InFrame = true;
+    g_ShadowCasters.fill(-1);
+    
+    // Read the results of the oldest frame before reusing its queries
+    ReadQueries();
+    
+    QuerySet& set = g_Queries[g_FrameCount % g_QueryLatency];
+    set.Frame = g_FrameCount;
+    set.Passes.clear();
+    glQueryCounter(set.IDs[0], GL_TIMESTAMP);
+}
+
+/**
+ * Start waiting for the events between two frames (e.g., while the on-demand rendering is idle).
+ */
+void FrameStatistics::BeginWait()
+{
+    g_WaitStart = std::chrono::steady_clock::now();
+}
+
+/**
+ * Stop waiting for the events. The waiting time is not counted in the time of the next frame.
+ */
+void FrameStatistics::EndWait()
+{
+    g_WaitTime += std::chrono::steady_clock::now() - g_WaitStart;
+}
+
+/**
+ * Finish recording a frame and store its measurements in the history.
+ *
+ * @note It should be called before the buffers are swapped, and before the rendering statistics
+ * are reset for the next frame.
+ */
+void FrameStatistics::EndFrame()
+{
+    if (!g_InFrame)
+        return;
+    
+    if (g_CurrentPass >= 0)
+        EndPass();
+    
+    auto now = std::chrono::steady_clock::now();
+    auto stats = Renderer::GetStats();
+    
+    FrameRecord& record = g_Records[g_FrameCount % Capacity];
+    record.Index = g_FrameCount;
+    record.FrameTime = ElapsedMilliseconds(g_PreviousFrameStart, g_FrameStart);
+    record.CPUTime = ElapsedMilliseconds(g_FrameStart, now);
+    record.GPUTime = -1.0f;
+    record.DrawCalls = stats.drawCalls;
+    record.Triangles = stats.triangles;
+    record.PassTimes.fill(-1.0f);
+    record.ShadowCasters = g_ShadowCasters;
+    
+    QuerySet& set = g_Queries[g_FrameCount % g_QueryLatency];
+    glQueryCounter(set.IDs[1], GL_TIMESTAMP);
+    set.Pending = true;
+    
+    g_FrameCount++;
+    g_InFrame = false;
+}
+
+/**
+ * Start timing a render pass on the GPU.
+ *
+ * @param name The name of the pass (interned string, e.g., from `Profiler::Intern`).
+ */
+void FrameStatistics::BeginPass(const char* name)
+{
+    if (!g_InFrame)
+        return;
+    
+    if (g_CurrentPass >= 0)
+        EndPass();
+    
+    // Find (or register) the slot of the pass
+    auto it = std::find(g_PassNames.begin(), g_PassNames.end(), name);
+    if (it == g_PassNames.end())
+    {
+        if (g_PassNames.size() == g_MaxTimedPasses)
+            return;
+        g_PassNames.push_back(name);
+        it = g_PassNames.end() - 1;
+    }
+    
+    QuerySet& set = g_Queries[g_FrameCount % g_QueryLatency];
+    if (set.Passes.size() == g_MaxTimedPasses)
+        return;
+    
+    g_CurrentPass = (int)(it - g_PassNames.begin());
+    glQueryCounter(set.IDs[2 + 2 * set.Passes.size()], GL_TIMESTAMP);
+    set.Passes.push_back(g_CurrentPass);
+}
+
+/**
+ * Stop timing the current render pass.
+ */
+void FrameStatistics::EndPass()
+{
+    if (g_CurrentPass < 0)
+        return;
+    
+    QuerySet& set = g_Queries[g_FrameCount % g_QueryLatency];
+    glQueryCounter(set.IDs[2 + 2 * (set.Passes.size() - 1) + 1], GL_TIMESTAMP);
+    g_CurrentPass = -1;
+}
+
+/**
+ * Record the number of shadow casters kept for a light in the current frame.
+ *
+ * @param light The name of the light (interned string, e.g., from `Profiler::Intern`).
+ * @param count The number of shadow casters.
+ */
+void FrameStatistics::SetShadowCasters(const char* light, unsigned int count)
+{
+    if (!g_InFrame)
+        return;
+    
+    // Find (or register) the slot of the light
+    auto it = std::find(g_LightNames.begin(), g_LightNames.end(), light);
+    if (it == g_LightNames.end())
+    {
+        if (g_LightNames.size() == g_MaxCountedLights)
+            return;
+        g_LightNames.push_back(light);
+        it = g_LightNames.end() - 1;
+    }
+    g_ShadowCasters[it - g_LightNames.begin()] = (int)count;
+}
+
+/**
+ * Release the GPU queries and export the history if an export path has been defined.
+ */
+void FrameStatistics::Shutdown()
+{
+    if (!g_ExportPath.empty() && g_FrameCount > 0)
+    {
+        if (g_ExportPath.extension() == ".json")
+            ExportJSON(g_ExportPath);
+        else
+            ExportCSV(g_ExportPath);
+    }
+    
+    if (g_QueriesCreated)
+    {
+        for (auto& set : g_Queries)
+        {
+            glDeleteQueries(g_QueriesPerFrame, set.IDs.data());
+            set.Pending = false;
+        }
+        g_QueriesCreated = false;
+    }
+}
+
+/**
+ * Read the GPU times of the oldest frame that issued queries.
+ */
+void FrameStatistics::ReadQueries()
+{
+    QuerySet& set = g_Queries[g_FrameCount % g_QueryLatency];
+    if (!set.Pending)
+        return;
+    set.Pending = false;
+    
+    // The record may have been overwritten already or the results may not be ready (they
+    // are then discarded instead of stalling the frame)
+    if (g_FrameCount - set.Frame >= Capacity)
+        return;
+    
+    GLint available = 0;
+    glGetQueryObjectiv(set.IDs[1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+        return;
+    
+    auto timestamp = [&set](unsigned int query)
+    {
+        GLuint64 value = 0;
+        glGetQueryObjectui64v(set.IDs[query], GL_QUERY_RESULT, &value);
+        return value;
+    };
+    
+    FrameRecord& record = g_Records[set.Frame % Capacity];
+    record.GPUTime = (float)(timestamp(1) - timestamp(0)) * 1e-6f;
+    for (unsigned int i = 0; i < set.Passes.size(); i++)
+        record.PassTimes[set.Passes[i]] = (float)(timestamp(2 + 2 * i + 1) - timestamp(2 + 2 * i)) * 1e-6f;
+}
+
+/**
+ * Get the number of frames in the history.
+ *
+ * @return The number of recorded frames.
+ */
+unsigned int FrameStatistics::GetSize()
+{
+    return (unsigned int)std::min<uint64_t>(g_FrameCount, Capacity);
+}
+
+/**
+ * Get the index of the current frame (the number of frames recorded before it).
+ *
+ * @return The frame index.
+ */
+uint64_t FrameStatistics::GetFrameIndex()
+{
+    return g_FrameCount;
+}
+
+/**
+ * Get a frame of the history.
+ *
+ * @param index The index of the frame in the history (0 is the oldest frame).
+ *
+ * @return The frame measurements.
+ */
+const FrameRecord& FrameStatistics::GetRecord(unsigned int index)
+{
+    CORE_ASSERT(index < GetSize(), "Trying to access a frame out of the history!");
+    uint64_t first = g_FrameCount - GetSize();
+    return g_Records[(first + index) % Capacity];
+}
+
+/**
+ * Get the summary of the frame times of the whole history.
+ *
+ * @return The frame time distribution.
+ */
+FrameTimeSummary FrameStatistics::GetSummary()
+{
+    return GetSummary(GetSize());
+}
+
+/**
+ * Get the summary of the frame times of the last frames.
+ *
+ * @param frames The number of (most recent) frames considered.
+ *
+ * @return The frame time distribution.
+ */
+FrameTimeSummary FrameStatistics::GetSummary(unsigned int frames)
+{
+    FrameTimeSummary summary;
+    
+    // The first frame measures the start-up time instead of a frame
+    unsigned int size = GetSize();
+    unsigned int first = g_FrameCount > Capacity ? 0 : 1;
+    frames = std::min(frames, size - std::min(size, first));
+    if (frames == 0)
+        return summary;
+    
+    std::vector<float> times(frames);
+    for (unsigned int i = 0; i < frames; i++)
+        times[i] = GetRecord(size - frames + i).FrameTime;
+    
+    summary.Frames = frames;
+    summary.Max = *std::max_element(times.begin(), times.end());
+    for (float time : times)
+        summary.Average += time;
+    summary.Average /= (float)frames;
+    
+    summary.P50 = Percentile(times, 0.50f);
+    summary.P95 = Percentile(times, 0.95f);
+    summary.P99 = Percentile(times, 0.99f);
+    
+    float threshold = summary.P50 * g_HitchFactor;
+    summary.Hitches = (unsigned int)std::count_if(times.begin(), times.end(),
+                                                  [threshold](float time) { return time > threshold; });
+    return summary;
+}
+
+/**
+ * Get the names of the timed render passes.
+ *
+ * @return The pass names (indexed as `FrameRecord::PassTimes`).
+ */
+const std::vector<const char*>& FrameStatistics::GetPassNames()
+{
+    return g_PassNames;
+}
+
+/**
+ * Get the names of the lights with counted shadow casters.
+ *
+ * @return The light names (indexed as `FrameRecord::ShadowCasters`).
+ */
+const std::vector<const char*>& FrameStatistics::GetLightNames()
+{
+    return g_LightNames;
+}
+
+/**
+ * Get the factor defining the hitches.
+ *
+ * @return The hitch factor (relative to the median frame time).
+ */
+float FrameStatistics::GetHitchFactor()
+{
+    return g_HitchFactor;
+}
+
+/**
+ * Define the factor defining the hitches.
+ *
+ * @param factor The hitch factor (relative to the median frame time).
+ */
+void FrameStatistics::SetHitchFactor(float factor)
+{
+    g_HitchFactor = std::max(1.0f, factor);
+}
+
+/**
+ * Define a file where the history is exported when the application ends.
+ *
+ * @param filePath The path of the file (JSON if its extension is `.json`, CSV otherwise).
+ */
+void FrameStatistics::SetExportPath(const std::filesystem::path& filePath)
+{
+    g_ExportPath = filePath;
+}
+
+/**
+ * Write the history as a CSV file (one row per frame).
+ *
+ * @param filePath The path of the file.
+ *
+ * @return `true` if the file has been written.
+ */
+bool FrameStatistics::ExportCSV(const std::filesystem::path& filePath)
+{
+    std::ofstream file;
+    if (!OpenExportFile(filePath, file))
+        return false;
+    
+    file << "frame,frame_ms,cpu_ms,gpu_ms,draw_calls,triangles";
+    for (const char* name : g_PassNames)
+        file << ",\"" << name << " (ms)\"";
+    for (const char* name : g_LightNames)
+        file << ",\"" << name << " (casters)\"";
+    file << "\n";
+    
+    for (unsigned int i = 0; i < GetSize(); i++)
+    {
+        const FrameRecord& record = GetRecord(i);
+        file << record.Index << "," << record.FrameTime << "," << record.CPUTime << ","
+             << record.GPUTime << "," << record.DrawCalls << "," << record.Triangles;
+        for (unsigned int p = 0; p < g_PassNames.size(); p++)
+            file << "," << record.PassTimes[p];
+        for (unsigned int l = 0; l < g_LightNames.size(); l++)
+            file << "," << record.ShadowCasters[l];
+        file << "\n";
+    }
+    
+    CORE_INFO("Frame statistics ({0} frames) written into {1}", GetSize(), filePath.string());
+    return true;
+}
+
+/**
+ * Write the history and its summary as a JSON file.
+ *
+ * @param filePath The path of the file.
+ *
+ * @return `true` if the file has been written.
+ */
+bool FrameStatistics::ExportJSON(const std::filesystem::path& filePath)
+{
+    std::ofstream file;
+    if (!OpenExportFile(filePath, file))
+        return false;
+    
+    FrameTimeSummary summary = GetSummary();
+    file << "{\n  \"summary\": {\"frames\": " << summary.Frames << ", \"average_ms\": " << summary.Average
+         << ", \"p50_ms\": " << summary.P50 << ", \"p95_ms\": " << summary.P95 << ", \"p99_ms\": "
+         << summary.P99 << ", \"max_ms\": " << summary.Max << ", \"hitches\": " << summary.Hitches
+         << ", \"hitch_factor\": " << g_HitchFactor << "},\n";
+    
+    file << "  \"passes\": [";
+    for (unsigned int p = 0; p < g_PassNames.size(); p++)
+        file << (p ? ", " : "") << "\"" << g_PassNames[p] << "\"";
+    file << "],\n";
+    
+    file << "  \"lights\": [";
+    for (unsigned int l = 0; l < g_LightNames.size(); l++)
+        file << (l ? ", " : "") << "\"" << g_LightNames[l] << "\"";
+    file << "],\n";
+    
+    file << "  \"frames\": [\n";
+    for (unsigned int i = 0; i < GetSize(); i++)
+    {
+        const FrameRecord& record = GetRecord(i);
+        file << "    {\"frame\": " << record.Index << ", \"frame_ms\": " << record.FrameTime
+             << ", \"cpu_ms\": " << record.CPUTime << ", \"gpu_ms\": " << record.GPUTime
+             << ", \"draw_calls\": " << record.DrawCalls << ", \"triangles\": " << record.Triangles
+             << ", \"passes_ms\": [";
+        for (unsigned int p = 0; p < g_PassNames.size(); p++)
+            file << (p ? ", " : "") << record.PassTimes[p];
+        file << "], \"shadow_casters\": [";
+        for (unsigned int l = 0; l < g_LightNames.size(); l++)
+            file << (l ? ", " : "") << record.ShadowCasters[l];
+        file << "]}" << (i + 1 < GetSize() ? "," : "") << "\n";
+    }
+    file << "  ]\n}\n";
+    
+    CORE_INFO("Frame statistics ({0} frames) written into {1}", GetSize(), filePath.string());
+    return true;
+}
@@ -0,0 +1,372 @@
+#include "enginepch.h"
+#include "Common/Renderer/Light/EnvironmentCache.h"
+
+#include "Common/Renderer/Light/SHProjection.h"
+
+#include <fstream>
+
+namespace
+{
+/// Identifier at the beginning of the cache files.
+constexpr char g_Magic[8] = { 'P', 'X', 'E', 'N', 'V', 'C', 'H', '\0' };
+/// Version of the layout of the cache files (modified each time the layout changes).
+constexpr uint32_t g_Version = 1;
+/// Number of spherical harmonics coefficients stored in the cache files (one set per color channel).
+constexpr uint32_t g_CoefficientCount = 3 * SHProjection::CoefficientCount;
+
+/// Size of the blocks read when hashing a source file.
+constexpr size_t g_HashBlockSize = 1 << 20;
+
+/// Directory of the cache files.
+std::filesystem::path g_Directory = ".cache/environment";
+/// Read and write the cache files.
+bool g_Enabled = true;
+
+/**
+ * Represents the content hash of a source file, and the file state when it was computed.
+ */
+struct SourceHash
+{
+    uintmax_t Size = 0;                             ///< Size of the file.
+    std::filesystem::file_time_type Time;           ///< Last modification time of the file.
+    uint64_t Hash = 0;                              ///< Hash of the file content.
+};
+/// Content hash of the source files already hashed.
+std::unordered_map<std::string, SourceHash> g_SourceHashes;
+
+/**
+ * Mix the bits of a value (finalizer of SplitMix64).
+ *
+ * @param value The value.
+ *
+ * @return The mixed value.
+ */
+inline uint64_t Mix(uint64_t value)
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ull;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebull;
+    value ^= value >> 31;
+    return value;
+}
+
+/**
+ * Add a block of data to a hash (eight bytes at a time).
+ *
+ * @param hash The current hash.
+ * @param data The data.
+ * @param size The number of bytes of the data.
+ *
+ * @return The updated hash.
+ */
+uint64_t Hash(uint64_t hash, const char* data, size_t size)
+{
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, data + i, 8);
+        hash = Mix(hash ^ word) + 0x9e3779b97f4a7c15ull;
+    }
+    
+    // The last bytes (and the size) are added in a single word
+    uint64_t tail = (uint64_t)size << 56;
+    for (size_t shift = 0; i < size; i++, shift += 8)
+        tail ^= (uint64_t)(unsigned char)data[i] << shift;
+    return Mix(hash ^ tail);
+}
+
+/**
+ * Compute the content hash of a source file (or reuse it if the file has not been modified).
+ *
+ * @param filePath The path to the file.
+ * @param hash The content hash.
+ *
+ * @return `true` if the file could be read.
+ */
+bool HashFile(const std::filesystem::path& filePath, uint64_t& hash)
+{
+    std::error_code error;
+    uintmax_t size = std::filesystem::file_size(filePath, error);
+    if (error)
+        return false;
+    std::filesystem::file_time_type time = std::filesystem::last_write_time(filePath, error);
+    if (error)
+        return false;
+    
+    std::string key = std::filesystem::absolute(filePath, error).string();
+    auto it = g_SourceHashes.find(key);
+    if (it != g_SourceHashes.end() && it->second.Size == size && it->second.Time == time)
+    {
+        hash = it->second.Hash;
+        return true;
+    }
+    
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file)
+        return false;
+    
+    hash = 0;
+    std::vector<char> block(g_HashBlockSize);
+    while (file)
+    {
+        file.read(block.data(), block.size());
+        if (file.gcount() > 0)
+            hash = Hash(hash, block.data(), (size_t)file.gcount());
+    }
+    
+    g_SourceHashes[key] = { size, time, hash };
+    return true;
+}
+
+/**
+ * Write a value into a binary file.
+ *
+ * @param file The output file.
+ * @param value The value.
+ */
+template<typename T>
+void Write(std::ofstream& file, const T& value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/**
+ * Read a value from a binary file.
+ *
+ * @param file The input file.
+ * @param value The value.
+ *
+ * @return `true` if the value could be read.
+ */
+template<typename T>
+bool Read(std::ifstream& file, T& value)
+{
+    file.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return (bool)file;
+}
+} // namespace
+
+/**
+ * Get the cache file of an environment map.
+ *
+ * @param source The path to the source image.
+ * @param parameters The processing parameters (any modification produces another file).
+ *
+ * @return The path to the cache file, or an empty path if the cache is disabled or the source
+ * cannot be read.
+ */
+std::filesystem::path EnvironmentCache::GetFilePath(const std::filesystem::path& source,
+                                                    const std::string& parameters)
+{
+    uint64_t hash;
+    if (!g_Enabled || !HashFile(source, hash))
+        return {};
+    
+    hash = Hash(hash, parameters.data(), parameters.size());
+    hash = Hash(hash, reinterpret_cast<const char*>(&g_Version), sizeof(g_Version));
+    
+    char name[17];
+    std::snprintf(name, sizeof(name), "%016llx", (unsigned long long)hash);
+    return g_Directory / (std::string(name) + ".envc");
+}
+
+/**
+ * Load the precomputed lighting of an environment map.
+ *
+ * @param filePath The path to the cache file.
+ * @param coefficients The spherical harmonics coefficients.
+ * @param maps The cube maps to be loaded (in the order they were saved).
+ *
+ * @return `true` if the file exists and matches the cube maps.
+ *
+ * @note The whole file is read and validated before the textures are modified, so the maps are left
+ * untouched if the file cannot be loaded.
+ */
+bool EnvironmentCache::Load(const std::filesystem::path& filePath, std::vector<float>& coefficients,
+                            const std::vector<std::shared_ptr<TextureCube>>& maps)
+{
+    PROFILE_FUNCTION();
+    
+    if (filePath.empty())
+        return false;
+    
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file)
+        return false;
+    
+    // Verify the header
+    char magic[8];
+    uint32_t version = 0, mapCount = 0, coefficientCount = 0;
+    file.read(magic, sizeof(magic));
+    if (!file || std::memcmp(magic, g_Magic, sizeof(magic)) != 0 || !Read(file, version) ||
+        version != g_Version || !Read(file, mapCount) || mapCount != maps.size() ||
+        !Read(file, coefficientCount) || coefficientCount != g_CoefficientCount)
+    {
+        CORE_WARN("Invalid environment cache file: " + filePath.filename().string());
+        return false;
+    }
+    
+    std::vector<float> values(coefficientCount);
+    file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(float));
+    if (!file)
+    {
+        CORE_WARN("Incomplete environment cache file: " + filePath.filename().string());
+        return false;
+    }
+    
+    // Read the maps, verifying that they have the same layout as the textures
+    std::vector<std::vector<std::vector<char>>> data(maps.size());
+    for (unsigned int m = 0; m < maps.size(); m++)
+    {
+        auto& map = maps[m];
+        uint32_t format = 0, size = 0, levels = 0;
+        if (!Read(file, format) || !Read(file, size) || !Read(file, levels) ||
+            format != (uint32_t)map->GetSpecification().Format || size != map->GetLevelSize(0) ||
+            levels != map->GetLevelCount())
+        {
+            CORE_WARN("Outdated environment cache file: " + filePath.filename().string());
+            return false;
+        }
+        
+        // The faces of each level are stored consecutively
+        data[m].resize(levels);
+        for (unsigned int level = 0; level < levels; level++)
+        {
+            data[m][level].resize(6 * map->GetFaceDataSize(level));
+            file.read(data[m][level].data(), data[m][level].size());
+            if (!file)
+            {
+                CORE_WARN("Incomplete environment cache file: " + filePath.filename().string());
+                return false;
+            }
+        }
+    }
+    
+    // Upload the maps once the whole file is valid
+    for (unsigned int m = 0; m < maps.size(); m++)
+    {
+        for (unsigned int level = 0; level < data[m].size(); level++)
+        {
+            size_t faceSize = maps[m]->GetFaceDataSize(level);
+            for (unsigned int face = 0; face < 6; face++)
+                maps[m]->SetFaceData(face, level, data[m][level].data() + face * faceSize);
+        }
+    }
+    
+    coefficients = std::move(values);
+    return true;
+}
+
+/**
+ * Save the precomputed lighting of an environment map.
+ *
+ * @param filePath The path to the cache file.
+ * @param coefficients The spherical harmonics coefficients.
+ * @param maps The cube maps to be saved (with all their mipmap levels).
+ *
+ * @return `true` if the file has been written.
+ */
+bool EnvironmentCache::Save(const std::filesystem::path& filePath, const std::vector<float>& coefficients,
+                            const std::vector<std::shared_ptr<TextureCube>>& maps)
+{
+    PROFILE_FUNCTION();
+    
+    if (filePath.empty() || coefficients.size() != g_CoefficientCount)
+        return false;
+    
+    std::error_code error;
+    std::filesystem::create_directories(filePath.parent_path(), error);
+    
+    // Write into a temporary file first, so an interrupted write never leaves an incomplete file
+    std::filesystem::path temporary = filePath;
+    temporary += ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary);
+        if (!file)
+        {
+            CORE_WARN("Failed to write the environment cache: " + filePath.string());
+            return false;
+        }
+        
+        file.write(g_Magic, sizeof(g_Magic));
+        Write(file, g_Version);
+        Write(file, (uint32_t)maps.size());
+        Write(file, (uint32_t)coefficients.size());
+        file.write(reinterpret_cast<const char*>(coefficients.data()), coefficients.size() * sizeof(float));
+        
+        for (auto& map : maps)
+        {
+            Write(file, (uint32_t)map->GetSpecification().Format);
+            Write(file, (uint32_t)map->GetLevelSize(0));
+            Write(file, (uint32_t)map->GetLevelCount());
+            
+            for (unsigned int level = 0; level < map->GetLevelCount(); level++)
+            {
+                for (unsigned int face = 0; face < 6; face++)
+                {
+                    std::vector<char> data = map->GetFaceData(face, level);
+                    file.write(data.data(), data.size());
+                }
+            }
+        }
+        
+        if (!file)
+        {
+            file.close();
+            std::filesystem::remove(temporary, error);
+            CORE_WARN("Failed to write the environment cache: " + filePath.string());
+            return false;
+        }
+    }
+    
+    std::filesystem::rename(temporary, filePath, error);
+    if (error)
+    {
+        std::filesystem::remove(temporary, error);
+        CORE_WARN("Failed to write the environment cache: " + filePath.string());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Get the directory of the cache files.
+ *
+ * @return The directory.
+ */
+const std::filesystem::path& EnvironmentCache::GetDirectory()
+{
+    return g_Directory;
+}
+
+/**
+ * Check if the cache files are used.
+ *
+ * @return `true` if the cache is enabled.
+ */
+bool EnvironmentCache::IsEnabled()
+{
+    return g_Enabled;
+}
+
+/**
+ * Define the directory of the cache files.
+ *
+ * @param directory The directory (created when the first file is saved).
+ */
+void EnvironmentCache::SetDirectory(const std::filesystem::path& directory)
+{
+    g_Directory = directory;
+}
+
+/**
+ * Enable or disable the cache files.
+ *
+ * @param enabled `true` to read and write the cache files.
+ */
+void EnvironmentCache::SetEnabled(bool enabled)
+{
+    g_Enabled = enabled;
+}
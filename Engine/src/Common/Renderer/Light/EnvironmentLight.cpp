@@ -2,9 +2,12 @@
 #include "Common/Renderer/Light/EnvironmentLight.h"
 
 #include "Common/Renderer/Texture/Texture.h"
+#include "Common/Renderer/Texture/Texture2D.h"
 #include "Common/Renderer/Texture/TextureCube.h"
 
 #include "Common/Renderer/Light/PositionalLight.h"
+#include "Common/Renderer/Light/SHProjection.h"
+#include "Common/Renderer/Light/EnvironmentCache.h"
 
 /**
  * Generate an environment light source in the world space.
@@ -45,9 +48,10 @@ void EnvironmentLight::InitEnvironmentFramebuffers(const unsigned int cubeSize)
     
     // -------
     
+    // All the faces are attached at once (layered), so the depth is a cube map too
     spec.SetFrameBufferSize(cubeSize, cubeSize);
     spec.AttachmentsSpec = {
-        TextureFormat::DEPTH24,
+        { TextureFormat::DEPTH24, TextureType::TEXTURECUBE },
         { TextureFormat::RGB16F, TextureType::TEXTURECUBE }
     };
     
@@ -71,7 +75,7 @@ void EnvironmentLight::InitEnvironmentMaterials()
     auto environment = m_Framebuffers.Get("Environment")->GetColorAttachment(0);
     
     // Equirectangular mapping
-    m_Materials.Create<SimpleTextureMaterial>("Equirectangular",
+    m_Materials.Create<CubeMapMaterial>("Equirectangular",
         "Resources/shaders/environment/EquirectangularMap.glsl");
     
     // Spherical harmonics
@@ -80,12 +84,12 @@ void EnvironmentLight::InitEnvironmentMaterials()
     sphericalHarmonics->SetTextureMap(environment);
     
     // Irradiance mapping
-    auto irradiance = m_Materials.Create<SimpleTextureMaterial>("Irradiance",
+    auto irradiance = m_Materials.Create<CubeMapMaterial>("Irradiance",
         "Resources/shaders/environment/IrradianceMap.glsl");
     irradiance->SetTextureMap(environment);
     
     // Pre-filtering mapping
-    auto preFilter = m_Materials.Create<SimpleTextureMaterial>("PreFilter",
+    auto preFilter = m_Materials.Create<CubeMapMaterial>("PreFilter",
         "Resources/shaders/environment/PreFilterMap.glsl");
     preFilter->SetTextureMap(environment);
     
@@ -97,6 +101,9 @@ void EnvironmentLight::InitEnvironmentMaterials()
 
 /**
  * Change the environment map.
+ *
+ * The precomputed maps and coefficients of the images loaded from a file are kept in the
+ * `EnvironmentCache`, so an image is only processed the first time it is used.
  * 
  * @param texture The texture to be used as the environment map.
  */
@@ -104,14 +111,54 @@ void EnvironmentLight::SetEnvironmentMap(const std::shared_ptr<Texture>& texture
 {
     // Save the information of the environment map
     m_EnvironmentMap = texture;
+    FrameScheduler::RequestRedraw();
     
     // Check for a valid texture
     if (!texture)
         return;
     
+    std::vector<std::shared_ptr<TextureCube>> maps;
+    for (const char* name : { "Environment", "Irradiance", "PreFilter" })
+        maps.push_back(std::dynamic_pointer_cast<TextureCube>(m_Framebuffers.Get(name)->GetColorAttachment(0)));
+    
+    // Get the cache file of the environment map (the file depends on its orientation, processing and
+    // the layout of the cube maps)
+    std::filesystem::path cacheFile;
+    auto resource = std::dynamic_pointer_cast<Texture2DResource>(texture);
+    if (resource)
+    {
+        std::string parameters = "rotation:" + std::to_string(m_Rotation.x) + "," +
+            std::to_string(m_Rotation.y) + "," + std::to_string(m_Rotation.z) +
+            ";flip:" + std::to_string(resource->IsFlipped()) +
+            ";sh:" + (resource->GetPath().extension() == ".hdr" ? "cpu" : "gpu");
+        for (auto& map : maps)
+        {
+            parameters += ";map:" + std::to_string(map->GetLevelSize(0)) + "," +
+                std::to_string((int)map->GetSpecification().Format) + "," +
+                std::to_string(map->GetLevelCount());
+        }
+        cacheFile = EnvironmentCache::GetFilePath(resource->GetPath(), parameters);
+    }
+    
+    // Load the environment information from the cache
+    std::vector<float> coefficients;
+    if (EnvironmentCache::Load(cacheFile, coefficients, maps))
+    {
+        m_Coefficients.UpdateIsotropicMatrix(coefficients);
+        m_Coefficients.UpdateAnisotropicMatrix(coefficients);
+        
+        m_Model->SetMaterial(m_Materials.Get("Environment"));
+        m_Model->SetScale(glm::vec3(70.0f));
+        return;
+    }
+    
     // Update the environment information
     UpdateEnvironment();
-    UpdateSphericalHarmonics();
+    coefficients = UpdateSphericalHarmonics();
+    
+    // Save the environment information into the cache
+    if (coefficients.size() == 3 * SHProjection::CoefficientCount)
+        EnvironmentCache::Save(cacheFile, coefficients, maps);
 }
 
 /**
@@ -157,13 +204,31 @@ void EnvironmentLight::DefineLightProperties(const std::shared_ptr<Shader> &shad
 
 /**
  * Updates the spherical harmonic coefficients for the environment light.
+ *
+ * The HDR images loaded from a file are projected on the CPU (at full precision, using all their
+ * texels). The other environment maps are sampled on the GPU from the rendered cube map.
+ *
+ * @return The 9 coefficients, stored with interleaved RGB values (e.g., R00, G00, B00, R1-1, ...).
  */
-void EnvironmentLight::UpdateSphericalHarmonics()
+std::vector<float> EnvironmentLight::UpdateSphericalHarmonics()
 {
+    // Project the equirectangular image directly (with the same orientation as the cube map)
+    auto resource = std::dynamic_pointer_cast<Texture2DResource>(m_EnvironmentMap);
+    if (resource && resource->GetPath().extension() == ".hdr")
+    {
+        glm::mat3 rotation = glm::mat3(glm::toMat4(glm::quat(glm::radians(m_Rotation))));
+        std::vector<float> coefficients = SHProjection::ProjectEquirectangular(resource->GetPath(),
+                                                                               resource->IsFlipped(),
+                                                                               rotation);
+        m_Coefficients.UpdateIsotropicMatrix(coefficients);
+        m_Coefficients.UpdateAnisotropicMatrix(coefficients);
+        return coefficients;
+    }
+    
     // Retrieve the spherical harmonics material
     auto material = std::dynamic_pointer_cast<SimpleTextureMaterial>(m_Materials.Get("SphericalHarmonics"));
     if (!material)
-        return;
+        return {};
     
     // Create a plane geometry (to render to) using the material
     using VertexData = GeoVertexData<glm::vec4>;
@@ -173,7 +238,7 @@ void EnvironmentLight::UpdateSphericalHarmonics()
     // Get the spherical harmonics framebuffer
     auto& framebuffer = m_Framebuffers.Get("SphericalHarmonics");
     if (!framebuffer)
-        return;
+        return {};
     
     // Bind the framebuffer and render the scene to compute the coefficients
     framebuffer->Bind();
@@ -187,8 +252,10 @@ void EnvironmentLight::UpdateSphericalHarmonics()
     framebuffer->Unbind();
     
     // Retrieve the information of the coefficients
-    m_Coefficients.UpdateIsotropicMatrix(framebuffer->GetAttachmentData<float>(0));
-    m_Coefficients.UpdateAnisotropicMatrix(framebuffer->GetAttachmentData<float>(0));
+    std::vector<float> coefficients = framebuffer->GetAttachmentData<float>(0);
+    m_Coefficients.UpdateIsotropicMatrix(coefficients);
+    m_Coefficients.UpdateAnisotropicMatrix(coefficients);
+    return coefficients;
 }
 
 /**
@@ -276,9 +343,12 @@ void EnvironmentLight::UpdateEnvironment()
 /**
  * Render a cube map from multiple perspectives using the specified material and framebuffer.
  *
+ * All the faces are rendered in a single draw: the framebuffer attaches every face of the cube map
+ * (layered), and the material replicates each primitive into all of them.
+ *
  * @param views An array of view matrices representing the six cube map faces.
  * @param projection The projection matrix for the rendering.
- * @param material The material to be used for rendering each cube map face.
+ * @param material The material to be used for rendering the cube map faces (a `CubeMapMaterial`).
  * @param framebuffer The framebuffer where the cube map is rendered.
  * @param level The mip level of the framebuffer to which the cube map is rendered.
  * @param genMipMaps A flag indicating whether to generate mipmaps for the resulting cube map.
@@ -289,31 +359,40 @@ void EnvironmentLight::RenderCubeMap(const std::array<glm::mat4, 6>& views, cons
                                      const unsigned int& viewportWidth, const unsigned int& viewportHeight,
                                      const unsigned int &level, const bool &genMipMaps)
 {
-    // Set the material for rendering
-    m_Model->SetMaterial(material);
-
-    // Loop through each face of the cube map
-    for (unsigned int i = 0; i < views.size(); ++i)
+    auto cubeMaterial = std::dynamic_pointer_cast<CubeMapMaterial>(material);
+    if (!cubeMaterial)
     {
-        // Begin rendering scene with the specified view and projection matrices
-        Renderer::BeginScene(views[i], projection);
-
-        // Bind the framebuffer for drawing to the current cube map face and mip level
-        framebuffer->BindForDrawAttachmentCube(0, i, level);
-
-        // Set the viewport dimensions if provided
-        if (viewportWidth > 0 && viewportHeight > 0)
-            Renderer::SetViewport(0, 0, viewportWidth, viewportHeight);
-
-        // Clear the active buffers in the framebuffer
-        Renderer::Clear(framebuffer->GetActiveBuffers());
-
-        // Draw the model using the specified material
-        m_Model->DrawModel();
-
-        // End the rendering scene
-        Renderer::EndScene();
+        CORE_WARN("Cube maps can only be rendered with a cube map material!");
+        return;
     }
+    
+    // Define the view and projection matrices of each face
+    std::array<glm::mat4, 6> transforms;
+    for (unsigned int i = 0; i < views.size(); ++i)
+        transforms[i] = projection * views[i];
+    cubeMaterial->SetTransforms(transforms);
+    
+    // Set the material for rendering
+    m_Model->SetMaterial(material);
+    
+    // Begin rendering the scene (the faces are projected by the material)
+    Renderer::BeginScene();
+    
+    // Bind the framebuffer for drawing to all the cube map faces of the mip level
+    framebuffer->BindForDrawAttachmentLayers(0, level);
+    
+    // Set the viewport dimensions if provided
+    if (viewportWidth > 0 && viewportHeight > 0)
+        Renderer::SetViewport(0, 0, viewportWidth, viewportHeight);
+    
+    // Clear the active buffers in the framebuffer (all the faces are cleared at once)
+    Renderer::Clear(framebuffer->GetActiveBuffers());
+    
+    // Draw the model into every face
+    m_Model->DrawModel();
+    
+    // End the rendering scene
+    Renderer::EndScene();
 
     // Unbind the framebuffer and optionally generate mipmaps
     framebuffer->Unbind(genMipMaps);
@@ -0,0 +1,257 @@
+#include "enginepch.h"
+#include "Common/Renderer/Light/SHProjection.h"
+
+#include "Common/Core/JobSystem.h"
+
+#include <stb_image.h>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define SH_PROJECTION_AVX
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define SH_PROJECTION_SSE
+#endif
+
+namespace
+{
+/// Number of rows of the image projected by each job.
+constexpr unsigned int g_RowsPerJob = 16;
+
+/// Mathematical constants.
+constexpr float g_Pi = 3.14159265359f;
+
+// Operations on several texels at once
+#if defined(SH_PROJECTION_AVX)
+/// Number of texels processed at once.
+constexpr unsigned int g_Lanes = 8;
+using Lanes = __m256;
+inline Lanes Load(const float* p) { return _mm256_loadu_ps(p); }
+inline void Store(float* p, Lanes a) { _mm256_storeu_ps(p, a); }
+inline Lanes Broadcast(float value) { return _mm256_set1_ps(value); }
+inline Lanes Add(Lanes a, Lanes b) { return _mm256_add_ps(a, b); }
+inline Lanes Sub(Lanes a, Lanes b) { return _mm256_sub_ps(a, b); }
+inline Lanes Mul(Lanes a, Lanes b) { return _mm256_mul_ps(a, b); }
+#elif defined(SH_PROJECTION_SSE)
+/// Number of texels processed at once.
+constexpr unsigned int g_Lanes = 4;
+using Lanes = __m128;
+inline Lanes Load(const float* p) { return _mm_loadu_ps(p); }
+inline void Store(float* p, Lanes a) { _mm_storeu_ps(p, a); }
+inline Lanes Broadcast(float value) { return _mm_set1_ps(value); }
+inline Lanes Add(Lanes a, Lanes b) { return _mm_add_ps(a, b); }
+inline Lanes Sub(Lanes a, Lanes b) { return _mm_sub_ps(a, b); }
+inline Lanes Mul(Lanes a, Lanes b) { return _mm_mul_ps(a, b); }
+#else
+/// Number of texels processed at once.
+constexpr unsigned int g_Lanes = 1;
+using Lanes = float;
+inline Lanes Load(const float* p) { return *p; }
+inline void Store(float* p, Lanes a) { *p = a; }
+inline Lanes Broadcast(float value) { return value; }
+inline Lanes Add(Lanes a, Lanes b) { return a + b; }
+inline Lanes Sub(Lanes a, Lanes b) { return a - b; }
+inline Lanes Mul(Lanes a, Lanes b) { return a * b; }
+#endif
+
+/**
+ * Add the values of all the lanes.
+ *
+ * @param a The values.
+ *
+ * @return The sum of the lanes.
+ */
+inline float Sum(Lanes a)
+{
+    float values[g_Lanes];
+    Store(values, a);
+    
+    float sum = 0.0f;
+    for (unsigned int i = 0; i < g_Lanes; i++)
+        sum += values[i];
+    return sum;
+}
+
+/**
+ * Project a row of an equirectangular image onto the spherical harmonics basis.
+ *
+ * @param radiance The red, green and blue values of the texels (three consecutive planes of
+ * `count` values, padded with zeros to a multiple of the lanes).
+ * @param cosPhi The cosine of the longitude of each column.
+ * @param sinPhi The sine of the longitude of each column.
+ * @param count The number of values of each plane (a multiple of the lanes).
+ * @param latitude The latitude of the row.
+ * @param rotation The rotation from the directions of the image to world space.
+ * @param weight The solid angle of each texel of the row.
+ * @param sums The coefficients (interleaved RGB), where the projection of the row is added.
+ */
+void ProjectRow(const float* radiance, const float* cosPhi, const float* sinPhi, unsigned int count,
+                float latitude, const glm::mat3& rotation, float weight, double* sums)
+{
+    // The direction of a texel is (cos(lat) cos(phi), sin(lat), cos(lat) sin(phi)), so its rotation
+    // only combines the sine and cosine of the longitude with constants of the row
+    const float cosLat = std::cos(latitude), sinLat = std::sin(latitude);
+    Lanes a[3], b[3], c[3];
+    for (int axis = 0; axis < 3; axis++)
+    {
+        a[axis] = Broadcast(rotation[0][axis] * cosLat);
+        b[axis] = Broadcast(rotation[2][axis] * cosLat);
+        c[axis] = Broadcast(rotation[1][axis] * sinLat);
+    }
+    
+    Lanes accumulated[9][3];
+    for (int k = 0; k < 9; k++)
+        for (int channel = 0; channel < 3; channel++)
+            accumulated[k][channel] = Broadcast(0.0f);
+    
+    const Lanes w = Broadcast(weight);
+    for (unsigned int i = 0; i < count; i += g_Lanes)
+    {
+        // Direction of the texels in world space
+        Lanes cp = Load(cosPhi + i), sp = Load(sinPhi + i);
+        Lanes x = Add(Add(Mul(a[0], cp), Mul(b[0], sp)), c[0]);
+        Lanes y = Add(Add(Mul(a[1], cp), Mul(b[1], sp)), c[1]);
+        Lanes z = Add(Add(Mul(a[2], cp), Mul(b[2], sp)), c[2]);
+        
+        // Basis functions (in the order of `SphericalHarmonicsSampling.glsl`)
+        Lanes basis[9];
+        basis[0] = Broadcast(0.282095f);
+        basis[1] = Mul(Broadcast(0.488603f), y);
+        basis[2] = Mul(Broadcast(0.488603f), z);
+        basis[3] = Mul(Broadcast(0.488603f), x);
+        basis[4] = Mul(Broadcast(1.092548f), Mul(x, y));
+        basis[5] = Mul(Broadcast(1.092548f), Mul(y, z));
+        basis[6] = Mul(Broadcast(0.315392f), Sub(Mul(Broadcast(3.0f), Mul(z, z)), Broadcast(1.0f)));
+        basis[7] = Mul(Broadcast(1.092548f), Mul(x, z));
+        basis[8] = Mul(Broadcast(0.546274f), Sub(Mul(x, x), Mul(y, y)));
+        
+        // Radiance weighted by the solid angle of the texels
+        Lanes L[3] = {
+            Mul(Load(radiance + i), w),
+            Mul(Load(radiance + count + i), w),
+            Mul(Load(radiance + 2 * count + i), w)
+        };
+        
+        for (int k = 0; k < 9; k++)
+            for (int channel = 0; channel < 3; channel++)
+                accumulated[k][channel] = Add(accumulated[k][channel], Mul(basis[k], L[channel]));
+    }
+    
+    // Accumulate the rows in double precision (the images can have millions of texels)
+    for (int k = 0; k < 9; k++)
+        for (int channel = 0; channel < 3; channel++)
+            sums[3 * k + channel] += Sum(accumulated[k][channel]);
+}
+} // namespace
+
+/**
+ * Project an equirectangular image onto the spherical harmonics basis.
+ *
+ * @param data The texels of the image (`channels` floats per texel). The first row is sampled at
+ * the texture coordinate v = 0, as when it is uploaded to a texture.
+ * @param width The width of the image (in texels).
+ * @param height The height of the image (in texels).
+ * @param channels The number of channels of each texel (only the first three are used).
+ * @param rotation The rotation from the directions of the image to world space.
+ *
+ * @return The 9 coefficients, stored with interleaved RGB values (e.g., R00, G00, B00, R1-1, ...).
+ */
+std::vector<float> SHProjection::ProjectEquirectangular(const float* data, unsigned int width,
+                                                        unsigned int height, unsigned int channels,
+                                                        const glm::mat3& rotation)
+{
+    PROFILE_FUNCTION();
+    
+    std::vector<float> coefficients(3 * CoefficientCount, 0.0f);
+    if (!data || width == 0 || height == 0 || channels == 0)
+    {
+        CORE_WARN("Trying to project an undefined environment map!");
+        return coefficients;
+    }
+    
+    // Longitude of the center of each column (sampled as u = atan(z, x) / 2pi + 0.5)
+    const unsigned int padded = (width + g_Lanes - 1) / g_Lanes * g_Lanes;
+    std::vector<float> cosPhi(padded, 0.0f), sinPhi(padded, 0.0f);
+    for (unsigned int column = 0; column < width; column++)
+    {
+        float phi = (((float)column + 0.5f) / (float)width - 0.5f) * 2.0f * g_Pi;
+        cosPhi[column] = std::cos(phi);
+        sinPhi[column] = std::sin(phi);
+    }
+    const float deltaPhi = 2.0f * g_Pi / (float)width;
+    
+    // Each job adds its rows into its own partial sums
+    const unsigned int jobs = (height + g_RowsPerJob - 1) / g_RowsPerJob;
+    std::vector<std::array<double, 3 * CoefficientCount>> partials(jobs);
+    for (auto& partial : partials)
+        partial.fill(0.0);
+    
+    JobSystem::ParallelFor(height, g_RowsPerJob, [&](unsigned int begin, unsigned int end)
+    {
+        // Radiance of a row, split into one plane per channel (the padding does not contribute)
+        std::vector<float> radiance(3 * padded, 0.0f);
+        double* sums = partials[begin / g_RowsPerJob].data();
+        
+        for (unsigned int row = begin; row < end; row++)
+        {
+            const float* texel = data + (size_t)row * width * channels;
+            for (unsigned int column = 0; column < width; column++)
+            {
+                for (unsigned int channel = 0; channel < 3; channel++)
+                    radiance[channel * padded + column] =
+                        texel[column * channels + std::min(channel, channels - 1)];
+            }
+            
+            // The latitude is sampled as v = asin(y) / pi + 0.5, so the solid angle of the texels of
+            // a row is the difference of the sines of its borders
+            float bottom = ((float)row / (float)height - 0.5f) * g_Pi;
+            float top = ((float)(row + 1) / (float)height - 0.5f) * g_Pi;
+            float weight = deltaPhi * (std::sin(top) - std::sin(bottom));
+            
+            ProjectRow(radiance.data(), cosPhi.data(), sinPhi.data(), padded, 0.5f * (bottom + top),
+                       rotation, weight, sums);
+        }
+    }, nullptr, "SHProjection");
+    
+    // Reduce the partial sums in a fixed order
+    std::array<double, 3 * CoefficientCount> total;
+    total.fill(0.0);
+    for (const auto& partial : partials)
+        for (unsigned int i = 0; i < total.size(); i++)
+            total[i] += partial[i];
+    
+    for (unsigned int i = 0; i < total.size(); i++)
+        coefficients[i] = (float)total[i];
+    return coefficients;
+}
+
+/**
+ * Project an equirectangular image file (e.g., HDR) onto the spherical harmonics basis.
+ *
+ * @param filePath The path to the image file.
+ * @param flip Flip the image vertically (as when it is loaded into a texture).
+ * @param rotation The rotation from the directions of the image to world space.
+ *
+ * @return The 9 coefficients, stored with interleaved RGB values (e.g., R00, G00, B00, R1-1, ...).
+ */
+std::vector<float> SHProjection::ProjectEquirectangular(const std::filesystem::path& filePath,
+                                                        bool flip, const glm::mat3& rotation)
+{
+    // Load the image into the local buffer
+    stbi_set_flip_vertically_on_load(flip);
+    int width, height, channels;
+    float* data = stbi_loadf(filePath.string().c_str(), &width, &height, &channels, 0);
+    if (!data)
+    {
+        CORE_WARN("Failed to load: " + filePath.filename().string());
+        return std::vector<float>(3 * CoefficientCount, 0.0f);
+    }
+    
+    std::vector<float> coefficients = ProjectEquirectangular(data, (unsigned int)width,
+                                                             (unsigned int)height,
+                                                             (unsigned int)channels, rotation);
+    
+    // Free memory
+    stbi_image_free(data);
+    return coefficients;
+}
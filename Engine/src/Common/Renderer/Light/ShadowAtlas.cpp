@@ -0,0 +1,302 @@
+#include "enginepch.h"
+#include "Common/Renderer/Light/ShadowAtlas.h"
+
+#include "Common/Core/FrameScheduler.h"
+#include "Common/Renderer/Light/Light.h"
+#include "Common/Renderer/Light/DirectionalLight.h"
+#include "Common/Renderer/Light/PositionalLight.h"
+
+#include <cmath>
+
+namespace
+{
+/// Distance to the camera under which a positional light covers the whole view.
+constexpr float g_CoverageDistance = 10.0f;
+
+/**
+ * Get the position of a cell along a Z-order (Morton) curve.
+ *
+ * @param index The index of the cell along the curve.
+ *
+ * @return The coordinates of the cell.
+ */
+glm::uvec2 MortonDecode(unsigned int index)
+{
+    glm::uvec2 cell(0);
+    for (unsigned int bit = 0; (index >> (2 * bit)) != 0; bit++)
+    {
+        cell.x |= ((index >> (2 * bit)) & 1u) << bit;
+        cell.y |= ((index >> (2 * bit + 1)) & 1u) << bit;
+    }
+    return cell;
+}
+
+/**
+ * Check if a value is a power of two.
+ *
+ * @param value The value.
+ *
+ * @return `true` if the value is a power of two.
+ */
+bool IsPowerOfTwo(unsigned int value)
+{
+    return value > 0 && (value & (value - 1)) == 0;
+}
+} // namespace
+
+/**
+ * Define a shadow atlas.
+ *
+ * @param size The size of the atlas (in pixels, a power of two).
+ * @param minTileSize The size of the smallest tile (in pixels, a power of two).
+ */
+ShadowAtlas::ShadowAtlas(unsigned int size, unsigned int minTileSize)
+    : m_Size(size), m_MinTileSize(minTileSize)
+{
+    // The smallest tiles of all the lights must always fit in the atlas
+    CORE_ASSERT(IsPowerOfTwo(size) && IsPowerOfTwo(minTileSize) && minTileSize * 2 <= size,
+                "Invalid shadow atlas size!");
+    
+    TextureSpecification depthSpec(TextureFormat::DEPTH24);
+    depthSpec.Compare = true;
+    
+    FrameBufferSpecification spec;
+    spec.SetFrameBufferSize(size, size);
+    spec.AttachmentsSpec = { depthSpec };
+    m_Framebuffer = std::make_shared<FrameBuffer>(spec);
+}
+
+/**
+ * Render the shadow map of a light into a tile of the atlas.
+ *
+ * @param light The light source.
+ * @param importance The importance of the light (relative to the other lights of the atlas).
+ *
+ * @note The shadow map framebuffer of the light is replaced by the atlas, so the light must be
+ * added before defining the shadow render passes.
+ */
+void ShadowAtlas::Add(const std::shared_ptr<Light>& light, float importance)
+{
+    CORE_ASSERT(m_Tiles.size() < MaxTiles, "Too many lights in the shadow atlas!");
+    
+    // The shadow cascades are rendered in their own layered shadow map
+    auto directional = std::dynamic_pointer_cast<DirectionalLight>(light);
+    if (directional && directional->GetCascades())
+    {
+        CORE_WARN("Lights with shadow cascades cannot be added to a shadow atlas!");
+        return;
+    }
+    
+    // The omnidirectional shadow maps are rendered into their own cube map
+    auto positional = std::dynamic_pointer_cast<PositionalLight>(light);
+    if (positional && positional->GetShadowCube())
+    {
+        CORE_WARN("Lights with a shadow cube cannot be added to a shadow atlas!");
+        return;
+    }
+    
+    // The moments shadow maps are filtered in their own framebuffers
+    if (light->GetShadowMoments())
+    {
+        CORE_WARN("Lights with shadow moments cannot be added to a shadow atlas!");
+        return;
+    }
+    
+    Tile tile;
+    tile.Source = light;
+    tile.Importance = std::max(importance, 0.0f);
+    m_Tiles.push_back(tile);
+    
+    light->m_Framebuffer = m_Framebuffer;
+    FrameScheduler::RequestRedraw();
+}
+
+/**
+ * Release the tile of a light in the atlas.
+ *
+ * @param light The light source.
+ *
+ * @note The tiles of the next lights move one position back, so all of them are rendered again.
+ */
+void ShadowAtlas::Remove(const std::shared_ptr<Light>& light)
+{
+    int index = GetTileIndex(light);
+    if (index < 0)
+        return;
+    
+    m_Tiles.erase(m_Tiles.begin() + index);
+    
+    // Force the next update to report the modified layout
+    for (Tile& tile : m_Tiles)
+        tile.Transform = glm::mat4(0.0f);
+    FrameScheduler::RequestRedraw();
+}
+
+/**
+ * Get the tile of a light in the atlas.
+ *
+ * @param light The light source.
+ *
+ * @return The tile index (in the order the lights were added), or -1 if the light is not in the atlas.
+ */
+int ShadowAtlas::GetTileIndex(const std::shared_ptr<Light>& light) const
+{
+    for (unsigned int i = 0; i < m_Tiles.size(); i++)
+    {
+        if (m_Tiles[i].Source == light)
+            return (int)i;
+    }
+    return -1;
+}
+
+/**
+ * Modify the importance of a light in the atlas.
+ *
+ * @param light The light source.
+ * @param importance The importance of the light (relative to the other lights of the atlas).
+ */
+void ShadowAtlas::SetImportance(const std::shared_ptr<Light>& light, float importance)
+{
+    for (Tile& tile : m_Tiles)
+    {
+        if (tile.Source == light)
+            tile.Importance = std::max(importance, 0.0f);
+    }
+}
+
+/**
+ * Resize and place the tiles of the lights for the view of a camera.
+ *
+ * @param camera The camera rendering the shadowed scene.
+ *
+ * @return `true` if the layout of the atlas or the view of one of its lights has been modified.
+ */
+bool ShadowAtlas::Update(const Camera& camera)
+{
+    if (m_Tiles.empty())
+        return false;
+    
+    float maxImportance = 0.0f;
+    for (const Tile& tile : m_Tiles)
+        maxImportance = std::max(maxImportance, tile.Importance);
+    
+    // A single light can use the whole atlas
+    unsigned int maxTileSize = m_Tiles.size() > 1 ? m_Size / 2 : m_Size;
+    
+    std::vector<Tile> previous = m_Tiles;
+    for (Tile& tile : m_Tiles)
+    {
+        // The positional lights cover less of the view as they get farther from the camera
+        glm::vec4 vector = tile.Source->m_Vector;
+        float coverage = 1.0f;
+        if (vector.w == 1.0f)
+        {
+            float distance = glm::length(glm::vec3(vector) - camera.GetPosition());
+            coverage = std::min(g_CoverageDistance / std::max(distance, 1e-4f), 1.0f);
+        }
+        
+        // The area of the tile is proportional to the weight of the light
+        float weight = maxImportance > 0.0f ? tile.Importance / maxImportance * coverage : coverage;
+        float size = (float)maxTileSize * std::sqrt(weight);
+        
+        tile.Size = m_MinTileSize;
+        while (tile.Size * 2 <= size && tile.Size * 2 <= maxTileSize)
+            tile.Size *= 2;
+    }
+    Pack();
+    
+    bool changed = false;
+    for (unsigned int i = 0; i < m_Tiles.size(); i++)
+    {
+        // The lights do not report the changes of their shadow cameras
+        const std::shared_ptr<Camera>& shadowCamera = m_Tiles[i].Source->GetShadowCamera();
+        m_Tiles[i].Transform = shadowCamera->GetProjectionMatrix() * shadowCamera->GetViewMatrix();
+        
+        changed |= m_Tiles[i].Size != previous[i].Size || m_Tiles[i].Offset != previous[i].Offset ||
+                   m_Tiles[i].Transform != previous[i].Transform;
+    }
+    return changed;
+}
+
+/**
+ * Place the tiles in the atlas (reducing the largest ones until all of them fit).
+ */
+void ShadowAtlas::Pack()
+{
+    // Sort the tiles by size (and importance, for the same size)
+    std::vector<unsigned int> order(m_Tiles.size());
+    for (unsigned int i = 0; i < order.size(); i++)
+        order[i] = i;
+    
+    auto sortTiles = [&]()
+    {
+        std::stable_sort(order.begin(), order.end(), [&](unsigned int a, unsigned int b)
+        {
+            if (m_Tiles[a].Size != m_Tiles[b].Size)
+                return m_Tiles[a].Size > m_Tiles[b].Size;
+            return m_Tiles[a].Importance > m_Tiles[b].Importance;
+        });
+    };
+    sortTiles();
+    
+    // Halve the largest (and least important) tile until the tiles fit
+    auto area = [&]()
+    {
+        uint64_t total = 0;
+        for (const Tile& tile : m_Tiles)
+            total += (uint64_t)tile.Size * tile.Size;
+        return total;
+    };
+    while (area() > (uint64_t)m_Size * m_Size)
+    {
+        unsigned int largest = 0;
+        while (largest + 1 < order.size() && m_Tiles[order[largest + 1]].Size == m_Tiles[order[0]].Size)
+            largest++;
+        m_Tiles[order[largest]].Size /= 2;
+        sortTiles();
+    }
+    
+    // Place the tiles along a Z-order curve (all the sizes are powers of two and sorted, so each
+    // tile starts at a position aligned to its size)
+    unsigned int cell = 0;
+    for (unsigned int index : order)
+    {
+        Tile& tile = m_Tiles[index];
+        tile.Offset = MortonDecode(cell) * m_MinTileSize;
+        
+        unsigned int cells = tile.Size / m_MinTileSize;
+        cell += cells * cells;
+        
+        // Define the rectangle of the tile in the texture coordinates of the atlas
+        tile.Source->m_ShadowTile = glm::vec4(glm::vec2(tile.Offset), glm::vec2((float)tile.Size)) /
+                                    (float)m_Size;
+    }
+}
+
+/**
+ * Define the atlas (used for shading) into the uniforms of the shader program.
+ *
+ * @param shader The shader program.
+ * @param slot The next texture slot available.
+ */
+void ShadowAtlas::DefineProperties(const std::shared_ptr<Shader>& shader, unsigned int& slot) const
+{
+    utils::Texturing::SetTextureMap(shader, "u_ShadowAtlas", GetShadowMap(), slot++);
+}
+
+/**
+ * Define the tiles (used for rendering the shadow maps) into the uniforms of the shader program.
+ *
+ * @param shader The shader program.
+ */
+void ShadowAtlas::DefineDepthProperties(const std::shared_ptr<Shader>& shader) const
+{
+    shader->SetInt("u_Atlas.Count", (int)m_Tiles.size());
+    for (unsigned int i = 0; i < m_Tiles.size(); i++)
+    {
+        const std::shared_ptr<Camera>& camera = m_Tiles[i].Source->GetShadowCamera();
+        shader->SetMat4("u_Atlas.Transform[" + std::to_string(i) + "]",
+                        camera->GetProjectionMatrix() * camera->GetViewMatrix());
+        shader->SetVec4("u_Atlas.Tile[" + std::to_string(i) + "]", m_Tiles[i].Source->m_ShadowTile);
+    }
+}
@@ -0,0 +1,250 @@
+#include "enginepch.h"
+#include "Common/Renderer/Light/ShadowCascades.h"
+
+#include "Common/Core/FrameScheduler.h"
+#include "Common/Renderer/Material/Material.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cmath>
+
+namespace
+{
+/// Granularity of the radius of the cascades (avoids resizing them because of rounding errors).
+constexpr float g_RadiusGranularity = 1.0f / 16.0f;
+
+/**
+ * Compute the sphere enclosing a set of points.
+ *
+ * @param points The points (in world space).
+ * @param center The center of the sphere.
+ *
+ * @return The radius of the sphere.
+ */
+float BoundingSphere(const std::array<glm::vec3, 8>& points, glm::vec3& center)
+{
+    center = glm::vec3(0.0f);
+    for (const glm::vec3& p : points)
+        center += p;
+    center /= (float)points.size();
+    
+    float radius = 0.0f;
+    for (const glm::vec3& p : points)
+        radius = std::max(radius, glm::length(p - center));
+    return std::ceil(radius / g_RadiusGranularity) * g_RadiusGranularity;
+}
+} // namespace
+
+/**
+ * Define the shadow cascades of a directional light.
+ *
+ * @param resolution The size of each layer of the shadow map (in pixels).
+ * @param count The number of cascades.
+ */
+ShadowCascades::ShadowCascades(unsigned int resolution, unsigned int count)
+    : m_Count(count), m_Resolution(resolution)
+{
+    CORE_ASSERT(count > 0 && count <= MaxCascades, "Invalid number of shadow cascades!");
+    
+    // All the layers are allocated (only the cascades in use are rendered and sampled)
+    TextureSpecification depthSpec(TextureFormat::DEPTH24, TextureWrap::ClampToBorder);
+    depthSpec.Type = TextureType::TEXTURE2DARRAY;
+    depthSpec.Compare = true;
+    
+    FrameBufferSpecification spec;
+    spec.SetFrameBufferSize(resolution, resolution, MaxCascades);
+    spec.AttachmentsSpec = { depthSpec };
+    m_Framebuffer = std::make_shared<FrameBuffer>(spec);
+}
+
+/**
+ * Fit the cascades to the view of a camera.
+ *
+ * @param camera The camera rendering the shadowed scene.
+ * @param direction The direction of the light.
+ * @param casters The bounds of the shadow casters (in world space, empty if `min > max`).
+ *
+ * @return `true` if the light matrices of the cascades have been modified.
+ */
+bool ShadowCascades::Update(const Camera& camera, const glm::vec3& direction, const BBox& casters)
+{
+    // Corners of the camera frustum (near plane first, then far plane) in world space
+    glm::mat4 inverse = glm::inverse(camera.GetProjectionMatrix() * camera.GetViewMatrix());
+    std::array<glm::vec3, 8> frustum;
+    for (int i = 0; i < 8; i++)
+    {
+        glm::vec4 p = inverse * glm::vec4((i & 1) ? 1.0f : -1.0f, (i & 2) ? 1.0f : -1.0f,
+                                          (i & 4) ? 1.0f : -1.0f, 1.0f);
+        frustum[i] = glm::vec3(p) / p.w;
+    }
+    
+    // Split the view depth range, blending the logarithmic and uniform schemes
+    float nearPlane = camera.GetNearPlane();
+    float farPlane = camera.GetFarPlane();
+    float shadowFar = std::max(std::min(farPlane, m_ShadowDistance), nearPlane);
+    for (unsigned int i = 0; i < m_Count; i++)
+    {
+        float p = (float)(i + 1) / (float)m_Count;
+        float logarithmic = nearPlane * std::pow(shadowFar / nearPlane, p);
+        float uniform = nearPlane + (shadowFar - nearPlane) * p;
+        m_Splits[i] = m_SplitLambda * logarithmic + (1.0f - m_SplitLambda) * uniform;
+    }
+    
+    // The view depth varies linearly between the near and far corners of the frustum
+    auto subFrustum = [&](float begin, float end)
+    {
+        std::array<glm::vec3, 8> corners;
+        for (int i = 0; i < 4; i++)
+        {
+            glm::vec3 ray = frustum[i + 4] - frustum[i];
+            corners[i] = frustum[i] + ray * ((begin - nearPlane) / (farPlane - nearPlane));
+            corners[i + 4] = frustum[i] + ray * ((end - nearPlane) / (farPlane - nearPlane));
+        }
+        return corners;
+    };
+    
+    // Orientation of the light (without translation, so the cascades can be snapped to its texels)
+    glm::vec3 up = std::abs(direction.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+    glm::mat4 lightView = glm::lookAt(glm::vec3(0.0f), direction, up);
+    
+    // Depth range of the shadow casters in light space (the light looks along -Z)
+    bool hasCasters = casters.min.x <= casters.max.x;
+    float casterMin = std::numeric_limits<float>::max();
+    float casterMax = std::numeric_limits<float>::lowest();
+    for (int i = 0; hasCasters && i < 8; i++)
+    {
+        glm::vec3 p((i & 1) ? casters.max.x : casters.min.x,
+                    (i & 2) ? casters.max.y : casters.min.y,
+                    (i & 4) ? casters.max.z : casters.min.z);
+        float z = (lightView * glm::vec4(p, 1.0f)).z;
+        casterMin = std::min(casterMin, z);
+        casterMax = std::max(casterMax, z);
+    }
+    
+    std::array<glm::mat4, MaxCascades> transforms = m_Transforms;
+    for (unsigned int i = 0; i < m_Count; i++)
+    {
+        // Each cascade also covers the end of the previous one (where both are blended)
+        float begin = nearPlane;
+        if (i > 0)
+        {
+            float previous = i > 1 ? m_Splits[i - 2] : 0.0f;
+            begin = std::max(m_Splits[i - 1] - (m_Splits[i - 1] - previous) * m_BlendRange, nearPlane);
+        }
+        
+        // Fit the cascade to the sphere enclosing its sub-frustum (stable under rotations)
+        glm::vec3 center;
+        float radius = BoundingSphere(subFrustum(begin, m_Splits[i]), center);
+        
+        // Snap the center to the texels of the shadow map (stable under translations)
+        glm::vec3 lightCenter = glm::vec3(lightView * glm::vec4(center, 1.0f));
+        float texel = 2.0f * radius / (float)m_Resolution;
+        lightCenter.x = std::floor(lightCenter.x / texel) * texel;
+        lightCenter.y = std::floor(lightCenter.y / texel) * texel;
+        
+        // Extend the depth range towards the light to include all the casters in front of the cascade,
+        // and shorten it behind the farthest caster
+        float zMax = lightCenter.z + radius;
+        float zMin = lightCenter.z - radius;
+        if (hasCasters)
+        {
+            zMax = std::max(zMax, casterMax);
+            zMin = std::min(std::max(zMin, casterMin), zMax - texel);
+        }
+        
+        glm::mat4 projection = glm::ortho(lightCenter.x - radius, lightCenter.x + radius,
+                                          lightCenter.y - radius, lightCenter.y + radius,
+                                          -zMax, -zMin);
+        transforms[i] = projection * lightView;
+    }
+    
+    // Sphere enclosing all the cascades (used to place the shadow camera of the light)
+    m_Radius = BoundingSphere(subFrustum(nearPlane, m_Splits[m_Count - 1]), m_Center);
+    float centerZ = (lightView * glm::vec4(m_Center, 1.0f)).z;
+    m_CasterDistance = hasCasters ? std::max(m_Radius, casterMax - centerZ) : m_Radius;
+    
+    // Only report the changes of the light matrices (the camera changes are reported by the passes)
+    bool changed = transforms != m_Transforms || m_View != camera.GetViewMatrix();
+    m_Transforms = transforms;
+    m_View = camera.GetViewMatrix();
+    return changed;
+}
+
+/**
+ * Define the cascades (used for shading) into the uniforms of the shader program.
+ *
+ * @param shader The shader program.
+ * @param light The index of the light casting the shadows.
+ * @param slot The next texture slot available.
+ */
+void ShadowCascades::DefineProperties(const std::shared_ptr<Shader>& shader, unsigned int light,
+                                      unsigned int& slot) const
+{
+    shader->SetInt("u_Cascades.Count", (int)m_Count);
+    shader->SetInt("u_Cascades.Light", (int)light);
+    shader->SetVec4("u_Cascades.Splits", glm::vec4(m_Splits[0], m_Splits[1], m_Splits[2], m_Splits[3]));
+    shader->SetFloat("u_Cascades.BlendRange", m_BlendRange);
+    shader->SetMat4("u_Cascades.View", m_View);
+    for (unsigned int i = 0; i < m_Count; i++)
+        shader->SetMat4("u_Cascades.Transform[" + std::to_string(i) + "]", m_Transforms[i]);
+    
+    utils::Texturing::SetTextureMap(shader, "u_Cascades.ShadowMap", GetShadowMap(), slot++);
+}
+
+/**
+ * Define the cascades (used for rendering the shadow map) into the uniforms of the shader program.
+ *
+ * @param shader The shader program.
+ */
+void ShadowCascades::DefineDepthProperties(const std::shared_ptr<Shader>& shader) const
+{
+    shader->SetInt("u_Cascades.Count", (int)m_Count);
+    for (unsigned int i = 0; i < m_Count; i++)
+        shader->SetMat4("u_Cascades.Transform[" + std::to_string(i) + "]", m_Transforms[i]);
+}
+
+/**
+ * Define the number of cascades.
+ *
+ * @param count The number of cascades (up to `MaxCascades`).
+ */
+void ShadowCascades::SetCount(unsigned int count)
+{
+    CORE_ASSERT(count > 0 && count <= MaxCascades, "Invalid number of shadow cascades!");
+    m_Count = count;
+    FrameScheduler::RequestRedraw();
+}
+
+/**
+ * Define the weight of the logarithmic split scheme.
+ *
+ * @param lambda The split weight (0 for uniform splits, 1 for logarithmic splits).
+ */
+void ShadowCascades::SetSplitLambda(float lambda)
+{
+    m_SplitLambda = std::clamp(lambda, 0.0f, 1.0f);
+    FrameScheduler::RequestRedraw();
+}
+
+/**
+ * Define the maximum distance to the camera with shadows.
+ *
+ * @param distance The shadow distance (limited by the far plane of the camera).
+ */
+void ShadowCascades::SetShadowDistance(float distance)
+{
+    CORE_ASSERT(distance > 0.0f, "Invalid shadow distance!");
+    m_ShadowDistance = distance;
+    FrameScheduler::RequestRedraw();
+}
+
+/**
+ * Define the fraction of each cascade that is blended with the next one.
+ *
+ * @param range The blend range (between 0 and 1).
+ */
+void ShadowCascades::SetBlendRange(float range)
+{
+    m_BlendRange = std::clamp(range, 0.0f, 1.0f);
+    FrameScheduler::RequestRedraw();
+}
@@ -0,0 +1,114 @@
+#include "enginepch.h"
+#include "Common/Renderer/Light/ShadowCube.h"
+
+#include "Common/Core/FrameScheduler.h"
+#include "Common/Renderer/Material/Material.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace
+{
+/// Viewing direction and up vector of each face of a cube map (+X, -X, +Y, -Y, +Z, -Z).
+const std::array<std::pair<glm::vec3, glm::vec3>, 6> g_CubeFaces = {{
+    { glm::vec3( 1.0f,  0.0f,  0.0f), glm::vec3(0.0f, -1.0f,  0.0f) },
+    { glm::vec3(-1.0f,  0.0f,  0.0f), glm::vec3(0.0f, -1.0f,  0.0f) },
+    { glm::vec3( 0.0f,  1.0f,  0.0f), glm::vec3(0.0f,  0.0f,  1.0f) },
+    { glm::vec3( 0.0f, -1.0f,  0.0f), glm::vec3(0.0f,  0.0f, -1.0f) },
+    { glm::vec3( 0.0f,  0.0f,  1.0f), glm::vec3(0.0f, -1.0f,  0.0f) },
+    { glm::vec3( 0.0f,  0.0f, -1.0f), glm::vec3(0.0f, -1.0f,  0.0f) },
+}};
+} // namespace
+
+/**
+ * Define the omnidirectional shadow map of a positional light.
+ *
+ * @param resolution The size of each face of the shadow map (in pixels).
+ * @param nearPlane The near distance of the shadows.
+ * @param farPlane The far distance of the shadows.
+ */
+ShadowCube::ShadowCube(unsigned int resolution, float nearPlane, float farPlane)
+    : m_Resolution(resolution), m_NearPlane(nearPlane), m_FarPlane(farPlane)
+{
+    CORE_ASSERT(nearPlane > 0.0f && farPlane > nearPlane, "Invalid shadow cube range!");
+    
+    // The faces are sampled with a direction, so they are clamped to their edges
+    TextureSpecification depthSpec(TextureFormat::DEPTH24, TextureWrap::ClampToEdge);
+    depthSpec.Type = TextureType::TEXTURECUBE;
+    depthSpec.Compare = true;
+    
+    FrameBufferSpecification spec;
+    spec.SetFrameBufferSize(resolution, resolution);
+    spec.AttachmentsSpec = { depthSpec };
+    m_Framebuffer = std::make_shared<FrameBuffer>(spec);
+}
+
+/**
+ * Place the faces of the shadow map at the position of the light.
+ *
+ * @param position The position of the light.
+ *
+ * @return `true` if the light matrices of the faces have been modified.
+ */
+bool ShadowCube::Update(const glm::vec3& position)
+{
+    m_Position = position;
+    
+    // Each face covers a quarter of the directions around the light (90 degrees)
+    glm::mat4 projection = glm::perspective(glm::radians(90.0f), 1.0f, m_NearPlane, m_FarPlane);
+    
+    std::array<glm::mat4, 6> transforms;
+    for (unsigned int face = 0; face < 6; face++)
+    {
+        const auto& [direction, up] = g_CubeFaces[face];
+        transforms[face] = projection * glm::lookAt(position, position + direction, up);
+    }
+    
+    bool changed = transforms != m_Transforms;
+    m_Transforms = transforms;
+    return changed;
+}
+
+/**
+ * Define the shadow map (used for shading) into the uniforms of the shader program.
+ *
+ * @param shader The shader program.
+ * @param light The index of the light casting the shadows.
+ * @param slot The next texture slot available.
+ */
+void ShadowCube::DefineProperties(const std::shared_ptr<Shader>& shader, unsigned int light,
+                                  unsigned int& slot) const
+{
+    shader->SetFloat("u_Light[" + std::to_string(light) + "].ShadowFar", m_FarPlane);
+    utils::Texturing::SetTextureMap(shader, "u_Light[" + std::to_string(light) + "].ShadowCube",
+                                    GetShadowMap(), slot++);
+}
+
+/**
+ * Define the faces (used for rendering the shadow map) into the uniforms of the shader program.
+ *
+ * @param shader The shader program.
+ */
+void ShadowCube::DefineDepthProperties(const std::shared_ptr<Shader>& shader) const
+{
+    shader->SetVec3("u_Cube.Position", m_Position);
+    shader->SetFloat("u_Cube.Far", m_FarPlane);
+    for (unsigned int face = 0; face < 6; face++)
+        shader->SetMat4("u_Cube.Transform[" + std::to_string(face) + "]", m_Transforms[face]);
+}
+
+/**
+ * Define the range of distances with shadows.
+ *
+ * @param nearPlane The near distance of the shadows.
+ * @param farPlane The far distance of the shadows.
+ */
+void ShadowCube::SetRange(float nearPlane, float farPlane)
+{
+    CORE_ASSERT(nearPlane > 0.0f && farPlane > nearPlane, "Invalid shadow cube range!");
+    m_NearPlane = nearPlane;
+    m_FarPlane = farPlane;
+    
+    // The light matrices are defined again on the next update
+    m_Transforms = {};
+    FrameScheduler::RequestRedraw();
+}
@@ -0,0 +1,163 @@
+#include "enginepch.h"
+#include "Common/Renderer/Light/ShadowMoments.h"
+
+#include "Common/Core/FrameScheduler.h"
+#include "Common/Renderer/Renderer.h"
+#include "Common/Renderer/Model/ModelUtils.h"
+
+namespace
+{
+/// Largest exponents of the depth warp stored without overflow (32-bit and 16-bit floats).
+const glm::vec2 g_MaxExponents32F = glm::vec2(42.0f, 42.0f);
+const glm::vec2 g_MaxExponents16F = glm::vec2(5.54f, 5.54f);
+} // namespace
+
+/**
+ * Define the moments shadow map of a light.
+ *
+ * @param width The width of the shadow map (in pixels).
+ * @param height The height of the shadow map (in pixels).
+ * @param format The format of the moments (`RGBA32F` or `RGBA16F`).
+ */
+ShadowMoments::ShadowMoments(unsigned int width, unsigned int height, TextureFormat format)
+    : m_Format(format)
+{
+    CORE_ASSERT(format == TextureFormat::RGBA32F || format == TextureFormat::RGBA16F,
+                "Invalid shadow moments format!");
+    m_Exponents = format == TextureFormat::RGBA32F ? glm::vec2(40.0f, 5.0f) : g_MaxExponents16F;
+    
+    // The occluders are rendered with a depth test, then their moments are blurred along each axis
+    FrameBufferSpecification spec;
+    spec.SetFrameBufferSize(width, height);
+    spec.AttachmentsSpec = { format, TextureFormat::DEPTH24 };
+    m_Framebuffer = std::make_shared<FrameBuffer>(spec);
+    
+    spec.AttachmentsSpec = { format };
+    m_BlurFramebuffer = std::make_shared<FrameBuffer>(spec);
+    
+    // The filtered moments are mipmapped (the mipmaps are generated when the framebuffer is unbound)
+    spec.MipMaps = true;
+    m_FilteredFramebuffer = std::make_shared<FrameBuffer>(spec);
+    
+    // Define the geometry covering the framebuffers
+    m_BlurMaterial = std::make_shared<BlurMaterial>();
+    using VertexData = GeoVertexData<glm::vec4, glm::vec2>;
+    m_Geometry = utils::Geometry::ModelPlane<VertexData>();
+    m_Geometry->SetScale(glm::vec3(2.0f));
+}
+
+/**
+ * Check if the moments must be rendered again.
+ *
+ * @return `true` if the moments have been modified since the last update.
+ */
+bool ShadowMoments::Update()
+{
+    bool modified = m_Modified;
+    m_Modified = false;
+    return modified;
+}
+
+/**
+ * Prefilter the rendered moments: blur them horizontally and vertically, and generate their
+ * mipmaps.
+ */
+void ShadowMoments::Filter()
+{
+    auto blur = [&](const std::shared_ptr<FrameBuffer>& src, const std::shared_ptr<FrameBuffer>& dst,
+                    const glm::vec2& direction)
+    {
+        m_BlurMaterial->SetTextureMap(src->GetColorAttachment(0));
+        m_BlurMaterial->SetDirection(direction);
+        m_BlurMaterial->SetRadius(m_BlurRadius);
+        
+        dst->Bind();
+        Renderer::BeginScene();
+        m_Geometry->DrawModel(m_BlurMaterial);
+        Renderer::EndScene();
+        dst->Unbind();
+    };
+    
+    blur(m_Framebuffer, m_BlurFramebuffer, glm::vec2(1.0f, 0.0f));
+    blur(m_BlurFramebuffer, m_FilteredFramebuffer, glm::vec2(0.0f, 1.0f));
+}
+
+/**
+ * Get the moments of a fragment at the far plane (the clear value of the map).
+ *
+ * @return The moments of the maximum depth.
+ */
+glm::vec4 ShadowMoments::GetClearValue() const
+{
+    float positive = std::exp(m_Exponents.x);
+    float negative = -std::exp(-m_Exponents.y);
+    return glm::vec4(positive, positive * positive, negative, negative * negative);
+}
+
+/**
+ * Define the moments shadow map (used for shading) into the uniforms of the shader program.
+ *
+ * @param shader The shader program.
+ * @param light The index of the light casting the shadows.
+ * @param slot The next texture slot available.
+ */
+void ShadowMoments::DefineProperties(const std::shared_ptr<Shader>& shader, unsigned int light,
+                                     unsigned int& slot) const
+{
+    shader->SetVec4("u_Light[" + std::to_string(light) + "].ShadowMoments",
+                    glm::vec4(m_Exponents, m_BleedingReduction, 1.0f));
+    utils::Texturing::SetTextureMap(shader, "u_Light[" + std::to_string(light) + "].MomentsMap",
+                                    GetMomentsMap(), slot++);
+}
+
+/**
+ * Define the depth warp (used for rendering the moments) into the uniforms of the shader program.
+ *
+ * @param shader The shader program.
+ */
+void ShadowMoments::DefineDepthProperties(const std::shared_ptr<Shader>& shader) const
+{
+    shader->SetVec2("u_Exponents", m_Exponents);
+}
+
+/**
+ * Define the exponents of the depth warp. Larger exponents reduce the light bleeding, but they are
+ * limited by the range of the format of the moments.
+ *
+ * @param exponents The positive and negative exponents.
+ */
+void ShadowMoments::SetExponents(const glm::vec2& exponents)
+{
+    glm::vec2 maxExponents = m_Format == TextureFormat::RGBA32F ? g_MaxExponents32F : g_MaxExponents16F;
+    m_Exponents = glm::clamp(exponents, glm::vec2(0.0f), maxExponents);
+    
+    // The moments are rendered again on the next update
+    m_Modified = true;
+    FrameScheduler::RequestRedraw();
+}
+
+/**
+ * Define the amount of light bleeding reduction.
+ *
+ * @param amount The fraction of the probability removed (between 0 and 1). Larger values remove
+ * more light bleeding, but also darken the penumbras.
+ */
+void ShadowMoments::SetBleedingReduction(float amount)
+{
+    m_BleedingReduction = std::clamp(amount, 0.0f, 0.99f);
+    FrameScheduler::RequestRedraw();
+}
+
+/**
+ * Define the radius of the blur applied to the moments.
+ *
+ * @param radius The radius (in texels).
+ */
+void ShadowMoments::SetBlurRadius(unsigned int radius)
+{
+    m_BlurRadius = radius;
+    
+    // The moments are filtered again on the next update
+    m_Modified = true;
+    FrameScheduler::RequestRedraw();
+}
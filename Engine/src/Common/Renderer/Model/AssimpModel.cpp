@@ -12,6 +12,8 @@
  */
 void AssimpModel::LoadModel(const std::filesystem::path &filePath)
 {
+    PROFILE_FUNCTION();
+    
     // Read the model file using the ASSIMP library
     Assimp::Importer importer;
     const aiScene *scene = importer.ReadFile(filePath.string(), aiProcess_Triangulate | aiProcess_GenSmoothNormals);
@@ -27,7 +29,7 @@ void AssimpModel::LoadModel(const std::filesystem::path &filePath)
     this->m_FilePath = filePath;
 
     // Process ASSIMP's root node recursively
-    ProcessNode(scene->mRootNode, scene);
+    ProcessNode(scene->mRootNode, scene, glm::mat4(1.0f));
     importer.FreeScene();
     
     // Update the model matrix for the model
@@ -39,22 +41,31 @@ void AssimpModel::LoadModel(const std::filesystem::path &filePath)
  *
  * @param node The current node being processed.
  * @param scene The ASSIMP scene containing the model data.
+ * @param parentTransform The accumulated transformation of the parent nodes.
  */
-void AssimpModel::ProcessNode(aiNode *node, const aiScene *scene)
+void AssimpModel::ProcessNode(aiNode *node, const aiScene *scene, const glm::mat4 &parentTransform)
 {
+    // Accumulate the node transformation (ASSIMP matrices are stored by rows)
+    const aiMatrix4x4 &m = node->mTransformation;
+    glm::mat4 local = glm::transpose(glm::mat4(m.a1, m.a2, m.a3, m.a4,
+                                               m.b1, m.b2, m.b3, m.b4,
+                                               m.c1, m.c2, m.c3, m.c4,
+                                               m.d1, m.d2, m.d3, m.d4));
+    glm::mat4 transform = parentTransform * local;
+    
     // Process all meshes inside each node
     for (unsigned int i = 0; i < node->mNumMeshes; i++)
     {
         // The node object only contains indices to index the actual
         // objects in the scene. The scene contains all the data
         aiMesh *mesh = scene->mMeshes[node->mMeshes[i]];
-        this->m_Meshes.push_back(ProcessMesh(mesh));
+        this->AddMesh(ProcessMesh(mesh), transform);
     }
 
     // Then do the same for each child node
     for (unsigned int i = 0; i < node->mNumChildren; i++)
     {
-        ProcessNode(node->mChildren[i], scene);
+        ProcessNode(node->mChildren[i], scene, transform);
     }
 }
 
@@ -76,51 +87,50 @@ Mesh<AssimpVertexData> AssimpModel::ProcessMesh(aiMesh *mesh)
         { "a_Normal", DataType::Vec3 }
     };
     
+    ReadMeshData(mesh, vertices, indices);
+    return Mesh<AssimpVertexData>(vertices, indices, layout);
+}
+
+/**
+ * Read the vertices and indices of an ASSIMP mesh (without creating any GPU resource).
+ *
+ * @param mesh The ASSIMP mesh to be read.
+ * @param vertices The vertex data of the mesh.
+ * @param indices The indices of the mesh faces.
+ */
+void AssimpModel::ReadMeshData(const aiMesh *mesh, std::vector<AssimpVertexData>& vertices,
+                               std::vector<unsigned int>& indices)
+{
     // Process the vertex data
     // -----------------------
-    // Check each mesh
+    vertices.resize(mesh->mNumVertices);
+    const aiVector3D* uvs = mesh->mTextureCoords[0];
+    const bool hasNormals = mesh->HasNormals();
     for (unsigned int i = 0; i < mesh->mNumVertices; i++)
     {
-        AssimpVertexData vertex;
-
+        AssimpVertexData& vertex = vertices[i];
+        
         // Positions
-        vertex.position.x = mesh->mVertices[i].x;
-        vertex.position.y = mesh->mVertices[i].y;
-        vertex.position.z = mesh->mVertices[i].z;
-        vertex.position.w = 1.0f;
-
+        vertex.position = glm::vec4(mesh->mVertices[i].x, mesh->mVertices[i].y,
+                                    mesh->mVertices[i].z, 1.0f);
+        
         // Texture coordinates
-        if (mesh->mTextureCoords[0])
-        { // contains uv's?
-            vertex.uv.x = mesh->mTextureCoords[0][i].x;
-            vertex.uv.y = mesh->mTextureCoords[0][i].y;
-        }
-        else
-            vertex.uv = glm::vec2(0.0f, 0.0f);
-
+        vertex.uv = uvs ? glm::vec2(uvs[i].x, uvs[i].y) : glm::vec2(0.0f);
+        
         // Normals
-        if (mesh->HasNormals())
-        {
-            vertex.normal.x = mesh->mNormals[i].x;
-            vertex.normal.y = mesh->mNormals[i].y;
-            vertex.normal.z = mesh->mNormals[i].z;
-        }
-        // Define the vertex of the model
-        vertices.push_back(vertex);
-        // Update its bounding box
-        this->UpdateBBoxWithVertex(vertex.position);
+        if (hasNormals)
+            vertex.normal = glm::vec3(mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z);
     }
     
     // Process indices
     // -----------------------
+    // Pass through each of the mesh's faces (triangles after triangulation) and retrieve
+    // the corresponding vertex indices
+    indices.clear();
+    indices.reserve(3 * mesh->mNumFaces);
     for (unsigned int i = 0; i < mesh->mNumFaces; i++)
     {
-        // Pass through each of the mesh's faces (triangle) and retrieve
-        // the corresponding vertex indices
-        aiFace face = mesh->mFaces[i];
-        for (unsigned int j = 0; j < face.mNumIndices; j++)
-            indices.push_back(face.mIndices[j]);
+        const aiFace& face = mesh->mFaces[i];
+        indices.insert(indices.end(), face.mIndices, face.mIndices + face.mNumIndices);
     }
-    
-    return Mesh<AssimpVertexData>(vertices, indices, layout);
 }
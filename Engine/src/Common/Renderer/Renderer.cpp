@@ -109,10 +109,14 @@ void Renderer::Draw(const std::shared_ptr<VertexArray>& vao, const PrimitiveType
 {
     vao->Bind();
     vao->GetIndexBuffer()->Bind();
-    glDrawElements(utils::OpenGL::PrimitiveTypeToOpenGLType(primitive),
-                   vao->GetIndexBuffer()->GetCount(), GL_UNSIGNED_INT, nullptr);
+    unsigned int count = vao->GetIndexBuffer()->GetCount();
+    glDrawElements(utils::OpenGL::PrimitiveTypeToOpenGLType(primitive), count, GL_UNSIGNED_INT, nullptr);
     
     g_Stats.drawCalls++;
+    if (primitive == PrimitiveType::Triangles)
+        g_Stats.triangles += count / 3;
+    else if (primitive == PrimitiveType::TriangleStrip && count > 2)
+        g_Stats.triangles += count - 2;
 }
 
 /**
@@ -160,6 +164,95 @@ void Renderer::Draw(const std::shared_ptr<VertexArray>& vao, const std::shared_p
     material->Unbind();
 }
 
+/**
+ * Render a list of indirect draw commands using the specified vertex array.
+ *
+ * @param vao The VertexArray containing the (shared) vertex and index buffers for rendering.
+ * @param material The material used to draw all the commands.
+ * @param commands The buffer containing the `DrawElementsIndirectCommand` list.
+ * @param drawCount The buffer containing the number of commands to be drawn. If it is
+ * not defined (or not supported), `maxDrawCount` commands are drawn.
+ * @param maxDrawCount The maximum number of commands to be drawn.
+ * @param primitive The type of primitive to be drawn (e.g., Points, Lines, Triangles).
+ */
+void Renderer::DrawIndirect(const std::shared_ptr<VertexArray>& vao,
+                            const std::shared_ptr<Material>& material,
+                            const std::shared_ptr<StorageBuffer>& commands,
+                            const std::shared_ptr<StorageBuffer>& drawCount,
+                            unsigned int maxDrawCount, const PrimitiveType &primitive)
+{
+    // Bind the material and set the view and projection matrices (the model
+    // matrices are defined per draw by the material shader)
+    material->Bind();
+    material->GetShader()->SetMat4("u_Transform.View", s_SceneData->ViewMatrix);
+    material->GetShader()->SetMat4("u_Transform.Projection", s_SceneData->ProjectionMatrix);
+    
+    if (material->GetMaterialFlags().ViewDirection)
+        material->GetShader()->SetVec3("u_View.Position", s_SceneData->ViewPosition);
+    
+    // Render the list of commands
+    vao->Bind();
+    vao->GetIndexBuffer()->Bind();
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, commands->m_ID);
+    
+    GLenum mode = utils::OpenGL::PrimitiveTypeToOpenGLType(primitive);
+    if (drawCount && GLEW_ARB_indirect_parameters)
+    {
+        glBindBuffer(GL_PARAMETER_BUFFER_ARB, drawCount->m_ID);
+        glMultiDrawElementsIndirectCountARB(mode, GL_UNSIGNED_INT, nullptr, 0, maxDrawCount, 0);
+        glBindBuffer(GL_PARAMETER_BUFFER_ARB, 0);
+    }
+    else
+        glMultiDrawElementsIndirect(mode, GL_UNSIGNED_INT, nullptr, maxDrawCount, 0);
+    
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    g_Stats.drawCalls++;
+    
+    // Unbind the material
+    material->Unbind();
+}
+
+/**
+ * Launch the work groups of a compute shader.
+ *
+ * @param shader The compute shader program (its uniforms should be already defined).
+ * @param groupsX The number of work groups in the x dimension.
+ * @param groupsY The number of work groups in the y dimension.
+ * @param groupsZ The number of work groups in the z dimension.
+ *
+ * @note The results are not visible to the following commands until a memory barrier
+ * is placed with `SetMemoryBarrier()`.
+ */
+void Renderer::Dispatch(const std::shared_ptr<Shader>& shader, unsigned int groupsX,
+                        unsigned int groupsY, unsigned int groupsZ)
+{
+    shader->Bind();
+    glDispatchCompute(groupsX, groupsY, groupsZ);
+    
+    g_Stats.dispatches++;
+}
+
+/**
+ * Wait for the previous shader writes before the specified memory accesses are performed.
+ *
+ * @param barrier The memory accesses to be synchronized.
+ */
+void Renderer::SetMemoryBarrier(const MemoryBarrierFlags& barrier)
+{
+    glMemoryBarrier(utils::OpenGL::MemoryBarrierFlagsToOpenGLMask(barrier));
+}
+
+/**
+ * Check if compute shaders (and storage buffers) are supported by the current context.
+ *
+ * @return `true` if compute work can be dispatched.
+ */
+bool Renderer::IsComputeSupported()
+{
+    return GLEW_ARB_compute_shader && GLEW_ARB_shader_storage_buffer_object &&
+        GLEW_ARB_shader_image_load_store;
+}
+
 /**
  * Set the viewport for rendering.
  *
@@ -229,6 +322,23 @@ void Renderer::SetCubeMapSeamless(const bool enabled)
         glDisable(GL_TEXTURE_CUBE_MAP_SEAMLESS);
 }
 
+/**
+ * Enable the first user-defined clip distances (`gl_ClipDistance`) written by the shaders.
+ *
+ * @param count The number of clip distances to be enabled (the others are disabled).
+ */
+void Renderer::SetClipDistances(const unsigned int count)
+{
+    // At least 8 clip distances are supported by every implementation
+    for (unsigned int i = 0; i < 8; i++)
+    {
+        if (i < count)
+            glEnable(GL_CLIP_DISTANCE0 + i);
+        else
+            glDisable(GL_CLIP_DISTANCE0 + i);
+    }
+}
+
 /**
  * Reset rendering statistics.
  *
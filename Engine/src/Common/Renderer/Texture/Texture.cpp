@@ -61,6 +61,26 @@ void Texture::BindToTextureUnit(const unsigned int slot) const
     Bind();
 }
 
+/**
+ * Bind (a mip level of) the texture to an image unit for image load/store operations.
+ *
+ * @param unit The image unit to which the texture will be bound.
+ * @param access The access performed by the shaders on the image.
+ * @param level The mip level of the texture to be bound.
+ *
+ * @note Layered textures (cube maps, 3D textures and 2D arrays) are bound with all their layers.
+ */
+void Texture::BindToImageUnit(const unsigned int unit, const TextureAccess& access,
+                              const unsigned int level) const
+{
+    GLboolean layered = m_Spec.Type == TextureType::TEXTURECUBE ||
+        m_Spec.Type == TextureType::TEXTURE3D || m_Spec.Type == TextureType::TEXTURE2DARRAY;
+    
+    glBindImageTexture(unit, m_ID, level, layered, 0,
+                       utils::OpenGL::TextureAccessToOpenGLType(access),
+                       utils::OpenGL::TextureFormatToOpenGLInternalType(m_Spec.Format));
+}
+
 /**
  * Unbind the texture.
  */
@@ -94,6 +94,13 @@ void Texture2D::CreateTexture(const void *data)
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
                     utils::OpenGL::TextureFilterToOpenGLType(m_Spec.Filter, false));
     
+    // Compare the sampled depth values with the reference value of the lookups (shadow samplers)
+    if (m_Spec.Compare && utils::OpenGL::IsDepthFormat(m_Spec.Format))
+    {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+    }
+    
     // Create the texture based on the format and data type
     if (utils::OpenGL::IsDepthFormat(m_Spec.Format))
     {
@@ -141,6 +148,8 @@ Texture2DResource::Texture2DResource(const std::filesystem::path& filePath, bool
  */
 void Texture2DResource::LoadFromFile(const std::filesystem::path& filePath)
 {
+    PROFILE_FUNCTION();
+    
     // Determine whether to flip the image vertically
     stbi_set_flip_vertically_on_load(m_Flip);
     
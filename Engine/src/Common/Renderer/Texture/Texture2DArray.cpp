@@ -0,0 +1,118 @@
+#include "enginepch.h"
+#include "Common/Renderer/Texture/Texture2DArray.h"
+
+#include <GL/glew.h>
+
+// --------------------------------------------
+// Texture (2D array)
+// --------------------------------------------
+
+/**
+ * Create a base 2D texture array.
+ */
+Texture2DArray::Texture2DArray()
+    : Texture()
+{
+    m_Spec.Type = TextureType::TEXTURE2DARRAY;
+}
+
+/**
+ * Create a 2D texture array from input data.
+ *
+ * @param data The data for all the layers of the texture.
+ */
+Texture2DArray::Texture2DArray(const void *data)
+    : Texture2DArray()
+{
+    CreateTexture(data);
+}
+
+/**
+ * Create a 2D base texture array with specific properties.
+ *
+ * @param spec The texture specifications (the depth defines the number of layers).
+ */
+Texture2DArray::Texture2DArray(const TextureSpecification& spec)
+    : Texture(spec)
+{
+    m_Spec.Type = TextureType::TEXTURE2DARRAY;
+}
+
+/**
+ * Create a 2D texture array from input data and with specific properties.
+ *
+ * @param data The data for all the layers of the texture.
+ * @param spec The texture specifications (the depth defines the number of layers).
+ */
+Texture2DArray::Texture2DArray(const void *data, const TextureSpecification& spec)
+    : Texture2DArray(spec)
+{
+    CreateTexture(data);
+}
+
+/**
+ * Get the texture target based on the texture specification.
+ *
+ * @return The OpenGL texture target.
+ */
+GLenum Texture2DArray::TextureTarget() const
+{
+    return (GLenum)GL_TEXTURE_2D_ARRAY;
+}
+
+/**
+ * Create and configure the texture based on the texture specification and provided data.
+ *
+ * @param data The texture data. This can be nullptr if the texture is to be written.
+ */
+void Texture2DArray::CreateTexture(const void *data)
+{
+    // Verify size of the 2D texture array
+    CORE_ASSERT(m_Spec.Width > 0 && m_Spec.Height > 0 && m_Spec.Depth > 0,
+                "2D texture array size not properly defined!");
+    
+    // Bind the texture
+    Bind();
+    
+    // Set texture wrapping and filtering parameters
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S,
+                    utils::OpenGL::TextureWrapToOpenGLType(m_Spec.Wrap));
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T,
+                    utils::OpenGL::TextureWrapToOpenGLType(m_Spec.Wrap));
+    
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER,
+                    utils::OpenGL::TextureFilterToOpenGLType(m_Spec.Filter, m_Spec.MipMaps));
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER,
+                    utils::OpenGL::TextureFilterToOpenGLType(m_Spec.Filter, false));
+    
+    // Compare the sampled depth values with the reference value of the lookups (shadow samplers)
+    if (m_Spec.Compare && utils::OpenGL::IsDepthFormat(m_Spec.Format))
+    {
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+    }
+    
+    // Create the texture based on the format and data type
+    if (utils::OpenGL::IsDepthFormat(m_Spec.Format))
+    {
+        glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, utils::OpenGL::TextureFormatToOpenGLBaseType(m_Spec.Format),
+                       m_Spec.Width, m_Spec.Height, m_Spec.Depth);
+        
+        float borderColor[] = { 1.0f, 1.0f, 1.0f, 1.0f };
+        glTexParameterfv(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BORDER_COLOR, borderColor);
+    }
+    else
+    {
+        glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, utils::OpenGL::TextureFormatToOpenGLInternalType(m_Spec.Format),
+                     m_Spec.Width, m_Spec.Height, m_Spec.Depth, 0,
+                     utils::OpenGL::TextureFormatToOpenGLBaseType(m_Spec.Format),
+                     utils::OpenGL::TextureFormatToOpenGLDataType(m_Spec.Format), data);
+    }
+    
+    // Generate mipmaps if specified
+    if (m_Spec.MipMaps)
+        glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+    
+    // Unbind the texture
+    Unbind();
+}
@@ -4,6 +4,47 @@
 #include <GL/glew.h>
 #include <stb_image.h>
 
+namespace
+{
+/**
+ * Get the type of the pixel data of a texture format in memory (the half-float formats keep their
+ * 16-bit values, so their data is not expanded).
+ *
+ * @param format The texture format.
+ *
+ * @return The OpenGL data type.
+ */
+GLenum PixelDataType(TextureFormat format)
+{
+    switch (format)
+    {
+        case TextureFormat::R16F:
+        case TextureFormat::RG16F:
+        case TextureFormat::RGB16F:
+        case TextureFormat::RGBA16F: return GL_HALF_FLOAT;
+        default: return utils::OpenGL::TextureFormatToOpenGLDataType(format);
+    }
+}
+
+/**
+ * Get the size of a pixel of a texture format in memory.
+ *
+ * @param format The texture format.
+ *
+ * @return The number of bytes of a pixel.
+ */
+unsigned int PixelSize(TextureFormat format)
+{
+    unsigned int channels = (unsigned int)utils::OpenGL::TextureFormatToChannelNumber(format);
+    switch (PixelDataType(format))
+    {
+        case GL_UNSIGNED_BYTE: return channels;
+        case GL_HALF_FLOAT: return 2 * channels;
+        default: return 4 * channels;
+    }
+}
+} // namespace
+
 // --------------------------------------------
 // Texture (3D)
 // --------------------------------------------
@@ -122,6 +163,13 @@ void TextureCube::CreateTexture(const std::vector<const void *>& data)
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER,
                     utils::OpenGL::TextureFilterToOpenGLType(m_Spec.Filter, false));
     
+    // Compare the sampled depth values with the reference value of the lookups (shadow samplers)
+    if (m_Spec.Compare && utils::OpenGL::IsDepthFormat(m_Spec.Format))
+    {
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+        glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+    }
+    
     for (unsigned int i = 0; i < data.size(); ++i)
     {
         // Verify size of the 2D texture
@@ -140,6 +188,91 @@ void TextureCube::CreateTexture(const std::vector<const void *>& data)
     Unbind();
 }
 
+/**
+ * Get the number of mipmap levels of the texture.
+ *
+ * @return The number of levels (1 if the texture does not use mipmaps).
+ */
+unsigned int TextureCube::GetLevelCount() const
+{
+    if (!m_Spec.MipMaps)
+        return 1;
+    
+    unsigned int levels = 1;
+    for (unsigned int size = std::max(m_Spec.Width, m_Spec.Height); size > 1; size /= 2)
+        levels++;
+    return levels;
+}
+
+/**
+ * Get the size of the faces of a mipmap level.
+ *
+ * @param level The mipmap level.
+ *
+ * @return The width (and height) of the faces (in pixels).
+ */
+unsigned int TextureCube::GetLevelSize(const unsigned int level) const
+{
+    return std::max(m_Spec.Width >> level, 1u);
+}
+
+/**
+ * Get the size of the data of a face (see `GetFaceData`).
+ *
+ * @param level The mipmap level.
+ *
+ * @return The number of bytes of the face.
+ */
+size_t TextureCube::GetFaceDataSize(const unsigned int level) const
+{
+    size_t size = GetLevelSize(level);
+    return size * size * PixelSize(m_Spec.Format);
+}
+
+/**
+ * Read the pixels of a face of the texture.
+ *
+ * @param face The face index (+X, -X, +Y, -Y, +Z, -Z).
+ * @param level The mipmap level.
+ *
+ * @return The tightly packed pixel data (with 16-bit values for the half-float formats).
+ */
+std::vector<char> TextureCube::GetFaceData(const unsigned int face, const unsigned int level) const
+{
+    std::vector<char> data(GetFaceDataSize(level));
+    
+    Bind();
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glGetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level,
+                  utils::OpenGL::TextureFormatToOpenGLBaseType(m_Spec.Format),
+                  PixelDataType(m_Spec.Format), data.data());
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    Unbind();
+    
+    return data;
+}
+
+/**
+ * Write the pixels of a face of the texture (the mipmap levels are not generated again). The storage
+ * of the level is kept, so the data must have the size and format of the texture.
+ *
+ * @param face The face index (+X, -X, +Y, -Y, +Z, -Z).
+ * @param level The mipmap level.
+ * @param data The tightly packed pixel data (see `GetFaceData`).
+ */
+void TextureCube::SetFaceData(const unsigned int face, const unsigned int level, const void *data)
+{
+    unsigned int size = GetLevelSize(level);
+    
+    Bind();
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, level, 0, 0, size, size,
+                    utils::OpenGL::TextureFormatToOpenGLBaseType(m_Spec.Format),
+                    PixelDataType(m_Spec.Format), data);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    Unbind();
+}
+
 // --------------------------------------------
 // Texture Cube Resource
 // --------------------------------------------
@@ -166,6 +299,8 @@ TextureCubeResource::TextureCubeResource(const std::filesystem::path& directory,
 void TextureCubeResource::LoadFromFile(const std::filesystem::path& directory,
                                        const std::vector<std::string>& files)
 {
+    PROFILE_FUNCTION();
+    
     // Check that the data contains exactly 6 faces
     CORE_ASSERT(files.size() == 6, "Invalid data for the texture cube map!");
     
@@ -1,9 +1,148 @@
 #include "enginepch.h"
 #include "Common/Scene/Scene.h"
 
+#include "Common/Renderer/FrameStatistics.h"
+#include "Common/Core/FrameScheduler.h"
+
 #include "Common/Renderer/Material/LightedMaterial.h"
 #include "Common/Renderer/Material/SimpleMaterial.h"
 #include "Common/Renderer/Light/PositionalLight.h"
+#include "Common/Renderer/Light/DirectionalLight.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace
+{
+/**
+ * Check if a bounding box intersects the view frustum of a camera.
+ *
+ * @param viewProjection The view-projection matrix of the camera.
+ * @param box The bounding box (in world space).
+ *
+ * @return `false` if the box is completely outside of one of the frustum planes.
+ */
+bool IntersectsFrustum(const glm::mat4& viewProjection, const BBox& box)
+{
+    // Count the corners outside of each plane (-x, +x, -y, +y, -z, +z) in clip space
+    int outside[6] = { 0, 0, 0, 0, 0, 0 };
+    for (int corner = 0; corner < 8; corner++)
+    {
+        glm::vec4 p = viewProjection * glm::vec4((corner & 1) ? box.max.x : box.min.x,
+                                                 (corner & 2) ? box.max.y : box.min.y,
+                                                 (corner & 4) ? box.max.z : box.min.z, 1.0f);
+        for (int axis = 0; axis < 3; axis++)
+        {
+            outside[2 * axis] += p[axis] < -p.w;
+            outside[2 * axis + 1] += p[axis] > p.w;
+        }
+    }
+    
+    for (int plane = 0; plane < 6; plane++)
+    {
+        if (outside[plane] == 8)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Transform a bounding box and enclose its corners in a new axis-aligned box.
+ *
+ * @param transform The transformation matrix.
+ * @param box The bounding box.
+ *
+ * @return The transformed bounding box.
+ */
+BBox TransformBox(const glm::mat4& transform, const BBox& box)
+{
+    BBox result;
+    result.min = glm::vec3(std::numeric_limits<float>::max());
+    result.max = glm::vec3(std::numeric_limits<float>::lowest());
+    for (int corner = 0; corner < 8; corner++)
+    {
+        glm::vec3 p((corner & 1) ? box.max.x : box.min.x,
+                    (corner & 2) ? box.max.y : box.min.y,
+                    (corner & 4) ? box.max.z : box.min.z);
+        p = glm::vec3(transform * glm::vec4(p, 1.0f));
+        result.min = glm::min(result.min, p);
+        result.max = glm::max(result.max, p);
+    }
+    return result;
+}
+
+/**
+ * Extract the planes of the view frustum of a camera in world space.
+ *
+ * @param viewProjection The view-projection matrix of the camera.
+ *
+ * @return The planes (-x, +x, -y, +y, -z, +z), with their normals pointing inside the frustum.
+ */
+std::array<glm::vec4, 6> FrustumPlanes(const glm::mat4& viewProjection)
+{
+    // Each plane combines the last row of the matrix with one of the others
+    glm::vec4 w(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+    
+    std::array<glm::vec4, 6> planes;
+    for (int axis = 0; axis < 3; axis++)
+    {
+        glm::vec4 row(viewProjection[0][axis], viewProjection[1][axis], viewProjection[2][axis],
+                      viewProjection[3][axis]);
+        planes[2 * axis] = w + row;
+        planes[2 * axis + 1] = w - row;
+    }
+    return planes;
+}
+
+/**
+ * Check if a bounding box can cast shadows into the frustum of a shadow camera.
+ *
+ * @param planes The planes of the frustum (see `FrustumPlanes`).
+ * @param box The bounding box (in world space).
+ *
+ * @return `false` if the box is completely outside of one of the planes.
+ *
+ * @note The frustum is extended toward the light (its near plane is ignored), so the casters between
+ * the light and the frustum are kept.
+ */
+bool IntersectsShadowFrustum(const std::array<glm::vec4, 6>& planes, const BBox& box)
+{
+    for (int plane = 0; plane < 6; plane++)
+    {
+        if (plane == 4)
+            continue;
+        
+        // Test the corner of the box the farthest along the normal of the plane
+        glm::vec3 normal(planes[plane]);
+        glm::vec3 corner = glm::mix(box.min, box.max, glm::greaterThan(normal, glm::vec3(0.0f)));
+        if (glm::dot(normal, corner) + planes[plane].w < 0.0f)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Check if a bounding box can cast shadows onto the receivers of a directional light.
+ *
+ * @param caster The bounding box of the caster (in the view space of the light).
+ * @param receivers The bounding boxes of the receivers (in the view space of the light).
+ *
+ * @return `true` if the caster covers a receiver and is not completely behind it.
+ */
+bool ShadowsReceivers(const BBox& caster, const std::vector<BBox>& receivers)
+{
+    for (const BBox& receiver : receivers)
+    {
+        if (caster.max.x < receiver.min.x || caster.min.x > receiver.max.x ||
+            caster.max.y < receiver.min.y || caster.min.y > receiver.max.y)
+            continue;
+        
+        // The light looks down -z, so the points closer to the light have a larger z
+        if (caster.max.z >= receiver.min.z)
+            return true;
+    }
+    return false;
+}
+} // namespace
 
 /**
  * Define a scene to be rendered.
@@ -19,30 +158,403 @@ Scene::Scene(int width, int height,
     m_Camera = std::make_shared<PerspectiveCamera>(width, height);
     
     // Define the lights
-    m_Lights.Create<EnvironmentLight>("Environment", width, height);
+    AddLight("Environment", std::make_shared<EnvironmentLight>(width, height));
     
     // Define the viewport
     m_Viewport = std::make_shared<Viewport>(width, height, viewportShader);
     
     Renderer::GetMaterialLibrary().Add("Viewport", m_Viewport->m_Material);
     m_FramebufferLibrary.Add("Viewport", m_Viewport->m_Framebuffer);
-    m_Models.Add("Viewport", m_Viewport->m_Geometry);
+    AddModel("Viewport", m_Viewport->m_Geometry);
+}
+
+/**
+ * Add a model to the scene as a new entity.
+ *
+ * @param name The name of the entity.
+ * @param model The model to be rendered.
+ *
+ * @return The entity representing the model.
+ */
+Entity Scene::AddModel(const std::string& name, const std::shared_ptr<BaseModel>& model)
+{
+    CORE_ASSERT(m_Entities.find(name) == m_Entities.end(), "Entity " + name + " already exists!");
+    
+    Entity entity = m_Registry.CreateEntity();
+    m_Registry.Add<NameComponent>(entity, { name });
+    m_Registry.Add<RenderableComponent>(entity, { model });
+    m_Registry.Add<BoundsComponent>(entity);
+    
+    m_Entities[name] = entity;
+    m_Version++;
+    return entity;
+}
+
+/**
+ * Add a light source to the scene as a new entity.
+ *
+ * @param name The name of the entity.
+ * @param light The light source.
+ *
+ * @return The entity representing the light source.
+ */
+Entity Scene::AddLight(const std::string& name, const std::shared_ptr<BaseLight>& light)
+{
+    CORE_ASSERT(m_Entities.find(name) == m_Entities.end(), "Entity " + name + " already exists!");
+    
+    // The light library is used by the materials to define the light uniforms
+    m_Lights.Add(name, light);
+    
+    Entity entity = m_Registry.CreateEntity();
+    m_Registry.Add<NameComponent>(entity, { name });
+    m_Registry.Add<LightComponent>(entity, { light });
+    
+    m_Entities[name] = entity;
+    m_Version++;
+    return entity;
+}
+
+/**
+ * Find the entity associated with a name.
+ *
+ * @param name The name of the entity.
+ *
+ * @return The entity, or `NullEntity` if it does not exist.
+ *
+ * @note The lookup is meant to be done when loading the scene, not while rendering it.
+ */
+Entity Scene::FindEntity(const std::string& name) const
+{
+    auto it = m_Entities.find(name);
+    return it != m_Entities.end() ? it->second : NullEntity;
+}
+
+/**
+ * Remove an entity (and all its components) from the scene.
+ *
+ * @param entity The entity to be removed (a light entity also removes its light from the light
+ * library).
+ */
+void Scene::DestroyEntity(const Entity& entity)
+{
+    if (!m_Registry.IsAlive(entity))
+        return;
+    
+    auto name = m_Registry.TryGet<NameComponent>(entity);
+    if (name && m_Registry.Has<LightComponent>(entity))
+        m_Lights.Remove(name->Name);
+    if (name)
+        m_Entities.erase(name->Name);
+    
+    m_Registry.DestroyEntity(entity);
+    m_Version++;
+}
+
+/**
+ * Compile a render pass: resolve its model and material names into a flat draw list.
+ *
+ * @param pass The render pass specification.
+ * @param compiled The compiled render pass.
+ */
+void Scene::Compile(const RenderPassSpecification &pass, CompiledRenderPass &compiled)
+{
+    compiled.Draws.clear();
+    compiled.LightedMaterials.clear();
+    compiled.DrawLights = false;
+    compiled.PresentViewport = false;
+    
+    auto& renderables = m_Registry.GetComponents<RenderableComponent>();
+    for (auto& pair : pass.Models)
+    {
+        // Check if the model is the light sources and render it separately
+        if (pair.first == "Light")
+        {
+            compiled.DrawLights = true;
+            continue;
+        }
+        
+        // Check if the model is the viewport displayed with its own material (it is presented
+        // directly, depending on its render scale)
+        if (pair.first == "Viewport" && (pair.second.empty() || pair.second == "Viewport"))
+        {
+            compiled.PresentViewport = true;
+            continue;
+        }
+        
+        // Retrieve the entity associated with the current pair
+        Entity entity = FindEntity(pair.first);
+        if (!renderables.Has(entity))
+        {
+            CORE_WARN("Model " + pair.first + " not found!");
+            continue;
+        }
+        
+        // Define the draw with the material overriding the model materials (if specified)
+        DrawItem item;
+        item.Renderable = renderables.IndexOf(entity);
+        item.Model = renderables.GetData()[item.Renderable].Model;
+        if (!pair.second.empty())
+            item.Material = Renderer::GetMaterialLibrary().Get(pair.second);
+        item.Atlas = std::dynamic_pointer_cast<AtlasDepthMaterial>(item.Material);
+        compiled.Draws.push_back(item);
+        
+        // Keep track of the lighted materials to define their light properties once
+        auto& material = item.Material;
+        if (std::dynamic_pointer_cast<LightedMaterial>(material) &&
+            std::find(compiled.LightedMaterials.begin(), compiled.LightedMaterials.end(), material) ==
+            compiled.LightedMaterials.end())
+            compiled.LightedMaterials.push_back(material);
+    }
+    
+    // Find the lights rendering their shadow maps in the pass (several lights can share an atlas)
+    compiled.ShadowLights.clear();
+    compiled.Casters.clear();
+    compiled.Moments = nullptr;
+    if (pass.Framebuffer)
+    {
+        auto& lights = m_Registry.GetComponents<LightComponent>();
+        auto& names = m_Registry.GetComponents<NameComponent>();
+        for (unsigned int i = 0; i < lights.Size(); i++)
+        {
+            auto light = std::dynamic_pointer_cast<Light>(lights.GetData()[i].Light);
+            if (!light || light->GetFramebuffer() != pass.Framebuffer)
+                continue;
+            
+            auto name = names.TryGet(lights.GetEntities()[i]);
+            compiled.ShadowLights.push_back({ light, Profiler::Intern(name ? name->Name : "Light") });
+            if (light->GetShadowMoments())
+                compiled.Moments = light->GetShadowMoments();
+        }
+    }
+    
+    // The culling stage draws all the models with its own material, so it can only replace the
+    // draws sharing a single material (the tiles of an atlas are selected per draw instead)
+    compiled.Culled = pass.Culling && !compiled.Draws.empty();
+    for (auto& item : compiled.Draws)
+    {
+        if (!item.Material || item.Material != compiled.Draws.front().Material || item.Atlas ||
+            item.Model->GetPrimitive() != PrimitiveType::Triangles)
+            compiled.Culled = false;
+    }
+    
+    // The culling stage needs to be defined again with the new models
+    if (pass.Culling)
+        pass.Culling->Invalidate();
+    
+    // The cached images do not contain the new models
+    compiled.Valid = false;
+    compiled.StaticValid = false;
+    
+    compiled.Version = m_Version;
+}
+
+/**
+ * Check if the models of a cached render pass moved (or changed their meshes, materials or
+ * visibility) inside the view of its camera.
+ *
+ * @param pass The render pass specification.
+ * @param compiled The compiled render pass (its camera matrix must be up to date).
+ */
+void Scene::UpdateCache(const RenderPassSpecification &pass, CompiledRenderPass &compiled)
+{
+    auto& renderables = m_Registry.GetComponents<RenderableComponent>();
+    auto& bounds = m_Registry.GetComponents<BoundsComponent>();
+    
+    for (auto& item : compiled.Draws)
+    {
+        auto moved = bounds.TryGet(renderables.GetEntities()[item.Renderable]);
+        if (!moved || !moved->Changed)
+            continue;
+        
+        // Only the models moving into, inside or out of the view modify the image (a pass without
+        // camera is modified by any model)
+        if (pass.Camera && !IntersectsFrustum(compiled.ViewProjection, moved->Bounds) &&
+            !IntersectsFrustum(compiled.ViewProjection, moved->Previous))
+            continue;
+        
+        compiled.Valid = false;
+        if (renderables.GetData()[item.Renderable].Static)
+            compiled.StaticValid = false;
+    }
+}
+
+/**
+ * Select the models of a shadow pass that can cast shadows onto the visible receivers.
+ *
+ * The casters are kept inside the volume of each light of the pass: the sphere of its shadow cube,
+ * or the frustum of its shadow camera extended toward the light. The directional lights also drop
+ * the casters that do not cover any receiver, or that are completely behind them. The lights are
+ * selected per draw, so a model in a shadow atlas is only rendered into the tiles of its lights.
+ *
+ * @param compiled The compiled render pass (with its shadow lights).
+ *
+ * @note The receivers must be up to date (see `UpdateShadows`).
+ */
+void Scene::CullShadowCasters(CompiledRenderPass &compiled)
+{
+    auto& renderables = m_Registry.GetComponents<RenderableComponent>();
+    auto& bounds = m_Registry.GetComponents<BoundsComponent>();
+    
+    std::vector<uint32_t> casters(compiled.Draws.size(), 0);
+    const std::shared_ptr<ShadowAtlas>& atlas = m_Lights.GetShadowAtlas();
+    for (unsigned int l = 0; l < compiled.ShadowLights.size(); l++)
+    {
+        auto& [light, name] = compiled.ShadowLights[l];
+        
+        // The lights of an atlas are identified by their tile (as in the depth shader)
+        int tile = atlas && atlas->GetFramebuffer() == light->GetFramebuffer() ?
+            atlas->GetTileIndex(light) : -1;
+        const uint32_t bit = 1u << std::min(tile >= 0 ? (unsigned int)tile : l, 31u);
+        
+        auto directional = std::dynamic_pointer_cast<DirectionalLight>(light);
+        auto positional = std::dynamic_pointer_cast<PositionalLight>(light);
+        const bool cube = positional && positional->GetShadowCube();
+        
+        // The shadow cascades are fitted to the view of the scene camera, so they are only bounded
+        // by the receivers
+        const bool frustum = !cube && !(directional && directional->GetCascades());
+        std::array<glm::vec4, 6> planes;
+        if (frustum)
+        {
+            const std::shared_ptr<Camera>& camera = light->GetShadowCamera();
+            planes = FrustumPlanes(camera->GetProjectionMatrix() * camera->GetViewMatrix());
+        }
+        
+        // Define the receivers in the view space of the directional light
+        glm::mat4 lightView(1.0f);
+        std::vector<BBox> receivers;
+        if (directional)
+        {
+            glm::vec3 direction = glm::normalize(directional->GetDirection());
+            glm::vec3 up = std::abs(direction.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) :
+                                                           glm::vec3(0.0f, 1.0f, 0.0f);
+            lightView = glm::lookAt(glm::vec3(0.0f), direction, up);
+            for (const BBox& receiver : m_Receivers)
+                receivers.push_back(TransformBox(lightView, receiver));
+        }
+        
+        unsigned int count = 0;
+        for (unsigned int i = 0; i < compiled.Draws.size(); i++)
+        {
+            unsigned int index = compiled.Draws[i].Renderable;
+            if (!renderables.GetData()[index].Visible)
+                continue;
+            
+            // The models without bounds are always drawn
+            auto box = bounds.TryGet(renderables.GetEntities()[index]);
+            bool caster = true;
+            if (box && cube)
+            {
+                glm::vec3 position = positional->GetPosition();
+                glm::vec3 closest = glm::clamp(position, box->Bounds.min, box->Bounds.max);
+                caster = glm::length(closest - position) <= positional->GetShadowCube()->GetFarPlane();
+            }
+            else if (box)
+            {
+                caster = (!frustum || IntersectsShadowFrustum(planes, box->Bounds)) &&
+                         (!directional || ShadowsReceivers(TransformBox(lightView, box->Bounds), receivers));
+            }
+            
+            if (caster)
+            {
+                casters[i] |= bit;
+                count++;
+            }
+        }
+        FrameStatistics::SetShadowCasters(name, count);
+    }
+    
+    // The new casters need to be drawn into the cached shadow maps of their lights (the culled ones
+    // can stay in them, since they do not shadow any visible receiver)
+    for (unsigned int i = 0; i < casters.size(); i++)
+    {
+        uint32_t previous = i < compiled.Casters.size() ? compiled.Casters[i] : 0;
+        if ((casters[i] & ~previous) == 0)
+            continue;
+        
+        compiled.Valid = false;
+        if (renderables.GetData()[compiled.Draws[i].Renderable].Static)
+            compiled.StaticValid = false;
+    }
+    compiled.Casters = std::move(casters);
+}
+
+/**
+ * Select the deferred render passes updated in this frame (in turns, within the frame budget).
+ */
+void Scene::ScheduleDeferred()
+{
+    unsigned int count = (unsigned int)m_RenderPasses.m_Order.size();
+    unsigned int budget = m_DeferredBudget;
+    unsigned int start = m_DeferredCursor;
+    
+    for (unsigned int k = 0; k < count; k++)
+    {
+        unsigned int i = (start + k) % count;
+        auto& pass = m_RenderPasses.Get(m_RenderPasses.m_Order[i]);
+        auto& compiled = m_CompiledPasses[i];
+        
+        compiled.Postponed = false;
+        if (!pass.Active || !pass.Cached.value_or(false) || !pass.Deferred.value_or(false) ||
+            compiled.Valid)
+            continue;
+        
+        // The passes out of the budget wait for the next frames
+        if (budget > 0)
+        {
+            budget--;
+            m_DeferredCursor = i + 1;
+        }
+        else
+        {
+            compiled.Postponed = true;
+            FrameScheduler::RequestRedraw();
+        }
+    }
+}
+
+/**
+ * Mark the cached render passes drawing into a framebuffer as out of date (e.g., after modifying
+ * the light matrices or the depth material of a shadow map).
+ *
+ * @param framebuffer The framebuffer of the render passes.
+ */
+void Scene::InvalidateFramebuffer(const std::shared_ptr<FrameBuffer>& framebuffer)
+{
+    unsigned int count = std::min((unsigned int)m_CompiledPasses.size(),
+                                  (unsigned int)m_RenderPasses.m_Order.size());
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (m_RenderPasses.Get(m_RenderPasses.m_Order[i]).Framebuffer != framebuffer)
+            continue;
+        
+        m_CompiledPasses[i].Valid = false;
+        m_CompiledPasses[i].StaticValid = false;
+    }
+    FrameScheduler::RequestRedraw();
 }
 
 /**
  * Draws the scene using the provided render pass specification.
  *
  * @param pass The render pass specification containing the parameters for drawing the scene.
+ * @param compiled The draw list of the render pass.
+ * @param layer The models to be drawn (the static ones are drawn into the static layer, and the
+ * dynamic ones over the current image of the framebuffer).
  */
-void Scene::Draw(const RenderPassSpecification &pass)
+void Scene::Draw(const RenderPassSpecification &pass, const CompiledRenderPass &compiled,
+                 const DrawLayer layer)
 {
+    const std::shared_ptr<FrameBuffer>& framebuffer = layer == DrawLayer::Static ?
+        compiled.StaticLayer : pass.Framebuffer;
+    
     // Run the post-rendering code
     if (pass.PreRenderCode)
         pass.PreRenderCode();
     
     // Bind the framebuffer if it is provided
-    if (pass.Framebuffer)
-        pass.Framebuffer->Bind();
+    if (framebuffer)
+        framebuffer->Bind();
     
     // Begin the scene with the provided camera, or without a camera if none is provided
     if (pass.Camera)
@@ -54,69 +566,185 @@ void Scene::Draw(const RenderPassSpecification &pass)
         Renderer::SetViewport(0, 0, pass.Size.value().x, pass.Size.value().y);
     
     // Clear the framebuffer with the specified color (if provided), or clear it with the active buffers
-    bool clear = pass.SkipClear.has_value() ? !*pass.SkipClear : true;
+    // (the clear value of the moments depends on the current exponents of their light)
+    bool clear = pass.SkipClear.has_value() ? !*pass.SkipClear : layer != DrawLayer::Dynamic;
     if (clear)
     {
-        if (pass.Framebuffer && pass.Color.has_value())
-            Renderer::Clear(pass.Color.value(), pass.Framebuffer->GetActiveBuffers());
-        else if (pass.Framebuffer)
-            Renderer::Clear(pass.Framebuffer->GetActiveBuffers());
-        else if (pass.Color.has_value())
-            Renderer::Clear(pass.Color.value());
+        std::optional<glm::vec4> color = compiled.Moments ? compiled.Moments->GetClearValue() : pass.Color;
+        if (framebuffer && color.has_value())
+            Renderer::Clear(color.value(), framebuffer->GetActiveBuffers());
+        else if (framebuffer)
+            Renderer::Clear(framebuffer->GetActiveBuffers());
+        else if (color.has_value())
+            Renderer::Clear(color.value());
         else
             Renderer::Clear();
     }
     
-    // Render each model with its associated material
-    for (auto& pair : pass.Models)
+    // Cull and render the models on the GPU if it is possible (the layers are drawn directly)
+    if (layer == DrawLayer::All && compiled.Culled && GPUCulling::IsSupported())
+        DrawCulled(pass, compiled);
+    else
     {
-        // Check if the model is the light sources and render it separately
-        if (pair.first == "Light")
-        {
-            DrawLight(); // Render the light source
-            continue;   // Move to the next iteration of the loop
-        }
-            
-        // Retrieve the model associated with the current pair
-        auto& model = m_Models.Get(pair.first);
+        // Define the light properties of the materials used in the pass
+        for (auto& material : compiled.LightedMaterials)
+            DefineShadowProperties(material);
         
-        // Check if the model is valid
-        if (model)
+        // Render each model with its associated material (without modifying the model)
+        auto& renderables = m_Registry.GetComponents<RenderableComponent>().GetData();
+        for (unsigned int i = 0; i < compiled.Draws.size(); i++)
         {
-            // If a material is specified for the model, set it
-            if (!pair.second.empty())
-            {
-                auto& material = Renderer::GetMaterialLibrary().Get(pair.second);
-                DefineShadowProperties(material);
-                model->SetMaterial(material);
-            }
+            auto& item = compiled.Draws[i];
+            auto& renderable = renderables[item.Renderable];
+            if (!renderable.Visible ||
+                (layer == DrawLayer::Static && !renderable.Static) ||
+                (layer == DrawLayer::Dynamic && renderable.Static))
+                continue;
+            
+            // Skip the models that do not cast shadows into the maps of the pass, and only render the
+            // others into the tiles of their lights
+            if (!compiled.Casters.empty() && !compiled.Casters[i])
+                continue;
+            if (item.Atlas)
+                item.Atlas->SetTileMask(compiled.Casters.empty() ? ~0u : compiled.Casters[i]);
             
-            // Draw the model
-            model->DrawModel();
+            item.Model->DrawModel(item.Material);
         }
+        
+        // Render the light sources
+        if (compiled.DrawLights && layer != DrawLayer::Static)
+            DrawLight();
+        
+        // Display the image rendered in the viewport
+        if (compiled.PresentViewport)
+            m_Viewport->Present();
     }
         
     // End the scene
     Renderer::EndScene();
     
     // Unbind the framebuffer if it was provided
-    if (pass.Framebuffer)
-        pass.Framebuffer->Unbind();
+    if (framebuffer)
+        framebuffer->Unbind();
     
     // Run the post-rendering code
     if (pass.PostRenderCode)
         pass.PostRenderCode();
 }
 
+/**
+ * Draws a cached render pass, keeping its static models in a separate layer.
+ *
+ * @param pass The render pass specification.
+ * @param compiled The compiled render pass.
+ *
+ * @note The layered framebuffers (e.g., shadow cascades or cubes) are always drawn at once.
+ */
+void Scene::DrawCached(const RenderPassSpecification &pass, CompiledRenderPass &compiled)
+{
+    compiled.Valid = true;
+    
+    // Check which kind of models are drawn by the pass
+    bool hasStatic = false, hasDynamic = compiled.DrawLights;
+    auto& renderables = m_Registry.GetComponents<RenderableComponent>().GetData();
+    for (auto& item : compiled.Draws)
+    {
+        auto& renderable = renderables[item.Renderable];
+        if (renderable.Visible)
+            (renderable.Static ? hasStatic : hasDynamic) = true;
+    }
+    
+    // Without static and dynamic models, the whole image is cached (as well as the layered images,
+    // which cannot be copied at once)
+    const FrameBufferSpecification& spec = pass.Framebuffer->GetSpec();
+    auto& depth = pass.Framebuffer->GetDepthAttachment();
+    bool layered = spec.Depth > 0 || (depth && depth->GetSpecification().Type != TextureType::TEXTURE2D);
+    if (!hasStatic || !hasDynamic || layered)
+    {
+        compiled.StaticLayer.reset();
+        Draw(pass, compiled);
+        return;
+    }
+    
+    // Define the static layer with the same attachments as the framebuffer of the pass
+    if (!compiled.StaticLayer || compiled.StaticLayer->GetSpec().Width != spec.Width ||
+        compiled.StaticLayer->GetSpec().Height != spec.Height)
+    {
+        compiled.StaticLayer = std::make_shared<FrameBuffer>(spec);
+        compiled.StaticValid = false;
+    }
+    
+    // Render the static models only when they changed, then draw the dynamic models over them
+    if (!compiled.StaticValid)
+    {
+        Draw(pass, compiled, DrawLayer::Static);
+        compiled.StaticValid = true;
+    }
+    FrameBuffer::Blit(compiled.StaticLayer, pass.Framebuffer, TextureFilter::Nearest,
+                      pass.Framebuffer->GetActiveBuffers());
+    Draw(pass, compiled, DrawLayer::Dynamic);
+}
+
+/**
+ * Draws the models of a render pass using its GPU culling stage.
+ *
+ * @param pass The render pass specification containing the culling stage.
+ * @param compiled The draw list of the render pass.
+ */
+void Scene::DrawCulled(const RenderPassSpecification &pass, const CompiledRenderPass &compiled)
+{
+    // Define the objects of the culling stage from the models of the pass (in the order of the draws)
+    if (!pass.Culling->IsBuilt())
+    {
+        std::vector<std::shared_ptr<BaseModel>> models;
+        for (auto& item : compiled.Draws)
+            models.push_back(item.Model);
+        pass.Culling->Build(models);
+    }
+    
+    // Skip the hidden models, and the models that do not cast shadows into the maps of the pass
+    auto& renderables = m_Registry.GetComponents<RenderableComponent>().GetData();
+    for (unsigned int i = 0; i < compiled.Draws.size(); i++)
+    {
+        bool enabled = renderables[compiled.Draws[i].Renderable].Visible &&
+                       (compiled.Casters.empty() || compiled.Casters[i]);
+        pass.Culling->SetModelEnabled(i, enabled);
+    }
+    
+    // Cull the objects using the frustum of the pass camera
+    glm::mat4 viewProjection = pass.Camera ?
+        pass.Camera->GetProjectionMatrix() * pass.Camera->GetViewMatrix() : glm::mat4(1.0f);
+    pass.Culling->Cull(viewProjection);
+    
+    // Draw the visible objects
+    pass.Culling->Draw();
+    
+    // Render the light sources (if requested)
+    if (compiled.DrawLights)
+        DrawLight();
+}
+
 /**
  * Draws the scene lights.
  */
 void Scene::DrawLight()
 {
-    for (auto& pair : m_Lights)
+    for (auto& component : m_Registry.GetComponents<LightComponent>())
+        component.Light->DrawLight();
+}
+
+/**
+ * Prefilters the moments shadow maps rendered into a framebuffer.
+ *
+ * @param framebuffer The framebuffer of a render pass.
+ */
+void Scene::FilterShadowMoments(const std::shared_ptr<FrameBuffer>& framebuffer)
+{
+    for (auto& component : m_Registry.GetComponents<LightComponent>())
     {
-        auto& light = pair.second;
-        light->DrawLight();
+        auto light = std::dynamic_pointer_cast<Light>(component.Light);
+        if (light && light->GetShadowMoments() && light->GetFramebuffer() == framebuffer)
+            light->GetShadowMoments()->Filter();
     }
 }
 
@@ -125,20 +753,250 @@ void Scene::DrawLight()
  */
 void Scene::Draw()
 {
-    for (auto& name : m_RenderPasses.m_Order)
+    PROFILE_FUNCTION();
+    
+    // Propagate the modified transformations to the attached objects
+    UpdateTransforms();
+    UpdateBounds();
+    UpdateShadows();
+    
+    // Adapt the resolution of the viewport to the measured GPU times
+    m_Viewport->UpdateRenderScale();
+    
+    // Passes added since the last frame still need to be compiled
+    if (m_CompiledPasses.size() != m_RenderPasses.m_Order.size())
+        m_CompiledPasses.resize(m_RenderPasses.m_Order.size());
+    
+    for (unsigned int i = 0; i < m_RenderPasses.m_Order.size(); i++)
+    {
+        auto& pass = m_RenderPasses.Get(m_RenderPasses.m_Order[i]);
+        auto& compiled = m_CompiledPasses[i];
+        
+        // Compile the pass again only if the structure of the scene has changed
+        if (compiled.Version != m_Version)
+        {
+            Compile(pass, compiled);
+            compiled.Name = Profiler::Intern("RenderPass " +
+                                             m_RenderPasses.GetKey(m_RenderPasses.m_Order[i]));
+            FrameScheduler::RequestRedraw();
+        }
+        
+        // Check if the camera of the pass moved (cameras do not report their changes)
+        if (pass.Camera)
+        {
+            glm::mat4 viewProjection = pass.Camera->GetProjectionMatrix() * pass.Camera->GetViewMatrix();
+            if (viewProjection != compiled.ViewProjection)
+            {
+                compiled.ViewProjection = viewProjection;
+                compiled.Valid = false;
+                compiled.StaticValid = false;
+                FrameScheduler::RequestRedraw();
+            }
+        }
+        
+        // Select the shadow casters of the lights rendered by the pass
+        if (pass.Active && !compiled.ShadowLights.empty())
+            CullShadowCasters(compiled);
+        
+        // Check if the cached image is still up to date
+        if (!pass.Active)
+            compiled.Valid = false;
+        else if (pass.Cached.value_or(false) && compiled.Valid)
+            UpdateCache(pass, compiled);
+    }
+    ScheduleDeferred();
+    
+    // Without any change, only the passes drawing on the screen present the last rendered images
+    // (and the cached passes are only drawn when their image is out of date)
+    const bool redraw = FrameScheduler::ShouldRedraw();
+    for (unsigned int i = 0; i < m_RenderPasses.m_Order.size(); i++)
     {
-        auto& pass = m_RenderPasses.Get(name);
-        if (pass.Active)
-            Draw(pass);
+        auto& pass = m_RenderPasses.Get(m_RenderPasses.m_Order[i]);
+        auto& compiled = m_CompiledPasses[i];
+        
+        bool cached = pass.Active && pass.Framebuffer && pass.Cached.value_or(false);
+        if (cached ? (compiled.Valid || compiled.Postponed) : (!redraw && pass.Framebuffer))
+            continue;
+        
+        PROFILE_SCOPE(compiled.Name);
+        FrameStatistics::BeginPass(compiled.Name);
+        if (cached)
+            DrawCached(pass, compiled);
+        else if (pass.Active)
+            Draw(pass, compiled);
         else
         {
             if (pass.Framebuffer)
                 pass.Framebuffer->Bind();
             Renderer::Clear(glm::vec4(0.0f));
         }
+        
+        // Prefilter the shadow moments rendered by the pass
+        if (pass.Active && pass.Framebuffer)
+            FilterShadowMoments(pass.Framebuffer);
+        FrameStatistics::EndPass();
+    }
+}
+
+/**
+ * Attach an entity (model or light source) to a node of the transform hierarchy.
+ *
+ * @param entity The entity to be attached.
+ * @param node The node defining the parent transformation of the entity.
+ */
+void Scene::AttachToNode(const Entity& entity, const TransformNode node)
+{
+    CORE_ASSERT(node < m_Transforms.GetNodeCount(), "Trying to attach an entity to an unknown node!");
+    m_Registry.Add<TransformComponent>(entity, { node });
+    
+    // Apply the current transformation on the next update
+    m_Transforms.SetPosition(node, m_Transforms.GetPosition(node));
+}
+
+/**
+ * Attach a camera to a node of the transform hierarchy.
+ *
+ * @param camera The camera to be attached.
+ * @param node The node defining the position and orientation of the camera.
+ */
+void Scene::AttachToNode(const std::shared_ptr<Camera>& camera, const TransformNode node)
+{
+    CORE_ASSERT(node < m_Transforms.GetNodeCount(), "Trying to attach a camera to an unknown node!");
+    m_AttachedCameras.emplace_back(node, camera);
+}
+
+/**
+ * Update the world matrices of the transform hierarchy and apply them to the attached objects.
+ *
+ * @note Only the objects attached to a node that moved since the last update are modified.
+ */
+void Scene::UpdateTransforms()
+{
+    if (m_Transforms.GetNodeCount() == 0)
+        return;
+    
+    m_Transforms.Update();
+    
+    auto& transforms = m_Registry.GetComponents<TransformComponent>();
+    auto& renderables = m_Registry.GetComponents<RenderableComponent>();
+    auto& lights = m_Registry.GetComponents<LightComponent>();
+    
+    const auto& entities = transforms.GetEntities();
+    for (unsigned int i = 0; i < transforms.Size(); i++)
+    {
+        TransformNode node = transforms.GetData()[i].Node;
+        if (!m_Transforms.HasChanged(node))
+            continue;
+        
+        const glm::mat4& world = m_Transforms.GetWorldMatrix(node);
+        if (auto renderable = renderables.TryGet(entities[i]))
+            renderable->Model->SetParentMatrix(world);
+        if (auto light = lights.TryGet(entities[i]))
+            light->Light->SetTransform(world);
+    }
+    
+    for (auto& [node, camera] : m_AttachedCameras)
+    {
+        if (m_Transforms.HasChanged(node))
+            camera->SetPose(glm::vec3(m_Transforms.GetWorldMatrix(node)[3]),
+                            m_Transforms.GetWorldRotation(node));
     }
 }
 
+/**
+ * Update the world space bounds of the renderable entities.
+ */
+void Scene::UpdateBounds()
+{
+    auto& bounds = m_Registry.GetComponents<BoundsComponent>();
+    auto& renderables = m_Registry.GetComponents<RenderableComponent>();
+    
+    const auto& entities = bounds.GetEntities();
+    for (unsigned int i = 0; i < bounds.Size(); i++)
+    {
+        auto renderable = renderables.TryGet(entities[i]);
+        if (!renderable)
+            continue;
+        
+        // Only the entities that moved (or changed visibility) need new bounds, but a modified mesh
+        // or material also invalidates the cached images using the model
+        BoundsComponent& component = bounds.GetData()[i];
+        const glm::mat4& transform = renderable->Model->GetModelMatrix();
+        const unsigned int revision = renderable->Model->GetRevision();
+        component.Changed = transform != component.Transform || renderable->Visible != component.Visible ||
+                            revision != component.Revision;
+        if (!component.Changed)
+            continue;
+        
+        component.Transform = transform;
+        component.Visible = renderable->Visible;
+        component.Revision = revision;
+        component.Previous = component.Bounds;
+        
+        // Transform the corners of the model bounding box
+        component.Bounds = TransformBox(transform, renderable->Model->GetBoundingBox());
+    }
+}
+
+/**
+ * Fit the shadow cascades of the directional lights and the tiles of the shadow atlas to the
+ * view of the scene camera, place the omnidirectional shadow maps at their lights, and collect the
+ * shadow receivers inside the view.
+ *
+ * @note The world space bounds must be up to date (see `UpdateBounds`).
+ */
+void Scene::UpdateShadows()
+{
+    // Bounds of the shadow casters (all the renderables except the viewport)
+    BBox casters;
+    casters.min = glm::vec3(std::numeric_limits<float>::max());
+    casters.max = glm::vec3(std::numeric_limits<float>::lowest());
+    
+    auto& bounds = m_Registry.GetComponents<BoundsComponent>();
+    auto& renderables = m_Registry.GetComponents<RenderableComponent>();
+    
+    glm::mat4 viewProjection = m_Camera->GetProjectionMatrix() * m_Camera->GetViewMatrix();
+    m_Receivers.clear();
+    
+    const auto& entities = bounds.GetEntities();
+    for (unsigned int i = 0; i < bounds.Size(); i++)
+    {
+        auto renderable = renderables.TryGet(entities[i]);
+        if (!renderable || !renderable->Visible || renderable->Model == m_Viewport->m_Geometry)
+            continue;
+        
+        const BBox& box = bounds.GetData()[i].Bounds;
+        casters.min = glm::min(casters.min, box.min);
+        casters.max = glm::max(casters.max, box.max);
+        
+        // Only the models inside the view can receive visible shadows
+        if (IntersectsFrustum(viewProjection, box))
+            m_Receivers.push_back(box);
+    }
+    
+    for (auto& component : m_Registry.GetComponents<LightComponent>())
+    {
+        auto light = std::dynamic_pointer_cast<DirectionalLight>(component.Light);
+        if (light && light->UpdateCascades(*m_Camera, casters))
+            InvalidateFramebuffer(light->GetFramebuffer());
+        
+        // The omnidirectional shadow maps follow their lights
+        auto positional = std::dynamic_pointer_cast<PositionalLight>(component.Light);
+        if (positional && positional->UpdateShadowCube())
+            InvalidateFramebuffer(positional->GetFramebuffer());
+        
+        // The moments shadow maps are rendered again when their depth warp changes
+        auto caster = std::dynamic_pointer_cast<Light>(component.Light);
+        if (caster && caster->GetShadowMoments() && caster->GetShadowMoments()->Update())
+            InvalidateFramebuffer(caster->GetFramebuffer());
+    }
+    
+    // Resize the tiles of the shadow atlas from the view of the camera
+    auto& atlas = m_Lights.GetShadowAtlas();
+    if (atlas && atlas->Update(*m_Camera))
+        InvalidateFramebuffer(atlas->GetFramebuffer());
+}
+
 /**
  * Define shadow properties for a given material.
  *
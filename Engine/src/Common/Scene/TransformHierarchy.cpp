@@ -0,0 +1,448 @@
+#include "enginepch.h"
+#include "Common/Scene/TransformHierarchy.h"
+
+#include <numeric>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define TRANSFORM_HIERARCHY_SSE
+#endif
+
+namespace
+{
+/// Smallest scale of an axis from which a rotation can be extracted.
+constexpr float g_MinScale = 1e-6f;
+
+/**
+ * Multiply two matrices (column-major) using SIMD instructions when available.
+ *
+ * @param a The left matrix.
+ * @param b The right matrix.
+ * @param result The product `a * b`.
+ */
+inline void MultiplyMatrix(const glm::mat4& a, const glm::mat4& b, glm::mat4& result)
+{
+#ifdef TRANSFORM_HIERARCHY_SSE
+    const float* pa = &a[0][0];
+    const float* pb = &b[0][0];
+    float* pr = &result[0][0];
+    
+    __m128 a0 = _mm_loadu_ps(pa);
+    __m128 a1 = _mm_loadu_ps(pa + 4);
+    __m128 a2 = _mm_loadu_ps(pa + 8);
+    __m128 a3 = _mm_loadu_ps(pa + 12);
+    
+    // Each column of the result is a linear combination of the columns of a
+    for (int i = 0; i < 4; i++)
+    {
+        __m128 column = _mm_mul_ps(a0, _mm_set1_ps(pb[4 * i + 0]));
+        column = _mm_add_ps(column, _mm_mul_ps(a1, _mm_set1_ps(pb[4 * i + 1])));
+        column = _mm_add_ps(column, _mm_mul_ps(a2, _mm_set1_ps(pb[4 * i + 2])));
+        column = _mm_add_ps(column, _mm_mul_ps(a3, _mm_set1_ps(pb[4 * i + 3])));
+        _mm_storeu_ps(pr + 4 * i, column);
+    }
+#else
+    result = a * b;
+#endif
+}
+
+#ifdef TRANSFORM_HIERARCHY_SSE
+/**
+ * Load the same column of four matrices, transposed so that each register holds one element
+ * of the column for the four matrices.
+ *
+ * @param matrices The four matrices.
+ * @param column The column index.
+ * @param elements The elements of the column (one register per row).
+ */
+inline void LoadColumns(const glm::mat4* const matrices[4], int column, __m128 elements[4])
+{
+    for (int n = 0; n < 4; n++)
+        elements[n] = _mm_loadu_ps(&(*matrices[n])[column][0]);
+    _MM_TRANSPOSE4_PS(elements[0], elements[1], elements[2], elements[3]);
+}
+
+/**
+ * Multiply four pairs of matrices at once (one pair per SIMD lane).
+ *
+ * @param a The left matrices.
+ * @param b The right matrices.
+ * @param result The products `a[n] * b[n]` (must not overlap with the inputs).
+ */
+inline void MultiplyMatrices4(const glm::mat4* const a[4], const glm::mat4* const b[4],
+                              glm::mat4* const result[4])
+{
+    __m128 ea[4][4], eb[4][4];
+    for (int column = 0; column < 4; column++)
+    {
+        LoadColumns(a, column, ea[column]);
+        LoadColumns(b, column, eb[column]);
+    }
+    
+    for (int column = 0; column < 4; column++)
+    {
+        // Element (column, row) of the four products
+        __m128 r[4];
+        for (int row = 0; row < 4; row++)
+        {
+            r[row] = _mm_mul_ps(ea[0][row], eb[column][0]);
+            r[row] = _mm_add_ps(r[row], _mm_mul_ps(ea[1][row], eb[column][1]));
+            r[row] = _mm_add_ps(r[row], _mm_mul_ps(ea[2][row], eb[column][2]));
+            r[row] = _mm_add_ps(r[row], _mm_mul_ps(ea[3][row], eb[column][3]));
+        }
+        
+        // Transpose back to store the column of each product
+        _MM_TRANSPOSE4_PS(r[0], r[1], r[2], r[3]);
+        for (int n = 0; n < 4; n++)
+            _mm_storeu_ps(&(*result[n])[column][0], r[n]);
+    }
+}
+#endif
+
+/**
+ * Compute the world matrices of a batch of nodes that belong to the same depth level.
+ *
+ * @param batch The sorted positions of the nodes.
+ * @param parents The sorted position of the parent of each node.
+ * @param local The local matrices.
+ * @param world The world matrices (the ones of the parents must already be up to date).
+ */
+void MultiplyBatch(const std::vector<unsigned int>& batch, const int* parents,
+                   const glm::mat4* local, glm::mat4* world)
+{
+    size_t i = 0;
+#ifdef TRANSFORM_HIERARCHY_SSE
+    // Four nodes at once (their parents belong to the previous level, so they are never written)
+    for (; i + 4 <= batch.size(); i += 4)
+    {
+        const glm::mat4* a[4];
+        const glm::mat4* b[4];
+        glm::mat4* result[4];
+        for (int n = 0; n < 4; n++)
+        {
+            a[n] = &world[parents[batch[i + n]]];
+            b[n] = &local[batch[i + n]];
+            result[n] = &world[batch[i + n]];
+        }
+        MultiplyMatrices4(a, b, result);
+    }
+#endif
+    for (; i < batch.size(); i++)
+        MultiplyMatrix(world[parents[batch[i]]], local[batch[i]], world[batch[i]]);
+}
+
+/**
+ * Compose a local matrix from its translation, rotation and scale (`T * R * S`).
+ *
+ * @param position The translation.
+ * @param rotation The rotation.
+ * @param scale The scale.
+ *
+ * @return The local matrix.
+ */
+inline glm::mat4 ComposeMatrix(const glm::vec3& position, const glm::quat& rotation,
+                               const glm::vec3& scale)
+{
+    glm::mat3 r = glm::mat3_cast(rotation);
+    
+    glm::mat4 matrix;
+    matrix[0] = glm::vec4(r[0] * scale.x, 0.0f);
+    matrix[1] = glm::vec4(r[1] * scale.y, 0.0f);
+    matrix[2] = glm::vec4(r[2] * scale.z, 0.0f);
+    matrix[3] = glm::vec4(position, 1.0f);
+    return matrix;
+}
+
+/**
+ * Decompose the rotation and scale of a transformation matrix (shear is not supported).
+ *
+ * An axis with a scale of zero has no direction: it is rebuilt from the two other axes, and the
+ * fallback rotation is kept if several axes are degenerate.
+ *
+ * @param matrix The transformation.
+ * @param fallback The rotation used if it cannot be extracted.
+ * @param scale The scale along each axis.
+ *
+ * @return The rotation.
+ */
+glm::quat ExtractRotation(const glm::mat4& matrix, const glm::quat& fallback, glm::vec3& scale)
+{
+    glm::vec3 axes[3] = { glm::vec3(matrix[0]), glm::vec3(matrix[1]), glm::vec3(matrix[2]) };
+    
+    int degenerate = -1, count = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        scale[i] = glm::length(axes[i]);
+        if (scale[i] < g_MinScale)
+        {
+            degenerate = i;
+            count++;
+        }
+        else
+            axes[i] /= scale[i];
+    }
+    
+    if (count > 1)
+        return fallback;
+    if (count == 1)
+    {
+        glm::vec3 axis = glm::cross(axes[(degenerate + 1) % 3], axes[(degenerate + 2) % 3]);
+        if (glm::length(axis) < g_MinScale)
+            return fallback;
+        axes[degenerate] = glm::normalize(axis);
+    }
+    return glm::normalize(glm::quat_cast(glm::mat3(axes[0], axes[1], axes[2])));
+}
+} // namespace
+
+/**
+ * Create a new node in the hierarchy.
+ *
+ * @param parent The parent node (`InvalidTransformNode` for a root node).
+ *
+ * @return The identifier of the new node.
+ */
+TransformNode TransformHierarchy::CreateNode(const TransformNode parent)
+{
+    CORE_ASSERT(parent == InvalidTransformNode || parent < GetNodeCount(),
+                "Trying to define a node with an unknown parent!");
+    
+    TransformNode node = (TransformNode)m_NodeToIndex.size();
+    unsigned int index = (unsigned int)m_IndexToNode.size();
+    
+    // A new node is stored after its parent, but the depth levels only remain contiguous if it is
+    // not shallower than the last node
+    unsigned int depth = parent == InvalidTransformNode ? 0 : m_Depth[m_NodeToIndex[parent]] + 1;
+    if (!m_Depth.empty() && depth < m_Depth.back())
+        m_NeedsSort = true;
+    else if (depth == m_LevelStart.size())
+        m_LevelStart.push_back(index);
+    m_Depth.push_back(depth);
+    
+    // Define the node with an identity transformation
+    m_Parent.push_back(parent == InvalidTransformNode ? -1 : (int)m_NodeToIndex[parent]);
+    m_Position.emplace_back(0.0f);
+    m_Rotation.emplace_back(1.0f, 0.0f, 0.0f, 0.0f);
+    m_Scale.emplace_back(1.0f);
+    m_Local.emplace_back(1.0f);
+    m_World.emplace_back(1.0f);
+    m_Dirty.push_back(true);
+    m_Changed.push_back(false);
+    
+    m_ParentNode.push_back(parent);
+    m_NodeToIndex.push_back(index);
+    m_IndexToNode.push_back(node);
+    return node;
+}
+
+/**
+ * Change the parent of a node.
+ *
+ * @param node The node identifier.
+ * @param parent The new parent node (`InvalidTransformNode` to make it a root node).
+ */
+void TransformHierarchy::SetParent(const TransformNode node, const TransformNode parent)
+{
+    CORE_ASSERT(node < GetNodeCount(), "Trying to modify an unknown node!");
+    CORE_ASSERT(parent == InvalidTransformNode || parent < GetNodeCount(),
+                "Trying to define a node with an unknown parent!");
+    
+    // Make sure the hierarchy does not contain cycles
+    for (TransformNode n = parent; n != InvalidTransformNode; n = m_ParentNode[n])
+    {
+        if (n == node)
+        {
+            CORE_WARN("Trying to define a node as a child of its own descendant!");
+            return;
+        }
+    }
+    
+    m_ParentNode[node] = parent;
+    m_Dirty[m_NodeToIndex[node]] = true;
+    m_NeedsSort = true;
+}
+
+/**
+ * Reserve memory for a number of nodes.
+ *
+ * @param count The number of nodes.
+ */
+void TransformHierarchy::Reserve(const unsigned int count)
+{
+    m_Parent.reserve(count);
+    m_Depth.reserve(count);
+    m_Position.reserve(count);
+    m_Rotation.reserve(count);
+    m_Scale.reserve(count);
+    m_Local.reserve(count);
+    m_World.reserve(count);
+    m_Dirty.reserve(count);
+    m_Changed.reserve(count);
+    m_ParentNode.reserve(count);
+    m_NodeToIndex.reserve(count);
+    m_IndexToNode.reserve(count);
+}
+
+/**
+ * Remove all the nodes of the hierarchy.
+ */
+void TransformHierarchy::Clear()
+{
+    m_Parent.clear();
+    m_Depth.clear();
+    m_LevelStart.clear();
+    m_Position.clear();
+    m_Rotation.clear();
+    m_Scale.clear();
+    m_Local.clear();
+    m_World.clear();
+    m_Dirty.clear();
+    m_Changed.clear();
+    m_ParentNode.clear();
+    m_NodeToIndex.clear();
+    m_IndexToNode.clear();
+    m_NeedsSort = false;
+}
+
+/**
+ * Change the local transformation of a node using a matrix.
+ *
+ * @param node The node identifier.
+ * @param matrix The transformation relative to its parent.
+ *
+ * @note The matrix is decomposed into translation, rotation and scale (shear is not supported).
+ * The previous rotation is kept if the matrix does not define one (e.g., a scale of zero).
+ */
+void TransformHierarchy::SetLocalMatrix(const TransformNode node, const glm::mat4& matrix)
+{
+    unsigned int index = m_NodeToIndex[node];
+    
+    m_Position[index] = glm::vec3(matrix[3]);
+    m_Rotation[index] = ExtractRotation(matrix, m_Rotation[index], m_Scale[index]);
+    m_Dirty[index] = true;
+}
+
+/**
+ * Get the rotation of a node in world space (updated by `Update()`).
+ *
+ * @param node The node identifier.
+ *
+ * @return The rotation from the node space to world space (identity if it cannot be defined).
+ */
+glm::quat TransformHierarchy::GetWorldRotation(const TransformNode node) const
+{
+    glm::vec3 scale;
+    return ExtractRotation(m_World[m_NodeToIndex[node]], glm::quat(1.0f, 0.0f, 0.0f, 0.0f), scale);
+}
+
+/**
+ * Update the local and world matrices of the nodes that have been modified.
+ *
+ * The nodes are processed one depth level at a time, so the world matrices of the parents are
+ * always up to date when a level is visited. The world matrices of the modified nodes of a level
+ * are then computed in batches (four nodes at once with SIMD instructions).
+ */
+void TransformHierarchy::Update()
+{
+    if (m_NeedsSort)
+        Sort();
+    
+    const unsigned int count = (unsigned int)m_IndexToNode.size();
+    const unsigned int levels = (unsigned int)m_LevelStart.size();
+    for (unsigned int level = 0; level < levels; level++)
+    {
+        const unsigned int begin = m_LevelStart[level];
+        const unsigned int end = level + 1 < levels ? m_LevelStart[level + 1] : count;
+        
+        // Propagate the changes and select the nodes of the level to be updated
+        m_Batch.clear();
+        for (unsigned int i = begin; i < end; i++)
+        {
+            const int parent = m_Parent[i];
+            const bool changed = m_Dirty[i] || (parent >= 0 && m_Changed[parent]);
+            m_Changed[i] = changed;
+            
+            if (!changed)
+                continue;
+            
+            // Recompose the local matrix only if its components have been modified
+            if (m_Dirty[i])
+            {
+                m_Local[i] = ComposeMatrix(m_Position[i], m_Rotation[i], m_Scale[i]);
+                m_Dirty[i] = false;
+            }
+            
+            if (parent < 0)
+                m_World[i] = m_Local[i];
+            else
+                m_Batch.push_back(i);
+        }
+        
+        MultiplyBatch(m_Batch, m_Parent.data(), m_Local.data(), m_World.data());
+    }
+}
+
+/**
+ * Sort the nodes by their depth in the hierarchy, so that parents are stored before their children.
+ */
+void TransformHierarchy::Sort()
+{
+    const unsigned int count = (unsigned int)m_NodeToIndex.size();
+    
+    // Compute the depth of each node (by identifier)
+    std::vector<unsigned int> depth(count, 0);
+    for (TransformNode node = 0; node < count; node++)
+    {
+        for (TransformNode n = m_ParentNode[node]; n != InvalidTransformNode; n = m_ParentNode[n])
+            depth[node]++;
+    }
+    
+    // Define the new order (stable, to keep siblings close in memory)
+    std::vector<TransformNode> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](TransformNode a, TransformNode b)
+    {
+        return depth[a] < depth[b];
+    });
+    
+    // Reorder the arrays
+    auto reorder = [&](auto& data)
+    {
+        std::remove_reference_t<decltype(data)> sorted;
+        sorted.reserve(count);
+        for (TransformNode node : order)
+            sorted.push_back(data[m_NodeToIndex[node]]);
+        data.swap(sorted);
+    };
+    reorder(m_Position);
+    reorder(m_Rotation);
+    reorder(m_Scale);
+    reorder(m_Local);
+    reorder(m_World);
+    reorder(m_Dirty);
+    reorder(m_Changed);
+    
+    for (unsigned int i = 0; i < count; i++)
+    {
+        m_IndexToNode[i] = order[i];
+        m_NodeToIndex[order[i]] = i;
+    }
+    
+    // Update the parent indices to the new order
+    for (unsigned int i = 0; i < count; i++)
+    {
+        TransformNode parent = m_ParentNode[m_IndexToNode[i]];
+        m_Parent[i] = parent == InvalidTransformNode ? -1 : (int)m_NodeToIndex[parent];
+    }
+    
+    // Define the depth levels
+    m_LevelStart.clear();
+    for (unsigned int i = 0; i < count; i++)
+    {
+        m_Depth[i] = depth[m_IndexToNode[i]];
+        if (m_Depth[i] == m_LevelStart.size())
+            m_LevelStart.push_back(i);
+    }
+    
+    m_NeedsSort = false;
+}
@@ -13,9 +13,16 @@
 OpenGLShader::OpenGLShader(const std::string& name, const std::filesystem::path& filePath)
     : Shader(name, filePath)
 {
+    PROFILE_FUNCTION();
+    
     OpenGLShaderSource source = ParseShader(filePath);
-    m_ID = CreateShader(source.VertexSource, source.FragmentSource,
-                        source.GeometrySource);
+    
+    // A compute program is linked on its own, without any other stage
+    if (!source.ComputeSource.empty())
+        m_ID = CreateComputeShader(source.ComputeSource);
+    else
+        m_ID = CreateShader(source.VertexSource, source.FragmentSource,
+                            source.GeometrySource);
 }
 
 /**
@@ -61,13 +68,15 @@ void OpenGLShader::Unbind() const
 int OpenGLShader::GetUniformLocation(const std::string& name)
 {
     // Verify that the location of the uniform is not cached
-    if (m_UniformBuffer.find(name) != m_UniformBuffer.end())
-        return m_UniformBuffer[name];
+    auto it = m_UniformBuffer.find(name);
+    if (it != m_UniformBuffer.end())
+        return it->second;
     
-    // Retrieve the location of the uniform and cache it too
+    // Retrieve the location of the uniform and cache it too (a missing uniform is only
+    // reported the first time, since its location is cached as well)
     int location = glGetUniformLocation(m_ID, name.c_str());
     if (location == -1)
-        CORE_WARN("Uniform " + name + " doesn't exist!");
+        CORE_WARN("Uniform {0} doesn't exist!", name);
     
     m_UniformBuffer[name] = location;
     return location;
@@ -182,6 +191,8 @@ void OpenGLShader::SetMat4(const std::string& name, const glm::mat4& value)
  */
 unsigned int OpenGLShader::CompileShader(unsigned int type, const std::string& source)
 {
+    PROFILE_FUNCTION();
+    
     // Define the shader from the input source and compile
     unsigned int id = glCreateShader(type);
     const char* src = source.c_str();
@@ -207,6 +218,9 @@ unsigned int OpenGLShader::CompileShader(unsigned int type, const std::string& s
         case GL_GEOMETRY_SHADER:
             shaderType = "geometry";
             break;
+        case GL_COMPUTE_SHADER:
+            shaderType = "compute";
+            break;
         default:
             shaderType = "unknown";
             break;
@@ -246,7 +260,7 @@ unsigned int OpenGLShader::CreateShader(const std::string& vertexShader,
     unsigned int gs = 0;
     if (!geometryShader.empty())
     {
-        unsigned int gs = CompileShader(GL_GEOMETRY_SHADER, geometryShader);
+        gs = CompileShader(GL_GEOMETRY_SHADER, geometryShader);
         glAttachShader(program, gs);
     }
     
@@ -264,12 +278,42 @@ unsigned int OpenGLShader::CreateShader(const std::string& vertexShader,
     return program;
 }
 
+/**
+ * Generate a compute shader program from its source.
+ *
+ * @param computeShader Source of the compute shader.
+ *
+ * @return ID of the shader program.
+ */
+unsigned int OpenGLShader::CreateComputeShader(const std::string& computeShader)
+{
+    // Verify that compute shaders are supported by the current context
+    CORE_ASSERT(GLEW_ARB_compute_shader, "Compute shaders are not supported by the OpenGL context!");
+    
+    // Define a shader program
+    unsigned int program = glCreateProgram();
+    
+    // Compute shader
+    unsigned int cs = CompileShader(GL_COMPUTE_SHADER, computeShader);
+    glAttachShader(program, cs);
+    
+    // Link shader
+    glLinkProgram(program);
+    glValidateProgram(program);
+    
+    // De-allocate the shader resources
+    glDeleteShader(cs);
+    
+    // Return the shader program
+    return program;
+}
+
 /**
  * Parse shader input file.
  *
  * @param filepath Path to the shader file.
  *
- * @return The vertex and fragment program source.
+ * @return The vertex, fragment, geometry and compute program source.
  */
 OpenGLShader::OpenGLShaderSource OpenGLShader::ParseShader(const std::filesystem::path& filepath)
 {
@@ -279,12 +323,12 @@ OpenGLShader::OpenGLShaderSource OpenGLShader::ParseShader(const std::filesystem
     // Define the different shader classes available
     enum class ShaderType
     {
-        NONE = -1, VERTEX = 0, FRAGMENT = 1, GEOMETRY = 2
+        NONE = -1, VERTEX = 0, FRAGMENT = 1, GEOMETRY = 2, COMPUTE = 3
     };
     
     // Parse the file
     std::string line;
-    std::stringstream ss[3];
+    std::stringstream ss[4];
     ShaderType type = ShaderType::NONE;
     while (getline(stream, line))
     {
@@ -296,9 +340,12 @@ OpenGLShader::OpenGLShaderSource OpenGLShader::ParseShader(const std::filesystem
             // Set mode to fragment
             else if (line.find("fragment") != std::string::npos)
                 type = ShaderType::FRAGMENT;
-            // Set mode to fragment
+            // Set mode to geometry
             else if (line.find("geometry") != std::string::npos)
                 type = ShaderType::GEOMETRY;
+            // Set mode to compute
+            else if (line.find("compute") != std::string::npos)
+                type = ShaderType::COMPUTE;
         }
         else
         {
@@ -316,5 +363,5 @@ OpenGLShader::OpenGLShaderSource OpenGLShader::ParseShader(const std::filesystem
     }
     
     // Return the shader sources
-    return OpenGLShaderSource(ss[0].str(), ss[1].str(), ss[2].str());
+    return OpenGLShaderSource(ss[0].str(), ss[1].str(), ss[2].str(), ss[3].str());
 }
@@ -21,4 +21,8 @@ int main()
     // Create the application
     auto application = std::make_unique<ViewerApp>("3D Viewer", 800, 600);
     application->Run();
+    
+    // Write the remaining messages once the application is destroyed
+    application.reset();
+    Log::Shutdown();
 }
@@ -28,9 +28,6 @@ void Viewer::OnUpdate(Timestep ts)
     // Reset rendering statistics
     Renderer::ResetStats();
     
-    // Get the models in the scene
-    auto models = m_Scene->GetModels();
-    
     m_Scene->Draw();
     
     // Update the camera
@@ -67,13 +64,18 @@ void Viewer::InitializeViewer()
                                                         glm::vec3(1.0f), glm::vec3(3.0f, 5.0f, 0.0f));
     positional->SetDiffuseStrength(0.6f);
     positional->SetSpecularStrength(0.4f);
-    m_Scene->GetLightSouces().Add("Positional", positional);
+    m_Scene->AddLight("Positional", positional);
+    
+    // The positional light renders its shadows in all the directions around it
+    positional->EnableShadowCube(1024);
     
     auto directional = std::make_shared<DirectionalLight>(viewportWidth, viewportHeight,
                                                           glm::vec3(1.0f), glm::vec3(0.0f, 0.0f, -1.0f));
     directional->SetDiffuseStrength(0.6f);
     directional->SetSpecularStrength(0.4f);
-    m_Scene->GetLightSouces().Add("Directional", directional);
+    directional->EnableCascades(4, 2048);
+    directional->SetShadowFilter(ShadowFilter::RotatedDisk);
+    m_Scene->AddLight("Directional", directional);
     
     // Update the position of the rendering camera
     m_Scene->GetCamera()->SetPosition(glm::vec3(0.0f, 0.0f, 10.0f));
@@ -117,13 +119,16 @@ void Viewer::DefineSceneGeometry()
     // Define the cube and plane model
     auto cube = utils::Geometry::ModelCube<GeoVertexData<glm::vec4, glm::vec2, glm::vec3>>();
     cube->SetScale(glm::vec3(2.0f));
-    m_Scene->GetModels().Add("Cube", cube);
+    m_Scene->AddModel("Cube", cube);
     
     auto plane = utils::Geometry::ModelPlane<GeoVertexData<glm::vec4, glm::vec3>>();
     plane->SetPosition(glm::vec3(0.0f, -1.5f, 0.0f));
     plane->SetScale(glm::vec3(10.0f));
     plane->SetRotation(glm::vec3(-90.0f, 0.0f, 0.0f));
-    m_Scene->GetModels().Add("Plane", plane);
+    Entity entity = m_Scene->AddModel("Plane", plane);
+    
+    // The plane never moves (its shadows are kept in the cached layer of the shadow maps)
+    m_Scene->GetRegistry().Get<RenderableComponent>(entity).Static = true;
 }
 
 /**
@@ -142,19 +147,85 @@ void Viewer::DefineRenderPasses()
         if (!light)
             continue;
         
+        // Lights in the shadow atlas are rendered together (see below)
+        auto& atlas = lights.GetShadowAtlas();
+        if (atlas && light->GetFramebuffer() == atlas->GetFramebuffer())
+            continue;
+        
+        // Lights with shadow cascades render all of them at once
+        std::string depth = "Depth";
+        std::shared_ptr<GPUCulling> culling = std::make_shared<GPUCulling>();
+        auto directional = std::dynamic_pointer_cast<DirectionalLight>(light);
+        if (directional && directional->GetCascades())
+        {
+            depth = "Depth-" + pair.first;
+            Renderer::GetMaterialLibrary().Create<CascadeDepthMaterial>(depth, directional->GetCascades());
+            culling = std::make_shared<GPUCulling>(std::make_shared<CascadeDepthMaterial>(
+                directional->GetCascades(), "Resources/shaders/culling/DepthMapIndirectCascades.glsl"));
+        }
+        
+        // Lights with a shadow cube render all of its faces at once (the faces are culled in the
+        // geometry shader, since the shadow camera only covers one of them)
+        std::shared_ptr<Camera> camera = light->GetShadowCamera();
+        auto positional = std::dynamic_pointer_cast<PositionalLight>(light);
+        if (positional && positional->GetShadowCube())
+        {
+            depth = "Depth-" + pair.first;
+            Renderer::GetMaterialLibrary().Create<CubeDepthMaterial>(depth, positional->GetShadowCube());
+            culling = nullptr;
+            camera = nullptr;
+        }
+        
+        // Lights with shadow moments render the moments of the depth (the culling stage only renders
+        // the depth), and the scene clears the empty texels with the moments of the far plane
+        if (auto moments = light->GetShadowMoments())
+        {
+            depth = "Depth-" + pair.first;
+            Renderer::GetMaterialLibrary().Create<MomentsDepthMaterial>(depth, moments);
+            culling = nullptr;
+        }
+        
         RenderPassSpecification shadowPassSpec;
-        shadowPassSpec.Camera = light->GetShadowCamera();
+        shadowPassSpec.Camera = camera;
         shadowPassSpec.Framebuffer = light->GetFramebuffer();
         shadowPassSpec.Models = {
-            { "Cube", "Depth"},
-            { "Plane", "Depth" },
+            { "Cube", depth },
+            { "Plane", depth },
         };
+        shadowPassSpec.Culling = culling;
+        shadowPassSpec.Cached = true;
         shadowPassSpec.PreRenderCode = []() { Renderer::SetFaceCulling(FaceCulling::Front); };
         shadowPassSpec.PostRenderCode = []() { Renderer::SetFaceCulling(FaceCulling::Back); };
         
         library.Add("Shadow-" + pair.first, shadowPassSpec);
     }
     
+    // The lights in the shadow atlas are rendered at once
+    if (auto atlas = lights.GetShadowAtlas())
+    {
+        Renderer::GetMaterialLibrary().Create<AtlasDepthMaterial>("Depth-Atlas", atlas);
+        
+        RenderPassSpecification atlasPassSpec;
+        atlasPassSpec.Framebuffer = atlas->GetFramebuffer();
+        atlasPassSpec.Models = {
+            { "Cube", "Depth-Atlas" },
+            { "Plane", "Depth-Atlas" },
+        };
+        atlasPassSpec.Cached = true;
+        atlasPassSpec.PreRenderCode = []()
+        {
+            Renderer::SetFaceCulling(FaceCulling::Front);
+            Renderer::SetClipDistances(4);
+        };
+        atlasPassSpec.PostRenderCode = []()
+        {
+            Renderer::SetFaceCulling(FaceCulling::Back);
+            Renderer::SetClipDistances(0);
+        };
+        
+        library.Add("Shadow-Atlas", atlasPassSpec);
+    }
+    
     // Second pass: scene
     //--------------------------------
     RenderPassSpecification scenePassSpec;
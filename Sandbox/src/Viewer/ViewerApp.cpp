@@ -10,6 +10,9 @@
 ViewerApp::ViewerApp(const std::string &name, const int width, const int height)
     : Application(name, width, height)
 {
+    // Only render the viewer again when something changes
+    FrameScheduler::SetOnDemand(true);
+    
     // Push the viewer layer to the layer stack
     m_Viewer = std::make_shared<Viewer>(GetWindow().GetWidth(), GetWindow().GetHeight());
     m_Gui = std::make_shared<ViewerGui>(m_Viewer);
@@ -11,6 +11,13 @@ struct Light {
     float Ls;               ///< Specular light intensity.
     
     mat4 Transform;         ///< Light matrix for transforming vertices to light space.
+    vec4 ShadowTile;        ///< Rectangle of the shadow atlas with the shadow map (zero if not in an atlas).
+    float ShadowFar;        ///< Far distance of the omnidirectional shadow map (zero if not used).
+    int ShadowFilter;       ///< Filter of the shadow edges (see `ShadowFilter.glsl`).
+    vec4 ShadowMoments;     ///< Exponents (xy) and light bleeding reduction (z) of the moments shadow
+                            ///< map (w = 1 if used, zero otherwise).
     
-    sampler2D ShadowMap;    ///< Shadow map texture for shadow calculations.
+    sampler2DShadow ShadowMap;      ///< Shadow map texture for shadow calculations.
+    samplerCubeShadow ShadowCube;   ///< Omnidirectional shadow map (linear distances to the light).
+    sampler2D MomentsMap;           ///< Prefiltered moments of the warped depth (EVSM).
 };
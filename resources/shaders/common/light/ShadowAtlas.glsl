@@ -0,0 +1,25 @@
+#define MAX_NUMBER_TILES 4
+
+/**
+ * Represents the tiles of a shadow atlas (one per light).
+ */
+struct Atlas {
+    int Count;                              ///< Number of tiles.
+    mat4 Transform[MAX_NUMBER_TILES];       ///< Light matrices for transforming vertices to light space.
+    vec4 Tile[MAX_NUMBER_TILES];            ///< Offset (xy) and size (zw) of each tile in texture coordinates.
+};
+
+/**
+ * Maps a position from the clip space of a light into its tile of the atlas.
+ *
+ * @param position The position in the clip space of the light.
+ * @param tile The offset (xy) and size (zw) of the tile in texture coordinates.
+ *
+ * @return The position in the clip space of the atlas.
+ */
+vec4 toAtlas(vec4 position, vec4 tile)
+{
+    // ndc' = ndc * size + (2 * offset + size - 1), written before the perspective divide
+    vec2 xy = position.xy * tile.zw + (2.0f * tile.xy + tile.zw - 1.0f) * position.w;
+    return vec4(xy, position.zw);
+}
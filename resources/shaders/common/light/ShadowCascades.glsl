@@ -0,0 +1,17 @@
+#define MAX_NUMBER_CASCADES 4
+
+/**
+ * Represents the shadow cascades of a directional light.
+ */
+struct Cascades {
+    int Count;                              ///< Number of cascades (0 if no light has cascades).
+    int Light;                              ///< Index of the light casting the shadows.
+    
+    vec4 Splits;                            ///< Far distance (view depth) of each cascade.
+    float BlendRange;                       ///< Fraction of each cascade blended with the next one.
+    
+    mat4 View;                              ///< View matrix of the camera the cascades are fitted to.
+    mat4 Transform[MAX_NUMBER_CASCADES];    ///< Light matrices for transforming vertices to each cascade.
+    
+    sampler2DArrayShadow ShadowMap;         ///< Shadow map texture array (one layer per cascade).
+};
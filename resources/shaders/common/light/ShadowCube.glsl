@@ -0,0 +1,8 @@
+/**
+ * Represents the faces of the omnidirectional shadow map of a positional light.
+ */
+struct Cube {
+    vec3 Position;                          ///< Position of the light in world space.
+    float Far;                              ///< Far distance of the shadows (normalizes the distances).
+    mat4 Transform[6];                      ///< Light matrices for transforming vertices to each face.
+};
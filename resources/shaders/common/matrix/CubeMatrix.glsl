@@ -0,0 +1,6 @@
+/**
+ * Represents the transformation matrices of the faces of a cube map.
+ */
+struct CubeTransform {
+    mat4 ViewProjection[6];     ///< View-projection matrix of each face (+X, -X, +Y, -Y, +Z, -Z).
+};
@@ -0,0 +1,32 @@
+#shader vertex
+#version 430 core
+
+// Include the objects definition
+#include "Resources/shaders/culling/chunks/CullingData.glsl"
+
+// Include transformation matrices
+#include "Resources/shaders/common/matrix/SimpleMatrix.glsl"
+
+// Input vertex attribute: Position of the vertex in object space
+layout (location = 0) in vec4 a_Position;
+// Input instance attribute: Index of the object being drawn
+layout (location = 1) in uint a_ObjectIndex;
+
+// Uniform buffer block containing transformation matrices
+uniform Transform u_Transform;
+
+// Entry point of the vertex shader
+void main()
+{
+    // Calculate the final position of the vertex in clip space using
+    // the model matrix of the object being drawn
+    mat4 model = u_Objects[a_ObjectIndex].Model;
+    gl_Position = u_Transform.Projection * u_Transform.View * model * a_Position;
+}
+
+#shader fragment
+#version 430 core
+
+// Entry point of the fragment shader
+void main()
+{}
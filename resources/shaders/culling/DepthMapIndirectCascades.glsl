@@ -0,0 +1,52 @@
+#shader vertex
+#version 430 core
+
+// Include the objects definition
+#include "Resources/shaders/culling/chunks/CullingData.glsl"
+
+// Input vertex attribute: Position of the vertex in object space
+layout (location = 0) in vec4 a_Position;
+// Input instance attribute: Index of the object being drawn
+layout (location = 1) in uint a_ObjectIndex;
+
+// Entry point of the vertex shader
+void main()
+{
+    // Pass the position in world space using the model matrix of the object being drawn
+    // (projected by the geometry shader into each cascade)
+    gl_Position = u_Objects[a_ObjectIndex].Model * a_Position;
+}
+
+#shader geometry
+#version 430 core
+
+// Include the shadow cascades
+#include "Resources/shaders/common/light/ShadowCascades.glsl"
+
+// Replicate each triangle in every cascade
+layout (triangles) in;
+layout (triangle_strip, max_vertices = 12) out;
+
+uniform Cascades u_Cascades;
+
+// Entry point of the geometry shader
+void main()
+{
+    for (int c = 0; c < u_Cascades.Count; c++)
+    {
+        for (int v = 0; v < 3; v++)
+        {
+            gl_Layer = c;
+            gl_Position = u_Cascades.Transform[c] * gl_in[v].gl_Position;
+            EmitVertex();
+        }
+        EndPrimitive();
+    }
+}
+
+#shader fragment
+#version 430 core
+
+// Entry point of the fragment shader
+void main()
+{}
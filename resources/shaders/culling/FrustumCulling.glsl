@@ -0,0 +1,77 @@
+#shader compute
+#version 430 core
+
+// Include the objects and draw commands definition
+#include "Resources/shaders/culling/chunks/CullingData.glsl"
+
+// Include the visibility tests
+#include "Resources/shaders/culling/chunks/FrustumTest.glsl"
+#include "Resources/shaders/culling/chunks/OcclusionTest.glsl"
+
+// Number of objects tested by each work group
+layout (local_size_x = 64) in;
+
+// Shader storage buffer with the compacted draw commands
+layout (std430, binding = 1) writeonly buffer Commands {
+    DrawCommand u_Commands[];
+};
+// Shader storage buffer with the object index of each visible draw
+layout (std430, binding = 2) writeonly buffer Instances {
+    uint u_Instances[];
+};
+// Shader storage buffer with the number of visible draws
+layout (std430, binding = 3) buffer Parameters {
+    uint u_DrawCount;
+};
+
+/**
+ * Represents the parameters of the culling stage.
+ */
+struct Culling {
+    mat4 ViewProjection;    ///< View-projection matrix defining the frustum.
+    int ObjectCount;        ///< Number of objects to be tested.
+    bool Occlusion;         ///< Enables the occlusion (Hi-Z) test.
+};
+
+// Uniform block containing the culling parameters
+uniform Culling u_Culling;
+// Hierarchical depth map used for the occlusion test
+uniform sampler2D u_OcclusionMap;
+
+// Entry point of the compute shader
+void main()
+{
+    // Verify that the invocation corresponds to an object
+    uint index = gl_GlobalInvocationID.x;
+    if (index >= uint(u_Culling.ObjectCount))
+        return;
+    
+    Object object = u_Objects[index];
+    
+    // Skip the disabled objects (e.g., hidden models)
+    if (object.Draw.w == 0u)
+        return;
+    
+    // Test the visibility of the object
+    bool visible = isInsideFrustum(u_Culling.ViewProjection, object.Model,
+                                   object.BBoxMin.xyz, object.BBoxMax.xyz);
+    if (visible && u_Culling.Occlusion)
+        visible = isVisibleInDepth(u_OcclusionMap, u_Culling.ViewProjection, object.Model,
+                                   object.BBoxMin.xyz, object.BBoxMax.xyz);
+    
+    if (!visible)
+        return;
+    
+    // Write the draw command into the next available slot
+    uint slot = atomicAdd(u_DrawCount, 1u);
+    
+    DrawCommand command;
+    command.Count = object.Draw.x;
+    command.InstanceCount = 1u;
+    command.FirstIndex = object.Draw.y;
+    command.BaseVertex = int(object.Draw.z);
+    command.BaseInstance = slot;
+    
+    u_Commands[slot] = command;
+    u_Instances[slot] = index;
+}
@@ -0,0 +1,26 @@
+/**
+ * Represents the information of an object that can be culled on the GPU.
+ */
+struct Object {
+    mat4 Model;         ///< Model matrix for transforming object vertices to world space.
+    vec4 BBoxMin;       ///< Minimum coordinates of the bounding box (in model space).
+    vec4 BBoxMax;       ///< Maximum coordinates of the bounding box (in model space).
+    uvec4 Draw;         ///< Draw range of the object (index count, first index, base vertex) and
+                        ///< its state (enabled if not zero).
+};
+
+/**
+ * Represents an indirect draw command for indexed geometry.
+ */
+struct DrawCommand {
+    uint Count;         ///< Number of indices to be drawn.
+    uint InstanceCount; ///< Number of instances to be drawn.
+    uint FirstIndex;    ///< Offset of the first index.
+    int BaseVertex;     ///< Offset added to each index.
+    uint BaseInstance;  ///< Offset of the first instance (slot of the instance data).
+};
+
+// Shader storage buffer containing all the objects that can be drawn
+layout (std430, binding = 0) readonly buffer Objects {
+    Object u_Objects[];
+};
@@ -0,0 +1,41 @@
+/**
+ * Checks if an axis-aligned bounding box intersects the view frustum.
+ *
+ * The bounding box is transformed into world space (as another axis-aligned box) and tested
+ * against the six frustum planes extracted from the view-projection matrix.
+ *
+ * @param viewProjection The view-projection matrix defining the frustum.
+ * @param model The model matrix of the object.
+ * @param bboxMin The minimum coordinates of the bounding box (in model space).
+ * @param bboxMax The maximum coordinates of the bounding box (in model space).
+ *
+ * @return `true` if the bounding box is (partially) inside the frustum.
+ */
+bool isInsideFrustum(mat4 viewProjection, mat4 model, vec3 bboxMin, vec3 bboxMax)
+{
+    // Define the bounding box in world space
+    vec3 center = vec3(model * vec4((bboxMin + bboxMax) * 0.5, 1.0));
+    vec3 extent = (bboxMax - bboxMin) * 0.5;
+    mat3 absolute = mat3(abs(model[0].xyz), abs(model[1].xyz), abs(model[2].xyz));
+    extent = absolute * extent;
+    
+    // Get the rows of the view-projection matrix
+    vec4 row0 = vec4(viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]);
+    vec4 row1 = vec4(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]);
+    vec4 row2 = vec4(viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]);
+    vec4 row3 = vec4(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+    
+    // Define the frustum planes (left, right, bottom, top, near, far)
+    vec4 planes[6] = vec4[6](row3 + row0, row3 - row0, row3 + row1,
+                             row3 - row1, row3 + row2, row3 - row2);
+    
+    // Check the box against each of the planes
+    for (int i = 0; i < 6; i++)
+    {
+        float distance = dot(planes[i].xyz, center) + planes[i].w;
+        float radius = dot(abs(planes[i].xyz), extent);
+        if (distance + radius < 0.0)
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,55 @@
+/**
+ * Checks if an axis-aligned bounding box is (potentially) visible using a hierarchical depth map.
+ *
+ * The hierarchical depth map (Hi-Z) is expected to store in each mip level the farthest depth
+ * value of the texels it covers. The screen-space rectangle of the box selects the level where
+ * four texels are enough to cover it.
+ *
+ * @param occlusionMap The hierarchical depth map.
+ * @param viewProjection The view-projection matrix used to generate the depth map.
+ * @param model The model matrix of the object.
+ * @param bboxMin The minimum coordinates of the bounding box (in model space).
+ * @param bboxMax The maximum coordinates of the bounding box (in model space).
+ *
+ * @return `true` if the bounding box is not hidden behind the depth map.
+ */
+bool isVisibleInDepth(sampler2D occlusionMap, mat4 viewProjection, mat4 model,
+                      vec3 bboxMin, vec3 bboxMax)
+{
+    // Project the corners of the bounding box into normalized device coordinates
+    mat4 transform = viewProjection * model;
+    vec3 ndcMin = vec3(1.0);
+    vec3 ndcMax = vec3(-1.0);
+    for (int i = 0; i < 8; i++)
+    {
+        vec3 corner = vec3((i & 1) != 0 ? bboxMax.x : bboxMin.x,
+                           (i & 2) != 0 ? bboxMax.y : bboxMin.y,
+                           (i & 4) != 0 ? bboxMax.z : bboxMin.z);
+        vec4 clip = transform * vec4(corner, 1.0);
+        
+        // The box crosses the near plane, it is considered visible
+        if (clip.w <= 0.0)
+            return true;
+        
+        vec3 ndc = clip.xyz / clip.w;
+        ndcMin = min(ndcMin, ndc);
+        ndcMax = max(ndcMax, ndc);
+    }
+    
+    // Define the screen-space rectangle and the closest depth of the box
+    vec2 uvMin = clamp(ndcMin.xy * 0.5 + 0.5, 0.0, 1.0);
+    vec2 uvMax = clamp(ndcMax.xy * 0.5 + 0.5, 0.0, 1.0);
+    float closest = ndcMin.z * 0.5 + 0.5;
+    
+    // Select the mip level where the rectangle covers (at most) 2x2 texels
+    vec2 size = (uvMax - uvMin) * vec2(textureSize(occlusionMap, 0));
+    float level = ceil(log2(max(max(size.x, size.y), 1.0)));
+    
+    // Get the farthest depth stored under the rectangle
+    float depth = max(max(textureLod(occlusionMap, uvMin, level).r,
+                          textureLod(occlusionMap, vec2(uvMax.x, uvMin.y), level).r),
+                      max(textureLod(occlusionMap, vec2(uvMin.x, uvMax.y), level).r,
+                          textureLod(occlusionMap, uvMax, level).r));
+    
+    return closest <= depth;
+}
@@ -0,0 +1,63 @@
+#shader vertex
+#version 330 core
+
+// Include transformation matrices
+#include "Resources/shaders/common/matrix/SimpleMatrix.glsl"
+
+// Input vertex attribute: Position of the vertex in object space
+layout (location = 0) in vec4 a_Position;
+
+// Uniform buffer block containing transformation matrices
+uniform Transform u_Transform;
+
+// Entry point of the vertex shader
+void main()
+{
+    // Pass the position in world space (projected by the geometry shader into each tile)
+    gl_Position = u_Transform.Model * a_Position;
+}
+
+#shader geometry
+#version 330 core
+
+// Include the shadow atlas
+#include "Resources/shaders/common/light/ShadowAtlas.glsl"
+
+// Replicate each triangle in every tile
+layout (triangles) in;
+layout (triangle_strip, max_vertices = 12) out;
+
+uniform Atlas u_Atlas;
+// Tiles of the lights the model casts shadows for (one bit per tile)
+uniform int u_TileMask;
+
+// Entry point of the geometry shader
+void main()
+{
+    for (int t = 0; t < u_Atlas.Count; t++)
+    {
+        if ((u_TileMask & (1 << t)) == 0)
+            continue;
+        
+        for (int v = 0; v < 3; v++)
+        {
+            vec4 position = u_Atlas.Transform[t] * gl_in[v].gl_Position;
+            gl_Position = toAtlas(position, u_Atlas.Tile[t]);
+            
+            // Clip the primitive to the tile (the frustum of its light)
+            gl_ClipDistance[0] = position.w + position.x;
+            gl_ClipDistance[1] = position.w - position.x;
+            gl_ClipDistance[2] = position.w + position.y;
+            gl_ClipDistance[3] = position.w - position.y;
+            EmitVertex();
+        }
+        EndPrimitive();
+    }
+}
+
+#shader fragment
+#version 330 core
+
+// Entry point of the fragment shader
+void main()
+{}
@@ -0,0 +1,52 @@
+#shader vertex
+#version 330 core
+
+// Include transformation matrices
+#include "Resources/shaders/common/matrix/SimpleMatrix.glsl"
+
+// Input vertex attribute: Position of the vertex in object space
+layout (location = 0) in vec4 a_Position;
+
+// Uniform buffer block containing transformation matrices
+uniform Transform u_Transform;
+
+// Entry point of the vertex shader
+void main()
+{
+    // Pass the position in world space (projected by the geometry shader into each cascade)
+    gl_Position = u_Transform.Model * a_Position;
+}
+
+#shader geometry
+#version 330 core
+
+// Include the shadow cascades
+#include "Resources/shaders/common/light/ShadowCascades.glsl"
+
+// Replicate each triangle in every cascade
+layout (triangles) in;
+layout (triangle_strip, max_vertices = 12) out;
+
+uniform Cascades u_Cascades;
+
+// Entry point of the geometry shader
+void main()
+{
+    for (int c = 0; c < u_Cascades.Count; c++)
+    {
+        for (int v = 0; v < 3; v++)
+        {
+            gl_Layer = c;
+            gl_Position = u_Cascades.Transform[c] * gl_in[v].gl_Position;
+            EmitVertex();
+        }
+        EndPrimitive();
+    }
+}
+
+#shader fragment
+#version 330 core
+
+// Entry point of the fragment shader
+void main()
+{}
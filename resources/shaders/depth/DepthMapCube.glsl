@@ -0,0 +1,83 @@
+#shader vertex
+#version 330 core
+
+// Include transformation matrices
+#include "Resources/shaders/common/matrix/SimpleMatrix.glsl"
+
+// Input vertex attribute: Position of the vertex in object space
+layout (location = 0) in vec4 a_Position;
+
+// Uniform buffer block containing transformation matrices
+uniform Transform u_Transform;
+
+// Entry point of the vertex shader
+void main()
+{
+    // Pass the position in world space (projected by the geometry shader into each face)
+    gl_Position = u_Transform.Model * a_Position;
+}
+
+#shader geometry
+#version 330 core
+
+// Include the shadow cube
+#include "Resources/shaders/common/light/ShadowCube.glsl"
+
+// Replicate each triangle in every face it covers
+layout (triangles) in;
+layout (triangle_strip, max_vertices = 18) out;
+
+uniform Cube u_Cube;
+
+// Output to the fragment shader: Position of the vertex in world space
+out vec3 g_Position;
+
+// Entry point of the geometry shader
+void main()
+{
+    for (int face = 0; face < 6; face++)
+    {
+        // Count the vertices outside of each side plane of the face frustum (and behind the light)
+        vec4 position[3];
+        ivec4 outside = ivec4(0);
+        int behind = 0;
+        for (int v = 0; v < 3; v++)
+        {
+            position[v] = u_Cube.Transform[face] * gl_in[v].gl_Position;
+            outside += ivec4(lessThan(position[v].xy, -position[v].ww),
+                             greaterThan(position[v].xy, position[v].ww));
+            behind += position[v].w <= 0.0f ? 1 : 0;
+        }
+        
+        // Cull the triangle if all its vertices are outside of the same plane
+        if (any(equal(outside, ivec4(3))) || behind == 3)
+            continue;
+        
+        for (int v = 0; v < 3; v++)
+        {
+            gl_Layer = face;
+            gl_Position = position[v];
+            g_Position = gl_in[v].gl_Position.xyz;
+            EmitVertex();
+        }
+        EndPrimitive();
+    }
+}
+
+#shader fragment
+#version 330 core
+
+// Include the shadow cube
+#include "Resources/shaders/common/light/ShadowCube.glsl"
+
+// Input from the geometry shader: Position of the fragment in world space
+in vec3 g_Position;
+
+uniform Cube u_Cube;
+
+// Entry point of the fragment shader
+void main()
+{
+    // Store the linear distance to the light (normalized by the far distance of the shadows)
+    gl_FragDepth = length(g_Position - u_Cube.Position) / u_Cube.Far;
+}
@@ -0,0 +1,26 @@
+#shader vertex
+#version 330 core
+
+// Include transformation matrices
+#include "Resources/shaders/common/matrix/SimpleMatrix.glsl"
+
+// Include vertex shader
+#include "Resources/shaders/common/vertex/P.vs.glsl"
+
+#shader fragment
+#version 330 core
+
+// Include the depth warp
+#include "Resources/shaders/depth/chunks/ShadowMoments.glsl"
+
+// Moments of the warped depth
+layout (location = 0) out vec4 outMoments;
+
+uniform vec2 u_Exponents;       // Positive (x) and negative (y) exponents of the depth warp
+
+// Entry point of the fragment shader
+void main()
+{
+    vec2 depth = warpDepth(gl_FragCoord.z, u_Exponents);
+    outMoments = vec4(depth.x, depth.x * depth.x, depth.y, depth.y * depth.y);
+}
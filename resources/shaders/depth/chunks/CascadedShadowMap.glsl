@@ -0,0 +1,97 @@
+/**
+ * Percentage Closer Filtering (PCF) on a layer of a shadow map texture array.
+ *
+ * @param shadowMap The sampler2DArrayShadow texture of the shadow map (compared in hardware).
+ * @param projectionCoord The shadow map coordinates of the fragment.
+ * @param layer The layer of the shadow map.
+ * @param filterType The shadow filter defining the samples of the kernel.
+ * @param kernelSize The size of the PCF kernel.
+ * @param opacity Opacity value.
+ *
+ * @return The shadow value for the fragment.
+ */
+float PCFLayer(sampler2DArrayShadow shadowMap, vec3 projectionCoord, float layer, int filterType,
+               int kernelSize, float opacity)
+{
+    // Fragments beyond the far plane of the cascade are not shadowed
+    if (projectionCoord.z > 1.0f)
+        return 0.0f;
+    
+    // Calculate the size of a texel in the shadow map
+    vec2 texelSize = 1.0f / vec2(textureSize(shadowMap, 0).xy);
+    // Define the samples of the kernel
+    int sampleCount = shadowSampleCount(filterType, kernelSize);
+    float rotation = shadowSampleRotation(filterType);
+    
+    // Loop over the PCF kernel
+    float shadow = 0.0f;
+    for(int i = 0; i < sampleCount; ++i)
+    {
+        vec2 sampleOffset = shadowSampleOffset(filterType, i, kernelSize, rotation) * texelSize;
+        vec4 sampleCoord = vec4(projectionCoord.xy + sampleOffset, layer, projectionCoord.z);
+        shadow += opacity * (1.0f - texture(shadowMap, sampleCoord));
+    }
+    
+    return shadow / float(sampleCount);
+}
+
+/**
+ * @brief Calculates a shadow value for a fragment using a set of shadow cascades.
+ *
+ * The cascade is selected from the view depth of the fragment. Near the end of a cascade, the
+ * shadow is blended with the next cascade (or faded out after the last one) to hide the seams
+ * between the resolutions.
+ *
+ * @param shadowMap The sampler2DArrayShadow texture of the shadow map (compared in hardware).
+ * @param transforms The light matrices of the cascades.
+ * @param splits The far distance (view depth) of each cascade.
+ * @param count The number of cascades.
+ * @param blendRange The fraction of each cascade blended with the next one.
+ * @param position The world-space position of the fragment to be shadowed.
+ * @param viewDepth The distance from the camera to the fragment along its view direction.
+ * @param bias The bias value used to prevent shadow acne and peter panning artifacts.
+ * @param filterType The shadow filter defining the samples of the kernel.
+ * @param kernelSize The size of the PCF kernel.
+ * @param opacity Opacity value.
+ *
+ * @return The calculated shadow value for the fragment.
+ */
+float calculateCascadedShadow(sampler2DArrayShadow shadowMap, mat4 transforms[MAX_NUMBER_CASCADES],
+                              vec4 splits, int count, float blendRange, vec3 position,
+                              float viewDepth, float bias, int filterType, int kernelSize, float opacity)
+{
+    // Select the first cascade containing the fragment
+    int layer = count;
+    for (int i = 0; i < count; i++)
+    {
+        if (viewDepth < splits[i])
+        {
+            layer = i;
+            break;
+        }
+    }
+    if (layer >= count)
+        return 0.0f;
+    
+    // Transform the position into the texture coordinates of the cascade
+    vec3 projectionCoord = (transforms[layer] * vec4(position, 1.0f)).xyz * 0.5f + 0.5f;
+    projectionCoord.z -= bias;
+    float shadow = PCFLayer(shadowMap, projectionCoord, float(layer), filterType, kernelSize, opacity);
+    
+    // Blend the end of the cascade with the next one
+    float begin = layer == 0 ? 0.0f : splits[layer - 1];
+    float fade = (splits[layer] - viewDepth) / max((splits[layer] - begin) * blendRange, 1e-4f);
+    if (fade < 1.0f)
+    {
+        float next = 0.0f;
+        if (layer + 1 < count)
+        {
+            vec3 nextCoord = (transforms[layer + 1] * vec4(position, 1.0f)).xyz * 0.5f + 0.5f;
+            nextCoord.z -= bias;
+            next = PCFLayer(shadowMap, nextCoord, float(layer + 1), filterType, kernelSize, opacity);
+        }
+        shadow = mix(next, shadow, fade);
+    }
+    
+    return shadow;
+}
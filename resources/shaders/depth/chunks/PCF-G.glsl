@@ -1,50 +1,45 @@
 /**
  * Percentage Closer Filtering (PCF) with Gaussian weighting for shadow mapping.
  *
- * @param shadowMap The sampler2D texture of the shadow map.
+ * @param shadowMap The sampler2DShadow texture of the shadow map (compared in hardware).
  * @param projectionCoord The normalized device coordinates of the fragment.
+ * @param filterType The shadow filter defining the samples of the kernel.
  * @param kernelSize The size of the PCF kernel.
  * @param sigma The standard deviation of the Gaussian distribution.
  *
  * @return The shadow value for the fragment.
  */
-float PCF(sampler2D shadowMap, vec3 projectionCoord, int kernelSize, float sigma)
+float PCF(sampler2DShadow shadowMap, vec3 projectionCoord, int filterType, int kernelSize, float sigma)
 {
-    // Get depth of current fragment from light's perspective
-    float currentDepth = projectionCoord.z;
-    
     // Calculate the size of a texel in the shadow map
-    vec2 texelSize = 1.0f / textureSize(shadowMap, 0);
-    // Calculate half of the kernel size
-    int halfKernel = kernelSize / 2;
+    vec2 texelSize = 1.0f / vec2(textureSize(shadowMap, 0));
+    // Define the samples of the kernel
+    int sampleCount = shadowSampleCount(filterType, kernelSize);
+    float rotation = shadowSampleRotation(filterType);
     
-    // Initialize shadow value
+    // Initialize shadow value and the sum of weights
     float shadow = 0.0f;
+    float weightSum = 0.0f;
     
     // Loop over the PCF kernel
-    for(int x = -halfKernel; x <= halfKernel; ++x)
+    for(int i = 0; i < sampleCount; ++i)
     {
-       for(int y = -halfKernel; y <= halfKernel; ++y)
-       {
-           // Compute an offset based on the current kernel sample
-           vec2 sampleOffset = vec2(x, y) * texelSize;
-           
-           // Sample the shadow map at the offset position
-           float pcfDepth = texture(shadowMap, projectionCoord.xy + sampleOffset).r;
-           
-           // Calculate the squared distance from the center of the kernel
-           float squaredDistance = float(x * x + y * y);
-           
-           // Apply Gaussian weight to the sample based on the squared distance
-           float weight = exp(-0.5 * (squaredDistance / (sigma * sigma)));
-           
-           // Update the shadow value using the sampled depth and weight
-           shadow += currentDepth > pcfDepth ? weight : 0.0f;
-       }
+        // Compute an offset based on the current kernel sample
+        vec2 offset = shadowSampleOffset(filterType, i, kernelSize, rotation);
+        
+        // Compare the depth of the fragment with the shadow map (1 if lit, 0 if shadowed)
+        float lit = texture(shadowMap, vec3(projectionCoord.xy + offset * texelSize, projectionCoord.z));
+        
+        // Apply Gaussian weight to the sample based on the squared distance (in texels)
+        float weight = exp(-0.5 * (dot(offset, offset) / (sigma * sigma)));
+        
+        // Update the shadow value using the comparison result and weight
+        shadow += weight * (1.0f - lit);
+        weightSum += weight;
     }
     
     // Normalize the shadow value by the sum of weights in the kernel
-    shadow /= float(kernelSize * kernelSize);
+    shadow /= weightSum;
     
     return shadow;
 }
@@ -0,0 +1,47 @@
+/**
+ * @brief Calculates a shadow value for a fragment using the tile of a shadow atlas.
+ *
+ * The samples of the Percentage Closer Filtering (PCF) kernel are clamped to the tile, so the
+ * shadow maps of the other lights never leak into the result.
+ *
+ * @param shadowAtlas The sampler2DShadow texture of the shadow atlas (compared in hardware).
+ * @param tile The offset (xy) and size (zw) of the tile in texture coordinates.
+ * @param position The light-space position of the fragment (in texture coordinates).
+ * @param bias The bias value used to prevent shadow acne and peter panning artifacts.
+ * @param filterType The shadow filter defining the samples of the kernel.
+ * @param kernelSize The size of the PCF kernel.
+ * @param opacity Opacity value.
+ *
+ * @return The calculated shadow value for the fragment.
+ */
+float calculateAtlasShadow(sampler2DShadow shadowAtlas, vec4 tile, vec4 position, float bias,
+                           int filterType, int kernelSize, float opacity)
+{
+    // Apply the bias value and perform the perspective divide
+    vec3 projectionCoord = (position.xyz - vec3(0.0f, 0.0f, bias)) / position.w;
+    
+    // Fragments outside of the light frustum are not shadowed
+    if (any(lessThan(projectionCoord.xy, vec2(0.0f))) || any(greaterThan(projectionCoord.xy, vec2(1.0f))) ||
+        projectionCoord.z > 1.0f)
+        return 0.0f;
+    
+    // Map the coordinates into the tile (the bilinear comparisons read the texels around each
+    // sample, so the samples are kept one texel away from the borders)
+    vec2 texelSize = 1.0f / vec2(textureSize(shadowAtlas, 0));
+    vec2 minCoord = tile.xy + texelSize;
+    vec2 maxCoord = tile.xy + tile.zw - texelSize;
+    vec2 coord = tile.xy + projectionCoord.xy * tile.zw;
+    
+    // Loop over the PCF kernel
+    int sampleCount = shadowSampleCount(filterType, kernelSize);
+    float rotation = shadowSampleRotation(filterType);
+    float shadow = 0.0f;
+    for(int i = 0; i < sampleCount; ++i)
+    {
+        vec2 sampleOffset = shadowSampleOffset(filterType, i, kernelSize, rotation) * texelSize;
+        vec2 sampleCoord = clamp(coord + sampleOffset, minCoord, maxCoord);
+        shadow += opacity * (1.0f - texture(shadowAtlas, vec3(sampleCoord, projectionCoord.z)));
+    }
+    
+    return shadow / float(sampleCount);
+}
@@ -0,0 +1,49 @@
+/**
+ * @brief Calculates a shadow value for a fragment using an omnidirectional shadow map.
+ *
+ * The shadow map stores the linear distance to the light (normalized by the far distance of the
+ * shadows). The samples of the Percentage Closer Filtering (PCF) kernel are taken around the
+ * direction from the light to the fragment, on the plane perpendicular to it.
+ *
+ * @param shadowCube The samplerCubeShadow texture of the shadow map (compared in hardware).
+ * @param position The world-space position of the fragment.
+ * @param lightPosition The world-space position of the light.
+ * @param far The far distance of the shadows.
+ * @param bias The bias value used to prevent shadow acne and peter panning artifacts.
+ * @param filterType The shadow filter defining the samples of the kernel.
+ * @param kernelSize The size of the PCF kernel.
+ * @param opacity Opacity value.
+ *
+ * @return The calculated shadow value for the fragment.
+ */
+float calculateCubeShadow(samplerCubeShadow shadowCube, vec3 position, vec3 lightPosition, float far,
+                          float bias, int filterType, int kernelSize, float opacity)
+{
+    // Get the normalized distance of the current fragment to the light
+    vec3 direction = position - lightPosition;
+    float currentDistance = length(direction) / far - bias;
+    
+    // Fragments beyond the far distance are not shadowed
+    if (currentDistance >= 1.0f)
+        return 0.0f;
+    
+    // Define the plane perpendicular to the direction (a texel of a face is 2 / size at unit distance)
+    vec3 normal = normalize(direction);
+    vec3 up = abs(normal.y) < 0.99f ? vec3(0.0f, 1.0f, 0.0f) : vec3(1.0f, 0.0f, 0.0f);
+    vec3 tangent = normalize(cross(up, normal));
+    vec3 bitangent = cross(normal, tangent);
+    float texelSize = 2.0f / float(textureSize(shadowCube, 0).x);
+    
+    // Loop over the PCF kernel
+    int sampleCount = shadowSampleCount(filterType, kernelSize);
+    float rotation = shadowSampleRotation(filterType);
+    float shadow = 0.0f;
+    for(int i = 0; i < sampleCount; ++i)
+    {
+        vec2 sampleOffset = shadowSampleOffset(filterType, i, kernelSize, rotation) * texelSize;
+        vec3 sampleDirection = normal + tangent * sampleOffset.x + bitangent * sampleOffset.y;
+        shadow += opacity * (1.0f - texture(shadowCube, vec4(sampleDirection, currentDistance)));
+    }
+    
+    return shadow / float(sampleCount);
+}
@@ -0,0 +1,83 @@
+#define SHADOW_FILTER_GRID 0
+#define SHADOW_FILTER_POISSON_DISK 1
+#define SHADOW_FILTER_ROTATED_DISK 2
+
+#define POISSON_DISK_SAMPLES 16
+
+///< Samples of a Poisson disk (with a unit radius).
+const vec2 POISSON_DISK[POISSON_DISK_SAMPLES] = vec2[](
+    vec2(-0.94201624f, -0.39906216f), vec2( 0.94558609f, -0.76890725f),
+    vec2(-0.09418410f, -0.92938870f), vec2( 0.34495938f,  0.29387760f),
+    vec2(-0.91588581f,  0.45771432f), vec2(-0.81544232f, -0.87912464f),
+    vec2(-0.38277543f,  0.27676845f), vec2( 0.97484398f,  0.75648379f),
+    vec2( 0.44323325f, -0.97511554f), vec2( 0.53742981f, -0.47373420f),
+    vec2(-0.26496911f, -0.41893023f), vec2( 0.79197514f,  0.19090188f),
+    vec2(-0.24188840f,  0.99706507f), vec2(-0.81409955f,  0.91437590f),
+    vec2( 0.19984126f,  0.78641367f), vec2( 0.14383161f, -0.14100042f)
+);
+
+/**
+ * Get the number of samples taken by a shadow filter.
+ *
+ * The samples of the grid are two texels apart: each comparison in hardware already filters the
+ * 2x2 texels around it, so the same area is covered with a quarter of the samples.
+ *
+ * @param filterType The shadow filter.
+ * @param kernelSize The size of the filter kernel (in texels).
+ *
+ * @return The number of samples.
+ */
+int shadowSampleCount(int filterType, int kernelSize)
+{
+    if (filterType != SHADOW_FILTER_GRID)
+        return POISSON_DISK_SAMPLES;
+    
+    int axisSamples = kernelSize / 2 + 1;
+    return axisSamples * axisSamples;
+}
+
+/**
+ * Get the rotation of the samples of a shadow filter for the current fragment.
+ *
+ * The rotated disk uses an interleaved gradient noise, so the neighbouring pixels sample different
+ * directions and the banding of the fixed samples is replaced by a fine noise.
+ *
+ * @param filterType The shadow filter.
+ *
+ * @return The rotation angle (in radians).
+ */
+float shadowSampleRotation(int filterType)
+{
+    if (filterType != SHADOW_FILTER_ROTATED_DISK)
+        return 0.0f;
+    
+    float noise = fract(52.9829189f * fract(dot(gl_FragCoord.xy, vec2(0.06711056f, 0.00583715f))));
+    return 6.28318530718f * noise;
+}
+
+/**
+ * Get the offset of a sample of a shadow filter.
+ *
+ * @param filterType The shadow filter.
+ * @param index The index of the sample.
+ * @param kernelSize The size of the filter kernel (in texels).
+ * @param rotation The rotation of the samples (see `shadowSampleRotation`).
+ *
+ * @return The offset of the sample (in texels).
+ */
+vec2 shadowSampleOffset(int filterType, int index, int kernelSize, float rotation)
+{
+    int halfKernel = kernelSize / 2;
+    if (filterType == SHADOW_FILTER_GRID)
+    {
+        int axisSamples = halfKernel + 1;
+        return vec2(float(index % axisSamples), float(index / axisSamples)) * 2.0f - float(halfKernel);
+    }
+    
+    // The disk covers the same area as the kernel
+    float s = sin(rotation);
+    float c = cos(rotation);
+    vec2 sampleOffset = POISSON_DISK[index];
+    return vec2(c * sampleOffset.x - s * sampleOffset.y, s * sampleOffset.x + c * sampleOffset.y) *
+           max(0.5f * float(kernelSize), 1.0f);
+}
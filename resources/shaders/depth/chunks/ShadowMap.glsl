@@ -5,15 +5,17 @@
  * PCF is used to reduce aliasing and improve the quality of shadow rendering by considering multiple
  * samples from the shadow map and applying a filter to their results.
  *
- * @param shadowMap The sampler2D texture of the shadow map.
+ * @param shadowMap The sampler2DShadow texture of the shadow map (compared in hardware).
  * @param position The world-space position of the fragment to be shadowed.
  * @param bias The bias value used to prevent shadow acne and peter panning artifacts.
+ * @param filterType The shadow filter defining the samples of the kernel.
  * @param kernelSize The size of the PCF kernel (number of samples to take).
  * @param weight The weight value, which can be used as a sigma for Gaussian filtering or an opacity value.
  *
  * @return The calculated shadow value for the fragment.
  */
-float calculateShadow(sampler2D shadowMap, vec4 position, float bias, int kernelSize, float weight)
+float calculateShadow(sampler2DShadow shadowMap, vec4 position, float bias, int filterType, int kernelSize,
+                      float weight)
 {
     // Apply the bias value to account for depth bias
     vec3 projectionCoord = position.xyz - vec3(0.0f, 0.0f, bias);
@@ -22,5 +24,5 @@ float calculateShadow(sampler2D shadowMap, vec4 position, float bias, int kernel
     projectionCoord /= position.w;
 
     // Call the PCF function to calculate the shadow value
-    return PCF(shadowMap, projectionCoord, kernelSize, weight);
+    return PCF(shadowMap, projectionCoord, filterType, kernelSize, weight);
 }
@@ -0,0 +1,73 @@
+/**
+ * @brief Warps a depth value with a positive and a negative exponential (EVSM).
+ *
+ * @param depth The depth value (between 0 and 1).
+ * @param exponents The positive (x) and negative (y) exponents of the warp.
+ *
+ * @return The positively (x) and negatively (y) warped depth.
+ */
+vec2 warpDepth(float depth, vec2 exponents)
+{
+    depth = 2.0f * depth - 1.0f;
+    return vec2(exp(exponents.x * depth), -exp(-exponents.y * depth));
+}
+
+/**
+ * @brief Calculates the upper bound of the probability of a fragment being lit from the mean and
+ * variance of the occluders (Chebyshev's inequality).
+ *
+ * @param moments The first (x) and second (y) moments of the occluders.
+ * @param mean The depth of the fragment.
+ * @param minVariance The minimum variance (to prevent shadow acne).
+ * @param bleedingReduction The amount of probability removed to reduce the light bleeding.
+ *
+ * @return The probability of the fragment being lit.
+ */
+float chebyshevUpperBound(vec2 moments, float mean, float minVariance, float bleedingReduction)
+{
+    // Fragments in front of the mean occluder are lit
+    if (mean <= moments.x)
+        return 1.0f;
+    
+    float variance = max(moments.y - moments.x * moments.x, minVariance);
+    float distance = mean - moments.x;
+    float pMax = variance / (variance + distance * distance);
+    
+    // Remove the tail of the distribution, where overlapping occluders bleed light
+    return clamp((pMax - bleedingReduction) / (1.0f - bleedingReduction), 0.0f, 1.0f);
+}
+
+/**
+ * @brief Calculates a shadow value for a fragment using an exponential variance shadow map.
+ *
+ * The moments are prefiltered (blurred and mipmapped), so a single sample gives the shadow of the
+ * whole filter area and the cost does not depend on the size of the penumbra.
+ *
+ * @param momentsMap The sampler2D texture with the moments of the warped depth.
+ * @param parameters The positive (x) and negative (y) exponents and the light bleeding reduction (z).
+ * @param position The light-space position of the fragment (in texture coordinates).
+ * @param opacity Opacity value.
+ *
+ * @return The calculated shadow value for the fragment.
+ */
+float calculateMomentsShadow(sampler2D momentsMap, vec4 parameters, vec4 position, float opacity)
+{
+    vec3 projectionCoord = position.xyz / position.w;
+    
+    // Sample before any divergent branch (the mipmap level depends on the derivatives)
+    vec4 moments = texture(momentsMap, projectionCoord.xy);
+    
+    // Fragments outside of the light frustum are not shadowed
+    if (any(lessThan(projectionCoord.xy, vec2(0.0f))) || any(greaterThan(projectionCoord.xy, vec2(1.0f))) ||
+        projectionCoord.z > 1.0f)
+        return 0.0f;
+    
+    // The minimum variance follows the slope of the warps
+    vec2 depth = warpDepth(projectionCoord.z, parameters.xy);
+    vec2 slope = 1e-4f * parameters.xy * depth;
+    vec2 minVariance = slope * slope;
+    
+    float positive = chebyshevUpperBound(moments.xy, depth.x, minVariance.x, parameters.z);
+    float negative = chebyshevUpperBound(moments.zw, depth.y, minVariance.y, parameters.z);
+    return opacity * (1.0f - min(positive, negative));
+}
@@ -10,20 +10,42 @@ layout (location = 0) in vec4 a_Position;   ///< Vertex position in object space
 // Uniform buffer block containing transformation matrices
 uniform Transform u_Transform;
 
+// Entry point of the vertex shader
+void main()
+{
+    // Pass the position in world space (projected by the geometry shader into each face)
+    gl_Position = u_Transform.Model * a_Position;
+}
+
+#shader geometry
+#version 330 core
+
+// Include the matrices of the cube faces
+#include "Resources/shaders/common/matrix/CubeMatrix.glsl"
+
+// Replicate each triangle in every face of the cube map
+layout (triangles) in;
+layout (triangle_strip, max_vertices = 18) out;
+
+uniform CubeTransform u_CubeTransform;
+
 // Outputs to fragment shader
 out vec3 v_Position;                        ///< Vertex position in world space
 
-// Entry point of the vertex shader
+// Entry point of the geometry shader
 void main()
 {
-    // Transform the vertex position and normal from object space to world space
-    vec4 worldPosition = u_Transform.Model * a_Position;
-    
-    // Perspective divide to get vertex position in normalized device coordinates
-    v_Position = worldPosition.xyz / worldPosition.w;
-    
-    // Calculate the final position of the vertex in clip space
-    gl_Position = u_Transform.Projection * u_Transform.View * worldPosition;
+    for (int face = 0; face < 6; face++)
+    {
+        for (int v = 0; v < 3; v++)
+        {
+            gl_Layer = face;
+            gl_Position = u_CubeTransform.ViewProjection[face] * gl_in[v].gl_Position;
+            v_Position = gl_in[v].gl_Position.xyz / gl_in[v].gl_Position.w;
+            EmitVertex();
+        }
+        EndPrimitive();
+    }
 }
 
 #shader fragment
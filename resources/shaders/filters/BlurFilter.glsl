@@ -14,31 +14,48 @@
 #include "Resources/shaders/common/material/TextureMaterial.glsl"
 
 // Include fragment inputs
-layout (location = 0) out float outColor;
-
-uniform Material u_Material;
-
-in vec2 v_TextureCoord;
+#include "Resources/shaders/common/fragment/T.fs.glsl"
+
+uniform vec2 u_Direction;       // Direction of the blur (one texel along x or y)
+uniform int u_Radius;           // Radius of the blur (in texels)
+
+/**
+ * Evaluate the (unnormalized) Gaussian weight of a texel.
+ *
+ * @param x The distance to the center of the kernel (in texels).
+ * @param sigma The standard deviation of the Gaussian distribution.
+ *
+ * @return The weight of the texel.
+ */
+float gaussian(float x, float sigma)
+{
+    return exp(-0.5f * x * x / (sigma * sigma));
+}
 
-// Entry point of the fragment shader
+// Entry point of the fragment shader (one of the two passes of a separable Gaussian blur)
 void main()
 {
-    vec2 texelSize = 1.0f / vec2(textureSize(u_Material.TextureMap, 0));
-    float result = 0.0f;
-
-    const int kernelSize = 5;
-    const int halfKernel = kernelSize / 2;
-
-    for (int x = -halfKernel; x <= halfKernel; ++x)
+    vec2 texelStep = u_Direction / vec2(textureSize(u_Material.TextureMap, 0));
+    float sigma = max(0.5f * float(u_Radius + 1), 0.5f);
+    
+    // Center of the kernel
+    float weightSum = gaussian(0.0f, sigma);
+    vec4 result = weightSum * texture(u_Material.TextureMap, v_TextureCoord);
+    
+    // Pairs of neighbouring texels are read with a single bilinear sample (placed between them
+    // according to their weights), so the kernel only needs half of the texture reads
+    for (int i = 1; i <= u_Radius; i += 2)
     {
-        for (int y = -halfKernel; y <= halfKernel; ++y)
-        {
-            vec2 offset = vec2(float(x), float(y)) * texelSize;
-            result += texture(u_Material.TextureMap, v_TextureCoord + offset).r;
-        }
+        float w1 = gaussian(float(i), sigma);
+        float w2 = i + 1 <= u_Radius ? gaussian(float(i + 1), sigma) : 0.0f;
+        float weight = w1 + w2;
+        vec2 offset = (float(i) * w1 + float(i + 1) * w2) / weight * texelStep;
+        
+        result += weight * texture(u_Material.TextureMap, v_TextureCoord + offset);
+        result += weight * texture(u_Material.TextureMap, v_TextureCoord - offset);
+        weightSum += 2.0f * weight;
     }
     
-    // Divide by the number of samples (kernelSize * kernelSize)
-    outColor = result / float(kernelSize * kernelSize);
+    // Normalize by the sum of the weights
+    color = result / weightSum;
 }
-
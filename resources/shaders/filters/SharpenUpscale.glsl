@@ -0,0 +1,54 @@
+// Ref: https://gpuopen.com/fidelityfx-cas/ (contrast adaptive sharpening)
+
+#shader vertex
+#version 330 core
+
+// Include transformation matrices
+#include "Resources/shaders/common/matrix/SimpleMatrix.glsl"
+
+// Include vertex shader
+#include "Resources/shaders/common/vertex/PT.vs.glsl"
+
+#shader fragment
+#version 330 core
+
+// Include material properties
+#include "Resources/shaders/common/material/TextureMaterial.glsl"
+
+// Include fragment inputs
+#include "Resources/shaders/common/fragment/T.fs.glsl"
+
+uniform vec2 u_RenderScale;     // Fraction of the texture with the rendered image
+uniform float u_Sharpness;      // Sharpening amount (0 to 1)
+
+// Sample the rendered area of the texture (without filtering the texels outside of it)
+vec4 sampleRendered(vec2 coord, vec2 minCoord, vec2 maxCoord)
+{
+    return texture(u_Material.TextureMap, clamp(coord, minCoord, maxCoord));
+}
+
+// Entry point of the fragment shader
+void main()
+{
+    // Map the screen coordinates into the rendered area of the texture
+    vec2 texelSize = 1.0f / vec2(textureSize(u_Material.TextureMap, 0));
+    vec2 minCoord = 0.5f * texelSize;
+    vec2 maxCoord = u_RenderScale - 0.5f * texelSize;
+    vec2 coord = v_TextureCoord * u_RenderScale;
+
+    // Bilinear upscale of the rendered image and its neighbourhood
+    vec4 center = sampleRendered(coord, minCoord, maxCoord);
+    vec3 north = sampleRendered(coord + vec2(0.0f, texelSize.y), minCoord, maxCoord).rgb;
+    vec3 south = sampleRendered(coord - vec2(0.0f, texelSize.y), minCoord, maxCoord).rgb;
+    vec3 east = sampleRendered(coord + vec2(texelSize.x, 0.0f), minCoord, maxCoord).rgb;
+    vec3 west = sampleRendered(coord - vec2(texelSize.x, 0.0f), minCoord, maxCoord).rgb;
+
+    // Sharpen less where the local contrast is already high (to avoid ringing)
+    vec3 minColor = min(center.rgb, min(min(north, south), min(east, west)));
+    vec3 maxColor = max(center.rgb, max(max(north, south), max(east, west)));
+    vec3 amplitude = clamp(min(minColor, 1.0f - maxColor) / max(maxColor, 1e-4f), 0.0f, 1.0f);
+    vec3 weight = -sqrt(amplitude) * mix(0.125f, 0.2f, clamp(u_Sharpness, 0.0f, 1.0f));
+
+    vec3 result = (center.rgb + weight * (north + south + east + west)) / (1.0f + 4.0f * weight);
+    color = vec4(clamp(result, 0.0f, 1.0f), center.a);
+}
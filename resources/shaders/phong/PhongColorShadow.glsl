@@ -17,6 +17,7 @@
 #include "Resources/shaders/common/view/SimpleView.glsl"
 #include "Resources/shaders/common/light/CompleteLight.glsl"
 #include "Resources/shaders/common/light/EnvironmentLight.glsl"
+#include "Resources/shaders/common/light/ShadowCascades.glsl"
 
 // Include fragment inputs
 #include "Resources/shaders/common/fragment/PN.fs.glsl"
@@ -29,12 +30,20 @@
 #include "Resources/shaders/phong/chunks/PhongSpecular.glsl"
 #include "Resources/shaders/phong/chunks/Phong.glsl"
 
+#include "Resources/shaders/depth/chunks/ShadowFilter.glsl"
 #include "Resources/shaders/depth/chunks/PCF.glsl"
 #include "Resources/shaders/depth/chunks/BiasAngle.glsl"
 #include "Resources/shaders/depth/chunks/ShadowMap.glsl"
+#include "Resources/shaders/depth/chunks/CascadedShadowMap.glsl"
+#include "Resources/shaders/depth/chunks/ShadowAtlas.glsl"
+#include "Resources/shaders/depth/chunks/ShadowCube.glsl"
+#include "Resources/shaders/depth/chunks/ShadowMoments.glsl"
 
 #include "Resources/shaders/environment/chunks/SHIrradiance.glsl"
 
+uniform Cascades u_Cascades;                // Shadow cascades (of a directional light)
+uniform sampler2DShadow u_ShadowAtlas;      // Shadow maps of the lights in an atlas
+
 ///< Mathematical constants.
 const float PI = 3.14159265359f;
 const float INV_PI = 1.0f / PI;
@@ -57,7 +66,26 @@ void main()
                               
         // Calculate shadow factor
         float bias = calculateBias(normal, lightDirection, 0.005f, 0.01f);
-        float shadow = calculateShadow(u_Light[i].ShadowMap, v_LightSpacePosition[i], bias, 11, 1.0f);
+        float shadow = 0.0f;
+        if (u_Cascades.Count > 0 && i == u_Cascades.Light)
+        {
+            float viewDepth = -(u_Cascades.View * vec4(v_Position, 1.0f)).z;
+            shadow = calculateCascadedShadow(u_Cascades.ShadowMap, u_Cascades.Transform, u_Cascades.Splits,
+                                             u_Cascades.Count, u_Cascades.BlendRange, v_Position,
+                                             viewDepth, 0.5f * bias, u_Light[i].ShadowFilter, 5, 1.0f);
+        }
+        else if (u_Light[i].ShadowFar > 0.0f)
+            shadow = calculateCubeShadow(u_Light[i].ShadowCube, v_Position, u_Light[i].Vector.xyz,
+                                         u_Light[i].ShadowFar, 0.1f * bias, u_Light[i].ShadowFilter, 3, 1.0f);
+        else if (u_Light[i].ShadowMoments.w > 0.0f)
+            shadow = calculateMomentsShadow(u_Light[i].MomentsMap, u_Light[i].ShadowMoments,
+                                            v_LightSpacePosition[i], 1.0f);
+        else if (u_Light[i].ShadowTile.z > 0.0f)
+            shadow = calculateAtlasShadow(u_ShadowAtlas, u_Light[i].ShadowTile, v_LightSpacePosition[i],
+                                          bias, u_Light[i].ShadowFilter, 7, 1.0f);
+        else
+            shadow = calculateShadow(u_Light[i].ShadowMap, v_LightSpacePosition[i], bias,
+                                     u_Light[i].ShadowFilter, 7, 1.0f);
         
         // Calculate shading result using Phong shading model with shadows
         reflectance += calculateColor(v_Position, v_Normal, u_View.Position, u_Light[i].Vector, u_Light[i].Color,